@@ -1,4 +1,4 @@
-/* high resolution timer functions for Windows
+/* high resolution timer functions for Windows and Linux
 
 Peter Miller 10/7/2016
 
@@ -8,6 +8,14 @@ and https://msdn.microsoft.com/en-us/library/windows/desktop/dn553408%28v=vs.85%
 Note that GetTickCount() returns a DWORD which is the number of ms windows has been running,  but this has a resolution of typically 5ms
 You can also use the windows function call Sleep(DWORD ms) to pause for at least ms 
 
+Under Linux (and other POSIX systems) clock_gettime(CLOCK_MONOTONIC_RAW) is used, which is not slewed by NTP and is read without a system call
+(via the vDSO) on current kernels, taking ~ 20ns.
+On x86_64 the cycle counter can be used instead by defining HR_TIMER_TSC when compiling this file, which takes ~ 10ns (less with rdtsc than rdtscp)
+and so disturbs the timing of short sections of code less. The TSC is calibrated against CLOCK_MONOTONIC_RAW by init_HR_Timer() (which then
+takes ~ 20ms the first time it is called), and is only used if the processor says it is invariant (ie runs at a constant rate whatever
+the cpu clock speed and power state), otherwise clock_gettime() is still used.
+
+read_HR_Timer_ns() returns a 64 bit count of ns, so unlike read_HR_Timer_us() it does not wrap around after ~ 1.2 hours.
 */
 /*----------------------------------------------------------------------------
  * MIT License:
@@ -36,7 +44,7 @@ You can also use the windows function call Sleep(DWORD ms) to pause for at least
  
 #include "hr_timer.h"
 
-
+#if defined(_WIN32)
 static LARGE_INTEGER time_of_last_reset;
 void init_HR_Timer( void) 
 { // initialise the high resolution timer
@@ -98,6 +106,122 @@ time_us read_HR_Timer_us( void)
  return (int64_t)(mult_to_usecs*(double)deltaTime.QuadPart);// scale to usecs, note this looses some resolution, cast via LARGE_INTEGER ensures result truncated
 }
 
+uint64_t read_HR_Timer_ns( void) 
+{  // read the timer , returns the time (ns) between last reset and now
+   // This version uses integer arithmetic so no resolution is lost however long the program runs
+ LARGE_INTEGER now;
+ uint64_t deltaTime;
+ static uint64_t frequency=0; // this is initialised on the 1st call - see below
+ if( frequency==0)
+ 	{LARGE_INTEGER f;
+ 	 QueryPerformanceFrequency( &f ) ; // frequency that time is updated at
+ 	 frequency=f.QuadPart ;
+ 	}		 
+ QueryPerformanceCounter(&now) ; // current time
+ deltaTime=now.QuadPart-time_of_last_reset.QuadPart; // subtract to get time since last reset
+ return (deltaTime/frequency)*1000000000u+(deltaTime%frequency)*1000000000u/frequency; // whole secs then the fraction, so the multiply cannot overflow
+}
+
+#else /* Linux */
+#include <time.h>
+#ifndef CLOCK_MONOTONIC_RAW
+ #define CLOCK_MONOTONIC_RAW CLOCK_MONOTONIC /* not Linux, use the nearest equivalent */
+#endif
+#if defined(HR_TIMER_TSC) && defined(__x86_64__)
+ #include <x86intrin.h>
+ #include <cpuid.h>
+#else
+ #undef HR_TIMER_TSC
+#endif
+
+static uint64_t time_of_last_reset; // ns
+
+static uint64_t clock_ns( void)
+{ // ns from an arbitrary starting point
+ struct timespec ts;
+ clock_gettime(CLOCK_MONOTONIC_RAW,&ts);
+ return (uint64_t)ts.tv_sec*1000000000u+(uint64_t)ts.tv_nsec;
+}
+
+#ifdef HR_TIMER_TSC
+static int use_tsc=0; // 0 => clock_gettime(), 1 => rdtsc, 2 => rdtscp , set by calibrate_tsc()
+static uint64_t tsc_base,ns_base; // cycle count and clock_ns() at the same time
+static uint64_t tsc_mult; // ns per cycle as a 32.32 bit fixed point number
+
+static uint64_t read_tsc( void)
+{unsigned int aux;
+ if(use_tsc==2)
+ 	return __rdtscp(&aux); // waits for earlier instructions to complete, so the code being timed cannot "leak" past the read
+ _mm_lfence(); // the same for rdtsc
+ return __rdtsc();
+}
+
+static void calibrate_tsc( void)
+{ // measure the TSC frequency against CLOCK_MONOTONIC_RAW over ~ 20ms, leaves use_tsc as 0 if the TSC cannot be trusted
+ unsigned int a,b,c,d;
+ uint64_t c0,c1,t0,t1;
+ if(!__get_cpuid(0x80000007,&a,&b,&c,&d) || !(d & (1u<<8)))
+ 	return; // not an invariant TSC, its rate may change with the cpu clock speed or stop in sleep states
+ use_tsc=(__get_cpuid(0x80000001,&a,&b,&c,&d) && (d & (1u<<27))) ? 2 : 1; // rdtscp if supported
+ t0=clock_ns();
+ c0=read_tsc();
+ do
+ 	{t1=clock_ns();
+ 	 c1=read_tsc();
+ 	} while(t1-t0<20000000); // 20ms gives an error of ~ 1ppm from the ~ 20ns uncertainty in reading the clock
+ if(c1<=c0)
+ 	{use_tsc=0;
+ 	 return;
+ 	}
+ tsc_mult=(uint64_t)(((unsigned __int128)(t1-t0)<<32)/(c1-c0));
+ tsc_base=c1;
+ ns_base=t1;
+}
+#endif
+
+static uint64_t now_ns( void)
+{ // ns from an arbitrary starting point, from the TSC if it has been calibrated
+#ifdef HR_TIMER_TSC
+ if(use_tsc)
+ 	return ns_base+(uint64_t)(((unsigned __int128)(read_tsc()-tsc_base)*tsc_mult)>>32);
+#endif
+ return clock_ns();
+}
+
+void init_HR_Timer( void) 
+{ // initialise the high resolution timer
+  // zero the timer by reading (and storing) curent time
+#ifdef HR_TIMER_TSC
+ static int calibrated=0;
+ if(!calibrated)
+ 	{calibrate_tsc();
+ 	 calibrated=1;
+ 	}
+#endif
+ time_of_last_reset=now_ns();
+}
+
+double read_HR_Timer( void) 
+{  // read the timer , returns the time (secs) between last reset and now to ~ nS resolution
+ return (double)(now_ns()-time_of_last_reset)*1e-9;
+}
+
+time_us read_HR_Timer_ms( void) 
+{  // read the timer , returns the time (ms) between last reset and now, truncated
+ return (time_us)((now_ns()-time_of_last_reset)/1000000u);
+}
+
+time_us read_HR_Timer_us( void) 
+{  // read the timer , returns the time (us) between last reset and now, truncated (will overflow in ~ 1.2 hours)
+ return (time_us)((now_ns()-time_of_last_reset)/1000u);
+}
+
+uint64_t read_HR_Timer_ns( void) 
+{  // read the timer , returns the time (ns) between last reset and now
+ return now_ns()-time_of_last_reset;
+}
+#endif
+
 int32_t  diff_time(time_us a, time_us b) // returns a-b valid if a, b within 2^31 of each other
 	// warning overflow of signed integers is not defined by C standard, but overflow of unsigned is.
 	// however this function must return a signed type (here int32_t rather than time_us which may be unsigned).
@@ -1,6 +1,6 @@
 /* hr_timer.h
 
-  header file for windows high resolution timer functions
+  header file for high resolution timer functions (Windows and Linux)
   
   Peter Miller 10/7/2016
   See hr_timer.c for details.
@@ -33,7 +33,9 @@
  
 #ifndef __HR_TIMER
 #define __HR_TIMER
+#if defined(_WIN32)
 #include <windows.h>
+#endif
 #include <stdint.h>
 typedef uint32_t time_us ; // all time calcs should use this type, note overflows in ~ 36 mins with in32 and 1 hr 12 mins with uint32, so code should allow for this
 					/* warning if this is a signed type then the behaviour is not guaranteed by the C standard
@@ -49,6 +51,7 @@ void init_HR_Timer( void) ; // initialise the high resolution timer
 double read_HR_Timer( void) ;  // read the timer , returns the time (secs) between last reset and now to ~ uS resolution
 time_us read_HR_Timer_ms( void) ; // read the timer, result in ms as an integer
 time_us read_HR_Timer_us( void) ; // read the timer, result in us as an integer, overflows in ~ 1.2 hours
+uint64_t read_HR_Timer_ns( void) ; // read the timer, result in ns as a 64 bit integer, does not overflow (for ~ 584 years)
 int32_t diff_time(time_us a, time_us b); // returns a-b valid if a, b with 2^31 of each other
 										 // note returns an int32_t as time_us may be unsigned and the result has to be signed
 #endif
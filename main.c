@@ -15,7 +15,8 @@ Note -fsanitize=undefined -fsanitize-undefined-trap-on-error when used together
 	 -fsanitize=bounds 	-fsanitize-undefined-trap-on-error also works OK.		
 	 without -fsanitize-undefined-trap-on-error linker complains it cannot find -lasan on mingw
 Under ubuntu the -fsanatize works as expected (but also needs -g to add debugging info to executable).
-	I use gcc -Wall -Ofast -fsanitize=address -fsanitize=undefined -fsanitize-address-use-after-scope -fstack-protector-all -g3  main.c atof.c double-double.c -lasan -lquadmath -lm -o test
+	I use gcc -Wall -Ofast -fsanitize=address -fsanitize=undefined -fsanitize-address-use-after-scope -fstack-protector-all -g3  main.c atof.c double-double.c hr_timer.c -lasan -lquadmath -lm -pthread -o test
+	and then again with -DTEST_NO_LD added to test the conversions used when YA_SP_SPRINTF_LD is not defined (see TEST_NO_LD below)
 
 also note :
 #ifdef __cplusplus
@@ -31,6 +32,7 @@ is more flexible than the form I'm currently using.
 */
 #define PART1_SPRINTF_TESTS /* if defined do detailed testing of double conversions (including "round loop" (converting double->string->double)  - these tests take ~ 2 minutes */
 #define PART2_SPRINTF_TESTS /* if defined do testing of all formats and conversion types - these tests take ~ 2 seconds */
+#define PART3_SPRINTF_BENCHMARKS /* if defined run some short speed comparisons after the tests - these take a few seconds */
 	/* define both PART1 and PART2 for full tests, just PART2 for a quick set of tests with reasonable coverage */
 	
 /* 
@@ -125,8 +127,8 @@ PART2: 1960234 sprintf tests completed, no errors found
 */
 
 // you will not normally need to touch the settings below
-#if defined(__WIN64) || defined(__WIN32)
- #define USE_HR_TIMER /* define to use HR_TIMER to display execution times - only supported on windows */
+#if defined(__WIN64) || defined(__WIN32) || defined(__linux)
+ #define USE_HR_TIMER /* define to use HR_TIMER to display execution times (and time the benchmarks) - supported on windows and linux, needs hr_timer.c */
 #endif
 #ifdef __MINGW32__ 
 /* Define __USE_MINGW_ANSI_STDIO to 1 to use C99 compatible stdio functions on MinGW. see for example https://stackoverflow.com/questions/44382862/how-to-printf-a-size-t-without-warning-in-mingw-w64-gcc-7-1 */
@@ -146,10 +148,20 @@ PART2: 1960234 sprintf tests completed, no errors found
 #define USE_FAST_STRTOD /* if defined use fast_strtod(), otherwise use system strtod() for round loop checks */
 // #define PRINT_DIFFS /* if defined print all differences, otherwise only print major ones */
 // #define YA_SP_NO_DIGITPAIR /* if defined avoid using a lookup table to convert binary to decimal [00..99] */
+// #define YA_SP_DD_SCALING /* if defined (and YA_SP_SPRINTF_LD is not) use the original double-double scaling for doubles */
+#ifndef TEST_NO_LD /* compile with -DTEST_NO_LD to test without long doubles, which is the only way the exact double conversion (YA_S__DBL_EXACT) gets tested */
 #define YA_SP_SPRINTF_LD /* use long doubles in ya_sprintf() also allows printing %Lg etc to print long doubles */
+#endif
 #if  defined(__SIZEOF_INT128__) && defined(YA_SP_SPRINTF_LD) /* only allow YA_SP_SPRINTF_Q if compiler supports __float128 & __int128 */
 #define YA_SP_SPRINTF_Q  /* allows printing __float128's in ya_sprintf() via %Qg etc */
 #endif
+#define YA_SP_FORMAT_CACHE /* cache compiled format strings inside ya_sprintf() - all the tests below then also check the cache */
+#define YA_SP_FORMAT_CACHE_SLOTS 4096 /* main.c uses a lot of different format strings */
+#define YA_SP_FORMAT_CACHE_STATS /* for ya_s_format_cache_stats() */
+#define YA_SP_LOG /* add ya_s_log() - check_prog() then also checks every format logged and drained gives the same output */
+#ifndef _WIN32
+#define YA_SP_MPSC /* add ya_s_mpsc_printf() */
+#endif
 // #define PR_EXPECTED_ERRORS /* if defined with FULL_SPRINTF_TESTS & YA_SP_SPRINTF_Q  shows expected errors (not counted as "real" errors) */
 
 
@@ -202,6 +214,13 @@ PART2: 1960234 sprintf tests completed, no errors found
 #include <math.h>
 #include <stdint.h>  /* for int64_t etc */
 #include <sys/types.h> 
+#ifndef _WIN32
+#include <fcntl.h> /* open() for ya_s_dprintf() */
+#include <unistd.h>
+#include <pthread.h> /* background thread for ya_s_log_drain() */
+#include <sched.h> /* sched_yield() */
+#include <sys/mman.h> /* mmap() and mprotect() for strings that end just before an unreadable page */
+#endif
 
 #include <limits.h>
 
@@ -582,6 +601,45 @@ uint64_t errs_dbl19=0,errs_printf19=0,errs_dbl19_1bit=0;
 uint64_t errs_dbl18=0,errs_printf18=0,errs_dbl18_1bit=0;
 uint64_t errs_dbl17=0,errs_printf17=0,errs_dbl17_1bit=0;
 uint64_t errs_dbl16=0,errs_printf16=0,errs_dbl16_1bit=0;
+uint64_t errs_shortest=0,errs_shortest_len=0,nos_shortest=0; // %r checks
+
+#ifdef YA_SP_SPRINTF_IMPLEMENTATION
+/* check %r (shortest round trip) gives a string that converts back to x, and that no string with 1 less significant digit does.
+   This uses the system strtod() as fast_strtod() is not always correctly rounded for inputs with 16 or 17 digits */
+static int same_double(double a,double b) /* compare bit patterns, as with -Ofast (DAZ/FTZ) == treats every denormal as equal to 0 */
+{return memcmp(&a,&b,sizeof(a))==0;
+}
+void check_shortest(char *in_str,double x)
+{char r_str[50],s_str[50];
+ int nd=0;
+ double nx;
+ char *cp;
+ if(!isfinite(x)) return;
+ if(in_str==NULL) in_str=""; // allow in_str to be null
+ nos_shortest++;
+ ya_s_sprintf(r_str,"%r",x);
+ nx=strtod(r_str,NULL);
+ if(!same_double(nx,x))
+ 	{errs_shortest++;
+ 	 printf("%%r Different: %s (%.17g) %%r=>\"%s\" which as a double is %.17g\n",in_str,x,r_str,nx);
+ 	 return;
+ 	}
+ // count significant digits (ignoring leading zeros, and trailing zeros before the decimal point)
+ for(cp=r_str;*cp && (*cp<'1' || *cp>'9') ;++cp); // skip sign, leading zeros and decimal point
+ for(;*cp && *cp!='e';++cp)
+ 	if(isdigit(*cp)) nd++;
+ if(strchr(r_str,'e')==NULL && strchr(r_str,'.')==NULL)
+ 	{for(--cp;cp>r_str && *cp=='0';--cp) nd--; // trailing zeros in an integer are not significant
+ 	}
+ if(nd>1)
+ 	{ya_s_sprintf(s_str,"%.*e",nd-2,x); // correctly rounded to 1 less digit
+ 	 if(same_double(strtod(s_str,NULL),x))
+ 	 	{errs_shortest_len++;
+ 	 	 printf("%%r not shortest: %s (%.17g) %%r=>\"%s\" but \"%s\" also converts back to the same double\n",in_str,x,r_str,s_str);
+ 	 	}
+ 	}
+}
+#endif
 
 
 void check_float_to_str(char *in_str,double x)
@@ -826,6 +884,9 @@ void check_float_to_str(char *in_str,double x)
  	 	  printf("printf Double Different: %s (%.16g) to 16 sg printf=>\"%s\" which as a double is %.16g\n",in_str,x,printf_str,nx);
 #endif 	 	  
  	    }
+#ifdef YA_SP_SPRINTF_IMPLEMENTATION
+ check_shortest(in_str,x);
+#endif
 }
 
 
@@ -833,6 +894,284 @@ void check_float_to_str(char *in_str,double x)
 */
 unsigned int serrs=0,scnt=0;
 unsigned int expected_errs=0;
+int exec_sprintf(char *buf,ya_s_format_program const *prog,...) /* ya_s_sprintf() equivalent using a compiled format */
+{
+ int r;
+ va_list va;
+ va_start(va,prog);
+ r=ya_s_exec(NULL,NULL,buf,prog,va);
+ va_end(va);
+ return r;
+}
+#ifdef YA_SP_FORMAT_CACHE
+int nocache_sprintf(char *buf,const char *fmt,...) /* ya_s_sprintf() parsing fmt every time, as it does without YA_SP_FORMAT_CACHE (this calls the engine inside ya_sprintf.h directly) */
+{
+ int r;
+ va_list va;
+ va_start(va,fmt);
+ r=ya_s__vsprintf_cb(NULL,NULL,buf,YA_SP_SPRINTF_MIN,fmt,NULL,va);
+ va_end(va);
+ return r;
+}
+#endif
+
+#ifdef YA_SP_LOG
+/* a sink that collects the output of ya_s_log_drain() in log_out[] */
+static char log_out[400000];
+static int log_pos,log_flushes;
+static char *log_reserve(void *user,int want,int *avail)
+{(void)user;
+ *avail=(int)sizeof(log_out)-1-log_pos;
+ return (want<=*avail) ? log_out+log_pos : NULL;
+}
+static void log_commit(void *user,int len)
+{(void)user;
+ log_pos+=len;
+}
+static void log_flush(void *user)
+{(void)user;
+ log_flushes++;
+}
+static ya_s_sink log_sink={log_reserve,log_commit,log_flush,NULL};
+static ya_s_log_ring test_ring;
+static char test_ring_mem[1<<16];
+
+/* ya_s_vlog() x and drain it into log_out[], returns the number of chars or -1 if it was not logged */
+int log_and_drain(char *x,va_list va)
+{
+ if(test_ring.mem==NULL)
+ 	{ya_s_log_ring_init(&test_ring,test_ring_mem,sizeof(test_ring_mem));
+ 	 ya_s_log_attach(&test_ring);
+ 	}
+ log_pos=0;
+ log_flushes=0;
+ if(ya_s_vlog(x,va)) return -1;
+ if(ya_s_log_drain(&log_sink)!=1 || log_flushes!=1) return -1;
+ log_out[log_pos]=0;
+ return log_pos;
+}
+#endif
+
+#ifdef YA_SP_MPSC
+/* 4 threads write numbered lines to a small shared ring at once */
+static ya_s_mpsc test_mpsc;
+static char test_mpsc_mem[4096],mpsc_long[600];
+static int mpsc_done;
+static void *mpsc_producer(void *arg)
+{int t=(int)(size_t)arg;
+ for(int i=0;i<5000;++i)
+ 	if(ya_s_mpsc_printf(&test_mpsc,"thread %d line %d %s\n",t,i,i%100==99?mpsc_long:"")<0) break;
+ __atomic_add_fetch(&mpsc_done,1,__ATOMIC_RELEASE);
+ return NULL;
+}
+#endif
+
+/* ya_s_sprintf() with the locale loc for this call only */
+static int loc_sprintf(char *buf,ya_s_locale const *loc,const char *fmt,...)
+{va_list va;
+ int r;
+ va_start(va,fmt);
+ r=ya_s_vsprintfcb_locale(NULL,NULL,buf,0,loc,fmt,va);
+ va_end(va);
+ return r;
+}
+
+/* format with the ' flag (fmt_g) in locale loc, and without it (fmt_p) in the default locale then put in loc's separators here, returns 1 if they differ */
+static int check_grouped(ya_s_locale const *loc,const char *fmt_g,const char *fmt_p,...)
+{static char plain[600],expect[1200],got[1200];
+ const char *p,*e;
+ char *o=expect;
+ int n,g=loc->grouping;
+ va_list va,vb;
+ va_start(va,fmt_p);
+ va_copy(vb,va);
+ ya_s_vsprintf(plain,fmt_p,va);
+ va_end(va);
+ for(p=plain;*p && (*p<'0' || *p>'9');) *o++=*p++; /* the sign */
+ for(e=p;*e>='0' && *e<='9';++e);
+ for(n=(int)(e-p);n>0;)
+ 	{*o++=*p++;
+ 	 if(--n && n%g==0) *o++=loc->comma;
+ 	}
+ for(;*p;++p) *o++=(*p=='.')?loc->period:*p;
+ *o=0;
+ ya_s_set_locale(loc);
+ n=ya_s_vsprintf(got,fmt_g,vb);
+ ya_s_set_locale(NULL);
+ va_end(vb);
+ if(n==(int)strlen(expect) && !strcmp(got,expect)) return 0;
+ printf("grouping %d: \"%s\" gave \"%s\" expected \"%s\"\n",g,fmt_g,got,expect);
+ return 1;
+}
+
+#ifndef _WIN32
+/* threads formatting in different locales at once */
+static void *locale_thread(void *arg)
+{ya_s_locale const *loc=(ya_s_locale const *)arg;
+ char buf[100],expect[100];
+ size_t bad=0;
+ ya_s_set_locale(loc);
+ ya_s_sprintf(expect,"%'d %.2f",1234567,0.5);
+ for(int i=0;i<100000;++i)
+ 	{ya_s_sprintf(buf,"%'d %.2f",1234567,0.5);
+ 	 if(strcmp(buf,expect)) ++bad;
+ 	}
+ if(expect[1]!=loc->comma || expect[11]!=loc->period) ++bad;
+ return (void *)bad;
+}
+#endif
+
+/* check the same format via ya_s_compile_format()+ya_s_exec() gives an identical result to ya_s_sprintf() [ buf_ya,r_ya ], and ya_s_vformat_length() agrees with its length */
+void check_prog(char *x,char *buf_ya,int r_ya,...)
+{
+ static char buf_p[1000];
+ static ya_s_format_program prog;
+ int r_p;
+ va_list va;
+ scnt++;
+ if(!ya_s_compile_format(&prog,x)) {++serrs;printf("%s: ya_s_compile_format() failed\n",x);return;}
+ scnt++;
+ va_start(va,r_ya);
+ r_p=ya_s_vformat_length(x,va);
+ va_end(va);
+ if(r_p!=r_ya){ ++serrs;printf ("%s: ya_sprintf() returns %d ya_s_vformat_length() returns %d\n",x,r_ya,r_p);}
+#ifdef YA_SP_FORMAT_CACHE
+ scnt++; /* ya_s_sprintf() normally uses the cached program for x, so check parsing x directly too */
+ va_start(va,r_ya);
+ r_p=ya_s__vsprintf_cb(NULL,NULL,buf_p,YA_SP_SPRINTF_MIN,x,NULL,va);
+ va_end(va);
+ if(r_p!=r_ya || strcmp(buf_p,buf_ya)) {++serrs;printf("%s: ya_sprintf() gives %s (%d chars), without the format cache %s (%d chars)\n",x,buf_ya,r_ya,buf_p,r_p);}
+#endif
+#ifdef YA_SP_LOG
+ scnt++;
+ va_start(va,r_ya);
+ r_p=log_and_drain(x,va);
+ va_end(va);
+ if(r_p!=r_ya || strcmp(log_out,buf_ya)) {++serrs;printf("%s: ya_sprintf() gives %s ya_s_log() gives %s (%d chars)\n",x,buf_ya,r_p<0?"nothing":log_out,r_p);}
+#endif
+ va_start(va,r_ya);
+ r_p=ya_s_exec(NULL,NULL,buf_p,&prog,va);
+ va_end(va);
+ if(r_p!=r_ya){ ++serrs;printf ("%s: ya_sprintf() returns %d ya_s_exec() returns %d\n",x,r_ya,r_p);}
+ if(strcmp(buf_p,buf_ya)) {++serrs;printf("%s: ya_sprintf() gives %s ya_s_exec() gives %s\n",x,buf_ya,buf_p);};
+}
+
+/* check ya_s_vformat_length() gives the length of the output of ya_s_vsprintf() */
+void check_length(char *x,...)
+{
+ static char buf_v[20000];
+ int r_l,r_v;
+ va_list va,vb;
+ scnt++;
+ va_start(va,x);
+ va_copy(vb,va);
+ r_v=ya_s_vsprintf(buf_v,x,va);
+ r_l=ya_s_vformat_length(x,vb);
+ va_end(vb);
+ va_end(va);
+ if(r_l!=r_v) {++serrs;printf("%s: ya_s_vsprintf() returns %d ya_s_vformat_length() returns %d\n",x,r_v,r_l);}
+}
+/* a sink that hands out small odd sized pieces of one large buffer, so ya_s_vsprintfsink() has to split the output at every possible place */
+typedef struct test_sink {
+ char *out;
+ int pos,avail,n,flushes,stop; /* stop: reserve() returns NULL once this many chars have been committed (0 never) */
+} test_sink;
+static char *test_reserve(void *user,int want,int *avail)
+{test_sink *t=(test_sink *)user;
+ if(t->stop && t->pos>=t->stop) return NULL;
+ t->avail=want+(t->n++)%7;
+ *avail=t->avail;
+ return t->out+t->pos;
+}
+static void test_commit(void *user,int len)
+{test_sink *t=(test_sink *)user;
+ if(len<0 || len>t->avail) {++serrs;printf("ya_s_vsprintfsink(): commit(%d) after reserve() of %d chars\n",len,t->avail);}
+ t->pos+=len;
+}
+static void test_flush(void *user)
+{((test_sink *)user)->flushes++;
+}
+
+/* check ya_s_vsprintfsink() gives an identical result to ya_s_vsprintf() , and if stop is non-zero that the conversion stops there */
+void check_sink(char *x,int stop,...)
+{
+ static char buf_s[20000],buf_v[20000];
+ test_sink t={buf_s,0,0,0,0,stop};
+ ya_s_sink sink={test_reserve,test_commit,test_flush,&t};
+ int r_s,r_v;
+ va_list va,vb;
+ scnt++;
+ va_start(va,stop);
+ va_copy(vb,va);
+ r_v=ya_s_vsprintf(buf_v,x,va);
+ r_s=ya_s_vsprintfsink(&sink,x,vb);
+ va_end(vb);
+ va_end(va);
+ buf_s[t.pos]=0;
+ if(stop)
+ 	{if(r_s!=t.pos || t.pos<stop || t.pos>=r_v || strncmp(buf_s,buf_v,t.pos) || t.flushes!=0) {++serrs;printf("%s: ya_s_vsprintfsink() stopped at %d returns %d (%d flushes)\n",x,t.pos,r_s,t.flushes);}
+	}
+ else if(r_s!=r_v || t.pos!=r_v || t.flushes!=1 || strcmp(buf_s,buf_v)) {++serrs;printf("%s: ya_s_vsprintf() returns %d ya_s_vsprintfsink() returns %d (%d chars, %d flushes)\n",x,r_v,r_s,t.pos,t.flushes);}
+}
+
+/* callback for ya_s_vsprintfcb_ex() that appends each chunk to cb_out[] */
+static char cb_out[20000];
+static int cb_pos,cb_buflen,cb_bad;
+static char *cb_append(const char *buf,void *user,int len)
+{
+ if(len<1 || len>cb_buflen) cb_bad=1;
+ memcpy(cb_out+cb_pos,buf,len);
+ cb_pos+=len;
+ return (char *)user;
+}
+
+/* check ya_s_vsprintfcb_ex() with a buflen char buffer gives an identical result to ya_s_vsprintf() */
+void check_cb_ex(int buflen,char *x,...)
+{
+ static char buf_v[20000];
+ char *buf=malloc(buflen);
+ int r_c,r_v;
+ va_list va,vb;
+ scnt++;
+ cb_pos=0;
+ cb_buflen=buflen;
+ cb_bad=0;
+ va_start(va,x);
+ va_copy(vb,va);
+ r_v=ya_s_vsprintf(buf_v,x,va);
+ r_c=ya_s_vsprintfcb_ex(cb_append,buf,buf,buflen,x,vb);
+ va_end(vb);
+ va_end(va);
+ cb_out[cb_pos]=0;
+ if(r_c!=r_v || cb_pos!=r_v || cb_bad || strcmp(cb_out,buf_v)) {++serrs;printf("%s: ya_s_vsprintf() returns %d ya_s_vsprintfcb_ex(%d) returns %d (%d chars)\n",x,r_v,buflen,r_c,cb_pos);}
+ free(buf);
+}
+
+/* check ya_s_vasprintf() and ya_s_vasprintf_arena() (from test_bump) give an identical result to ya_s_vsprintf() */
+static ya_s_bump test_bump;
+void check_asprintf(char *x,...)
+{
+ static char buf_v[200000];
+ char *str_a,*str_b;
+ int r_v,r_a,r_b;
+ size_t used=test_bump.used;
+ ya_s_arena arena={ya_s_bump_grow,&test_bump};
+ va_list va,vb,vc;
+ scnt++;
+ va_start(va,x);
+ va_copy(vb,va);
+ va_copy(vc,va);
+ r_v=ya_s_vsprintf(buf_v,x,va);
+ r_a=ya_s_vasprintf(&str_a,x,vb);
+ r_b=ya_s_vasprintf_arena(&arena,&str_b,x,vc);
+ va_end(vc);
+ va_end(vb);
+ va_end(va);
+ if(r_a!=r_v || str_a==NULL || strcmp(str_a,buf_v)) {++serrs;printf("%s: ya_s_vsprintf() returns %d ya_s_vasprintf() returns %d\n",x,r_v,r_a);}
+ if(r_b!=r_v || str_b==NULL || strcmp(str_b,buf_v) || test_bump.used!=used+r_v+1) {++serrs;printf("%s: ya_s_vsprintf() returns %d ya_s_vasprintf_arena() returns %d (%d bytes used)\n",x,r_v,r_b,(int)(test_bump.used-used));}
+ free(str_a);
+}
+
 /* simple strings */
 void check_str_s(char *x)
 {
@@ -856,6 +1195,7 @@ void check_str_s(char *x)
  scnt++;	
  r=sprintf(buf,x);
  r_ya=ya_s_sprintf(buf_ya,x);
+ check_prog(x,buf_ya,r_ya);
  if(r!=r_ya){ ++serrs;printf ("%s: sprintf() returns %d ya_sprintf() returns %d\n",x,r,r_ya);}
  if(strcmp(buf,buf_ya)) {++serrs;printf("%s: sprintf() gives %s ya_sprintf() gives %s\n",x,buf,buf_ya);};
  // repeat with snprintf and n=5
@@ -876,6 +1216,7 @@ void check_str_c(char *x,char PAR)
  scnt++;
  r=sprintf(buf,x,PAR);
  r_ya=ya_s_sprintf(buf_ya,x,PAR);
+ check_prog(x,buf_ya,r_ya,PAR);
  if(r!=r_ya){ ++serrs;printf ("%s: sprintf() returns %d ya_sprintf() returns %d\n",x,r,r_ya);}
  if(strcmp(buf,buf_ya)) {++serrs;printf("%s: sprintf() gives %s ya_sprintf() gives %s\n",x,buf,buf_ya);};	
  // repeat with snprintf and n=5
@@ -896,6 +1237,7 @@ void check_str_str(char *x)
  char * PAR=NULL; /* string to print - check NULL 1st*/
  r=sprintf(buf,x,PAR);
  r_ya=ya_s_sprintf(buf_ya,x,PAR);
+ check_prog(x,buf_ya,r_ya,PAR);
  if(r!=r_ya){ ++serrs;printf ("%s: sprintf() returns %d ya_sprintf() returns %d\n",x,r,r_ya);}
  if(strcmp(buf,buf_ya)) {++serrs;printf("%s: sprintf() gives %s ya_sprintf() gives %s\n",x,buf,buf_ya);};
  scnt++;
@@ -903,6 +1245,7 @@ void check_str_str(char *x)
  PAR="abcdefg"; /* string to print */
  r=sprintf(buf,x,PAR);
  r_ya=ya_s_sprintf(buf_ya,x,PAR);
+ check_prog(x,buf_ya,r_ya,PAR);
  if(r!=r_ya){ ++serrs;printf ("%s: sprintf() returns %d ya_sprintf() returns %d\n",x,r,r_ya);}
  if(strcmp(buf,buf_ya)) {++serrs;printf("%s: sprintf() gives %s ya_sprintf() gives %s\n",x,buf,buf_ya);};
  scnt++;
@@ -938,6 +1281,7 @@ void check_str_i1(char *x,int PAR)
 	// basic check sprintf
  r=sprintf(buf,x,PAR);
  r_ya=ya_s_sprintf(buf_ya,x,PAR);
+ check_prog(x,buf_ya,r_ya,PAR);
  if(r!=r_ya){ ++serrs;printf ("%s(%d): sprintf() returns %d ya_sprintf() returns %d\n",x,PAR,r,r_ya);}
  if(strcmp(buf,buf_ya)) {++serrs;printf("%s(%d): sprintf() gives %s ya_sprintf() gives %s\n",x,PAR,buf,buf_ya);};
  // now check round the loop, only if %d at start of format string
@@ -994,6 +1338,7 @@ void check_str_l1(char *x,long PAR)
 	// basic check sprintf
  r=sprintf(buf,x,PAR);
  r_ya=ya_s_sprintf(buf_ya,x,PAR);
+ check_prog(x,buf_ya,r_ya,PAR);
  if(r!=r_ya){ ++serrs;printf ("%s(%ld): sprintf() returns %d ya_sprintf() returns %d\n",x,PAR,r,r_ya);}
  if(strcmp(buf,buf_ya)) {++serrs;printf("%s(%ld): sprintf() gives %s ya_sprintf() gives %s\n",x,PAR,buf,buf_ya);};
  long lr,lr_ya;
@@ -1050,6 +1395,7 @@ void check_str_ll1(char *x,long long PAR)
 	// basic check sprintf
  r=sprintf(buf,x,PAR);
  r_ya=ya_s_sprintf(buf_ya,x,PAR);
+ check_prog(x,buf_ya,r_ya,PAR);
  if(r!=r_ya){ ++serrs;printf ("%s(%lld): sprintf() returns %d ya_sprintf() returns %d\n",x,PAR,r,r_ya);}
  if(strcmp(buf,buf_ya)) {++serrs;printf("%s(%lld): sprintf() gives %s ya_sprintf() gives %s\n",x,PAR,buf,buf_ya);};
  long long lr,lr_ya;
@@ -1107,6 +1453,7 @@ void check_str_g1(char *x,double PAR)
 	// basic check sprintf
  r=sprintf(buf,x,PAR);
  r_ya=ya_s_sprintf(buf_ya,x,PAR);
+ check_prog(x,buf_ya,r_ya,PAR);
  if(r!=r_ya){ ++serrs;printf ("%s(%g): sprintf() returns %d ya_sprintf() returns %d\n",x,PAR,r,r_ya);}
  if(strcmp(buf,buf_ya)) {++serrs;printf("%s(%g): sprintf() gives %s ya_sprintf() gives %s\n",x,PAR,buf,buf_ya);};
  if(*x=='%') // check "round the loop" when %g is at the start of the string
@@ -1176,6 +1523,7 @@ void check_str_f1(char *x,double PAR)
 	// basic check sprintf, need to use strtod() to check equiv doubles are the same as ansii digits vary after ~ 10th sig figure, can only do that if %f is at the start of the format string
  r=sprintf(buf,x,PAR);
  r_ya=ya_s_sprintf(buf_ya,x,PAR);
+ check_prog(x,buf_ya,r_ya,PAR);
  if(r!=r_ya && r<350 ){ ++serrs;printf ("%s(%g): sprintf() returns %d ya_sprintf() returns %d\n",x,PAR,r,r_ya);}
  if(*x=='%' && !(strtod(buf,NULL)==strtod(buf_ya,NULL)|| (isnan(strtod(buf,NULL)) && isnan(strtod(buf,NULL))) || (isinf(strtod(buf,NULL)) && isinf(strtod(buf,NULL))) )) {++serrs;printf("%s(%g):[strtod()] sprintf() gives %s ya_sprintf() gives %s\n",x,PAR,buf,buf_ya);}; 
 	// snprintf(5)
@@ -1235,6 +1583,7 @@ void check_str_p(char *x,void * PAR)
 	// basic check sprintf
  r=sprintf(buf,x,PAR);
  r_ya=ya_s_sprintf(buf_ya,x,PAR);
+ check_prog(x,buf_ya,r_ya,PAR);
  if(r!=r_ya){ ++serrs;printf ("%s(%p): sprintf() returns %d ya_sprintf() returns %d\n",x,PAR,r,r_ya);}
  if(strcmp(buf,buf_ya)) {++serrs;printf("%s(%p): sprintf() gives %s ya_sprintf() gives %s\n",x,PAR,buf,buf_ya);};
 	// snprintf(5)
@@ -1257,6 +1606,713 @@ void check_str_p(char *x,void * PAR)
  if(strcmp(buf,buf_ya)) {++serrs;printf("%s(%p): snprintf(10) gives %s ya_snprintf(10) gives %s\n",x,PAR,buf,buf_ya);};	
 }
 
+#if defined(PART2_SPRINTF_TESTS) && defined(YA_SP_SPRINTF_IMPLEMENTATION) && defined(__GNUC__)
+#define STACK_PAINT_SIZE 65536 /* bytes of stack painted below the caller of stack_used() */
+#if defined(__SANITIZE_ADDRESS__) || !defined(__OPTIMIZE__)
+#define STACK_LIMIT 16384 /* sanitizers and -O0 give much bigger stack frames, so only check the stack use does not run away */
+#elif defined(YA_S__EXACT)
+#define STACK_LIMIT 3584 /* most stack ya_s_sprintf() and ya_s_snprintf() may use, measured 3480 bytes for %.31Le via ya_s_snprintf() (uses ya_s__exact_cmp()) */
+#elif defined(YA_SP_SPRINTF_LD)
+#define STACK_LIMIT 1920 /* measured 1856 bytes for %'Lf via ya_s_snprintf() */
+#else
+#define STACK_LIMIT 1664 /* measured 1560 bytes for %'f via ya_s_snprintf() */
+#endif
+static uintptr_t stack_painted; /* lowest address painted by paint_stack() */
+__attribute__((noinline)) static void paint_stack(void) /* fill the stack below the caller with a known value */
+{volatile char a[STACK_PAINT_SIZE];
+ for(int i=0;i<STACK_PAINT_SIZE;++i)
+	a[i]=(char)0xa5;
+ stack_painted=(uintptr_t)a;
+}
+
+static char stack_buf[20000]; /* output of the worst case conversions below */
+static size_t stack_used(int (*fn)(const char *,void *),const char *fmt,void *v) /* returns bytes of stack used by fn() */
+{size_t i;
+ paint_stack();
+ fn(fmt,v);
+ for(i=0;i<STACK_PAINT_SIZE && ((volatile char *)stack_painted)[i]==(char)0xa5;++i); /* find the deepest byte fn() changed */
+ return STACK_PAINT_SIZE-i;
+}
+
+#ifdef YA_SP_SPRINTF_LD
+__attribute__((noinline)) static int stack_ld(const char *fmt,void *v) { return ya_s_sprintf(stack_buf,fmt,*(long double *)v); }
+__attribute__((noinline)) static int stack_ld_sn(const char *fmt,void *v) { return ya_s_snprintf(stack_buf,100,fmt,*(long double *)v); }
+#endif
+__attribute__((noinline)) static int stack_d(const char *fmt,void *v) { return ya_s_sprintf(stack_buf,fmt,*(double *)v); }
+__attribute__((noinline)) static int stack_d_sn(const char *fmt,void *v) { return ya_s_snprintf(stack_buf,100,fmt,*(double *)v); }
+__attribute__((noinline)) static int stack_u64(const char *fmt,void *v) { return ya_s_sprintf(stack_buf,fmt,*(uint64_t *)v); }
+#ifdef YA_SP_SPRINTF_Q
+__attribute__((noinline)) static int stack_q(const char *fmt,void *v) { return ya_s_sprintf(stack_buf,fmt,*(__float128 *)v); }
+__attribute__((noinline)) static int stack_i128(const char *fmt,void *v) { return ya_s_sprintf(stack_buf,fmt,*(__uint128_t *)v); }
+#endif
+#endif
+
+#if defined(PART2_SPRINTF_TESTS) && defined(YA_SP_SPRINTF_IMPLEMENTATION) && defined(__GLIBC__)
+typedef struct {ssize_t (*read)(void *,char *,size_t); ssize_t (*write)(void *,const char *,size_t); int (*seek)(void *,int64_t *,int); int (*close)(void *);} nest_cookie_fns; /* glibc's cookie_io_functions_t, only declared by <stdio.h> with _GNU_SOURCE */
+extern FILE *fopencookie(void *cookie,const char *mode,nest_cookie_fns fns);
+static char nest_got[4000]; /* what the stream given to ya_s_fprintf() was asked to write */
+static int nest_len,nest_fd;
+static FILE *nest_fp;
+static ssize_t nest_write(void *cookie,const char *p,size_t n) /* write hook of that stream: prints from inside ya_s_fprintf() before saving p, which points into ya_s_fprintf()'s buffer */
+{(void)cookie;
+ ya_s_dprintf(nest_fd,"write of %d chars %0700d\n",(int)n,7); /* longer than YA_SP_SPRINTF_MIN so the nested calls fill their buffers more than once */
+ ya_s_fprintf(nest_fp,"write of %d chars %0700d\n",(int)n,8);
+ if(nest_len+n>sizeof(nest_got)) return -1;
+ memcpy(nest_got+nest_len,p,n);
+ nest_len+=(int)n;
+ return (ssize_t)n;
+}
+#endif
+
+#if defined(PART3_SPRINTF_BENCHMARKS) && defined(YA_SP_SPRINTF_IMPLEMENTATION)
+#define BENCH_LOOPS 1000000 /* number of calls made for each benchmark */
+static uint64_t bench_ns(void) /* wall clock time in ns, from hr_timer.c if it is in use (which reads the TSC if compiled with -DHR_TIMER_TSC) */
+{
+#ifdef USE_HR_TIMER
+ return read_HR_Timer_ns();
+#else
+ struct timespec ts;
+ timespec_get(&ts,TIME_UTC);
+ return (uint64_t)ts.tv_sec*1000000000u+ts.tv_nsec;
+#endif
+}
+
+static double bench_now(void) /* the same in secs */
+{
+ return (double)bench_ns()*1e-9;
+}
+
+static void bench_compiled_print(const char *name,double t_parse,double t_cached,double t_exec,uint64_t len) /* times in secs for BENCH_LOOPS calls, t_cached<0 if there is no format cache */
+{
+ printf(" %s: ya_s_sprintf() %.1f ns/call",name,t_parse*1e9/BENCH_LOOPS);
+ if(t_cached>=0) printf(" parsing the format, %.1f ns/call with the format cache",t_cached*1e9/BENCH_LOOPS);
+ printf(", ya_s_exec() %.1f ns/call (%.2fx) [%" PRIu64 " chars]\n",t_exec*1e9/BENCH_LOOPS,t_parse/t_exec,len);
+}
+
+static void bench_compiled_format(void) /* compare a typical log line formatted by ya_s_sprintf() (parsing the format each time, and with the format cache if there is one) and by a precompiled program */
+{
+ static char buf[256];
+ static ya_s_format_program prog;
+ const char *fmt="[%s] %-8s thread %4d: request %" PRIu64 " took %6.3f ms (%d bytes) status=0x%08x\n";
+ const char *kv="%s=%d %s=%d %s=%d %s=%d\n";
+ double start;
+ double t_parse,t_cached=-1,t_exec;
+ uint64_t len=0;
+ ya_s_compile_format(&prog,fmt);
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len+=ya_s_sprintf(buf,fmt,"12:34:56","INFO",i&1023,(uint64_t)i*12345,i*0.001,i&65535,i);
+ t_parse=bench_now()-start;
+#ifdef YA_SP_FORMAT_CACHE
+ t_cached=t_parse;
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len+=nocache_sprintf(buf,fmt,"12:34:56","INFO",i&1023,(uint64_t)i*12345,i*0.001,i&65535,i);
+ t_parse=bench_now()-start;
+#endif
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len+=exec_sprintf(buf,&prog,"12:34:56","INFO",i&1023,(uint64_t)i*12345,i*0.001,i&65535,i);
+ t_exec=bench_now()-start;
+ bench_compiled_print("log line",t_parse,t_cached,t_exec,len);
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len+=ya_s_sprintf(buf,kv,"a",i,"b",i+1,"c",i+2,"d",i+3);
+ t_parse=bench_now()-start;
+#ifdef YA_SP_FORMAT_CACHE
+ t_cached=t_parse;
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len+=nocache_sprintf(buf,kv,"a",i,"b",i+1,"c",i+2,"d",i+3);
+ t_parse=bench_now()-start;
+#endif
+ ya_s_compile_format(&prog,kv);
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len+=exec_sprintf(buf,&prog,"a",i,"b",i+1,"c",i+2,"d",i+3);
+ t_exec=bench_now()-start;
+ bench_compiled_print("key=value",t_parse,t_cached,t_exec,len);
+#ifdef YA_SP_FORMAT_CACHE_STATS
+ {/* with the cache ya_s_sprintf() should be about the same speed as ya_s_exec() */
+  unsigned long long hits,misses;
+  ya_s_format_cache_stats(&hits,&misses);
+  printf(" format cache: %llu hits %llu misses\n",hits,misses);
+ }
+#endif
+}
+
+static void bench_format_length(void) /* sizing the output of a log line with ya_s_format_length() and with ya_s_snprintf(NULL,0,...) */
+{
+ const char *fmts[]={"[%s] %-8s thread %4d: request %" PRIu64 " status=0x%08x %s\n","[%s] %-8s thread %4d: request %" PRIu64 " took %6.3f ms\n"};
+ double start;
+ double t_sn,t_len;
+ uint64_t len=0;
+ for(int f=0;f<2;++f)
+	{start=bench_now();
+	 for(int i=0;i<BENCH_LOOPS;++i)
+		{if(f==0) len+=ya_s_snprintf(NULL,0,fmts[f],"12:34:56","INFO",i&1023,(uint64_t)i*12345,i,"GET /index.html");
+		 else len+=ya_s_snprintf(NULL,0,fmts[f],"12:34:56","INFO",i&1023,(uint64_t)i*12345,i*0.001);
+		}
+	 t_sn=bench_now()-start;
+	 start=bench_now();
+	 for(int i=0;i<BENCH_LOOPS;++i)
+		{if(f==0) len-=ya_s_format_length(fmts[f],"12:34:56","INFO",i&1023,(uint64_t)i*12345,i,"GET /index.html");
+		 else len-=ya_s_format_length(fmts[f],"12:34:56","INFO",i&1023,(uint64_t)i*12345,i*0.001);
+		}
+	 t_len=bench_now()-start;
+	 printf(" length of a log line %s: ya_s_snprintf(NULL,0) %.1f ns/call, ya_s_format_length() %.1f ns/call (%.2fx)%s\n",f?"with %f":"of ints and strings",t_sn*1e9/BENCH_LOOPS,t_len*1e9/BENCH_LOOPS,t_sn/t_len,len?" LENGTHS DIFFER":"");
+	}
+}
+
+static int bench_two_call(char **strp,const char *fmt,...) /* the usual way to get an allocated string: measure, malloc() and format again */
+{
+ int n;
+ va_list va,vb;
+ va_start(va,fmt);
+ va_copy(vb,va);
+ n=ya_s_vsnprintf(NULL,0,fmt,va);
+ *strp=malloc(n+1);
+ ya_s_vsnprintf(*strp,n+1,fmt,vb);
+ va_end(vb);
+ va_end(va);
+ return n;
+}
+
+#ifdef __GLIBC__
+extern int vasprintf(char **strp,const char *fmt,va_list va); /* only declared by <stdio.h> with _GNU_SOURCE */
+static int bench_glibc_asprintf(char **strp,const char *fmt,...)
+{
+ int n;
+ va_list va;
+ va_start(va,fmt);
+ n=vasprintf(strp,fmt,va);
+ va_end(va);
+ return n;
+}
+#endif
+
+static void bench_asprintf(void) /* allocated strings from ya_s_asprintf(), the two call vsnprintf() idiom, glibc asprintf() and a bump arena */
+{
+ static char big[4000],mem[1<<20];
+ const char *fmts[]={"[%s] %-8s thread %4d: request %" PRIu64 " took %6.3f ms %.*s\n","[%s] %-8s thread %4d: request %" PRIu64 " took %6.3f ms %.*s\n"};
+ int lens[]={0,sizeof(big)-1};
+ ya_s_bump bump;
+ ya_s_arena arena={ya_s_bump_grow,&bump};
+ double start;
+ double t_two,t_as,t_arena,t_glibc=0;
+ char *str;
+ memset(big,'a',sizeof(big)-1);
+ ya_s_bump_init(&bump,mem,sizeof(mem));
+ for(int f=0;f<2;++f)
+	{start=bench_now();
+	 for(int i=0;i<BENCH_LOOPS/2;++i)
+		{bench_two_call(&str,fmts[f],"12:34:56","INFO",i&1023,(uint64_t)i*12345,i*0.001,lens[f],big);
+		 free(str);
+		}
+	 t_two=(bench_now()-start)*2;
+	 start=bench_now();
+	 for(int i=0;i<BENCH_LOOPS/2;++i)
+		{ya_s_asprintf(&str,fmts[f],"12:34:56","INFO",i&1023,(uint64_t)i*12345,i*0.001,lens[f],big);
+		 free(str);
+		}
+	 t_as=(bench_now()-start)*2;
+#ifdef __GLIBC__
+	 start=bench_now();
+	 for(int i=0;i<BENCH_LOOPS/2;++i)
+		{bench_glibc_asprintf(&str,fmts[f],"12:34:56","INFO",i&1023,(uint64_t)i*12345,i*0.001,lens[f],big);
+		 free(str);
+		}
+	 t_glibc=(bench_now()-start)*2;
+#endif
+	 start=bench_now();
+	 for(int i=0;i<BENCH_LOOPS/2;++i)
+		{if(ya_s_asprintf_arena(&arena,&str,fmts[f],"12:34:56","INFO",i&1023,(uint64_t)i*12345,i*0.001,lens[f],big)<0)
+			{ya_s_bump_reset(&bump); /* arena full, free every string in it at once */
+			 ya_s_asprintf_arena(&arena,&str,fmts[f],"12:34:56","INFO",i&1023,(uint64_t)i*12345,i*0.001,lens[f],big);
+			}
+		}
+	 t_arena=(bench_now()-start)*2;
+	 printf(" %s: vsnprintf() twice + malloc() %.1f ns/call, ya_s_asprintf() %.1f ns/call (%.2fx), asprintf() %.1f ns/call, ya_s_asprintf_arena() %.1f ns/call\n",
+		f?"asprintf() of a 4KB line":"asprintf() of a log line",t_two*1e9/BENCH_LOOPS,t_as*1e9/BENCH_LOOPS,t_two/t_as,t_glibc*1e9/BENCH_LOOPS,t_arena*1e9/BENCH_LOOPS);
+	}
+}
+
+#if defined(YA_SP_LOG) && !defined(_WIN32)
+static volatile int bench_log_stop;
+static long long bench_log_chars;
+static char *bench_log_reserve(void *user,int want,int *avail)
+{static char buf[4096];
+ (void)user;
+ (void)want;
+ *avail=sizeof(buf);
+ return buf;
+}
+static void bench_log_commit(void *user,int len)
+{(void)user;
+ bench_log_chars+=len;
+}
+static void *bench_log_consumer(void *arg) /* the background thread that formats the records */
+{ya_s_sink sink={bench_log_reserve,bench_log_commit,NULL,NULL};
+ long long *records=(long long *)arg;
+ for(;;)
+	{int n=ya_s_log_drain(&sink);
+	 *records+=n;
+	 if(n==0)
+		{if(bench_log_stop) break;
+		 usleep(50);
+		}
+	}
+ *records+=ya_s_log_drain(&sink);
+ return NULL;
+}
+static int bench_cmp_u32(const void *a,const void *b)
+{uint32_t x=*(const uint32_t *)a,y=*(const uint32_t *)b;
+ return (x>y)-(x<y);
+}
+static void bench_percentiles(const char *name,uint32_t *lat,int n) /* print p50, p99 and p99.9 of lat[0..n-1] (which is sorted) */
+{qsort(lat,n,sizeof(lat[0]),bench_cmp_u32);
+ printf(" %s: p50 %u ns, p99 %u ns, p99.9 %u ns\n",name,lat[n/2],lat[(int)(n*0.99)],lat[(int)(n*0.999)]);
+}
+
+static void bench_log(void) /* latency seen by the caller of ya_s_log() (with formatting on another thread) and of ya_s_snprintf() for a log line */
+{
+ static ya_s_log_ring ring;
+ static char ring_mem[1<<24],buf[256];
+ static uint32_t lat[BENCH_LOOPS/4];
+ const char *fmt="[%s] %-8s thread %4d: request %" PRIu64 " took %6.3f ms\n";
+ const int n=BENCH_LOOPS/4; /* a burst of log lines that fits in the ring, even if the background thread gets no cpu time until the end */
+ long long records=0,expect=0;
+ pthread_t consumer;
+ uint64_t t0,t1,start,total;
+ memset(ring_mem,0,sizeof(ring_mem)); /* so the first touch of each page is not timed */
+ ya_s_log_ring_init(&ring,ring_mem,sizeof(ring_mem));
+ ya_s_log_attach(&ring);
+ bench_log_stop=0;
+ bench_log_chars=0;
+ pthread_create(&consumer,NULL,bench_log_consumer,&records);
+ start=bench_ns();
+ for(int i=0;i<n;++i)
+	{t0=bench_ns();
+	 ya_s_log(fmt,"12:34:56","INFO",i&1023,(uint64_t)i*12345,i*0.001);
+	 t1=bench_ns();
+	 lat[i]=(uint32_t)(t1-t0);
+	}
+ total=bench_ns()-start;
+ bench_log_stop=1;
+ pthread_join(consumer,NULL);
+ printf(" ya_s_log() of a log line: %.1f ns/call (with 2 timer reads), %lld records formatted on a background thread, %u dropped\n",(double)total/n,records,ring.dropped);
+ bench_percentiles("ya_s_log() latency",lat,n);
+ for(int i=0;i<n;++i)
+	expect+=ya_s_format_length(fmt,"12:34:56","INFO",i&1023,(uint64_t)i*12345,i*0.001);
+ if(ring.dropped==0 && bench_log_chars!=expect) printf(" ya_s_log(): background thread formatted %lld chars, expected %lld\n",bench_log_chars,expect);
+ for(int i=0;i<n;++i)
+	{t0=bench_ns();
+	 ya_s_snprintf(buf,sizeof(buf),fmt,"12:34:56","INFO",i&1023,(uint64_t)i*12345,i*0.001);
+	 t1=bench_ns();
+	 lat[i]=(uint32_t)(t1-t0);
+	}
+ bench_percentiles("ya_s_snprintf() latency",lat,n);
+ for(int i=0;i<n;++i)
+	{t0=bench_ns();
+	 t1=bench_ns();
+	 lat[i]=(uint32_t)(t1-t0);
+	}
+ bench_percentiles("timer read overhead",lat,n);
+ ya_s_log_attach(NULL);
+}
+#endif
+
+static void bench_literals(void) /* a JSON log line which is mostly literal text, compared with the C library sprintf() */
+{
+ static char buf[512];
+ const char *fmt="{\"timestamp\":\"%s\",\"level\":\"%s\",\"component\":\"request-handler\",\"message\":\"request completed successfully\",\"latency_us\":%d,\"status\":%d}\n";
+ double start;
+ double t_c,t_ya;
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	sprintf(buf,fmt,"2020-06-01T12:34:56Z","INFO",i&4095,200);
+ t_c=bench_now()-start;
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	ya_s_sprintf(buf,fmt,"2020-06-01T12:34:56Z","INFO",i&4095,200);
+ t_ya=bench_now()-start;
+ printf(" JSON log line: sprintf() %.1f ns/call, ya_s_sprintf() %.1f ns/call (%.2fx)\n",t_c*1e9/BENCH_LOOPS,t_ya*1e9/BENCH_LOOPS,t_c/t_ya);
+}
+
+static void bench_padding(void) /* wide fields and long strings compared with the C library sprintf() */
+{
+ static char buf[8192],str[5000];
+ const char *fmts[]={"%01000d","%'01000d","%-1000s|","%.*s"};
+ double start;
+ double t_c,t_ya;
+ memset(str,'a',sizeof(str)-1);
+ for(int f=0;f<4;++f)
+	{start=bench_now();
+	 for(int i=0;i<BENCH_LOOPS/10;++i)
+		{if(f<2) sprintf(buf,fmts[f],i);
+		 else if(f==2) sprintf(buf,fmts[f],"abc");
+		 else sprintf(buf,fmts[f],i&63,str); /* only the first few chars of a long string */
+		}
+	 t_c=(bench_now()-start)*10;
+	 start=bench_now();
+	 for(int i=0;i<BENCH_LOOPS/10;++i)
+		{if(f<2) ya_s_sprintf(buf,fmts[f],i);
+		 else if(f==2) ya_s_sprintf(buf,fmts[f],"abc");
+		 else ya_s_sprintf(buf,fmts[f],i&63,str);
+		}
+	 t_ya=(bench_now()-start)*10;
+	 printf(" padding: %s sprintf() %.1f ns/call, ya_s_sprintf() %.1f ns/call (%.2fx)\n",fmts[f],t_c*1e9/BENCH_LOOPS,t_ya*1e9/BENCH_LOOPS,t_c/t_ya);
+	}
+}
+
+static void bench_integers(void) /* compare %d, %llu and %I128u with the C library sprintf() */
+{
+ static char buf[64];
+ static uint64_t v[1024];
+ double start;
+ double t_c,t_ya;
+ uint64_t len=0;
+ for(int i=0;i<1024;++i)
+	v[i]=randu64()>>(randu64()%64); /* random number of digits */
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len+=sprintf(buf,"%d",(int)v[i&1023]);
+ t_c=bench_now()-start;
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len+=ya_s_sprintf(buf,"%d",(int)v[i&1023]);
+ t_ya=bench_now()-start;
+ printf(" %%d: sprintf() %.1f ns/call, ya_s_sprintf() %.1f ns/call (%.2fx)\n",t_c*1e9/BENCH_LOOPS,t_ya*1e9/BENCH_LOOPS,t_c/t_ya);
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len+=sprintf(buf,"%llu",(unsigned long long)v[i&1023]);
+ t_c=bench_now()-start;
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len+=ya_s_sprintf(buf,"%llu",(unsigned long long)v[i&1023]);
+ t_ya=bench_now()-start;
+ printf(" %%llu: sprintf() %.1f ns/call, ya_s_sprintf() %.1f ns/call (%.2fx) [%" PRIu64 " chars]\n",t_c*1e9/BENCH_LOOPS,t_ya*1e9/BENCH_LOOPS,t_c/t_ya,len);
+ /* %08llu is written directly to the output, %.8llu gives the same result but goes via the staging buffer */
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len+=ya_s_sprintf(buf,"%.8llu",(unsigned long long)(v[i&1023]>>32));
+ t_c=bench_now()-start;
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len+=ya_s_sprintf(buf,"%08llu",(unsigned long long)(v[i&1023]>>32));
+ t_ya=bench_now()-start;
+ printf(" %%.8llu (staged) %.1f ns/call, %%08llu (direct) %.1f ns/call (%.2fx)\n",t_c*1e9/BENCH_LOOPS,t_ya*1e9/BENCH_LOOPS,t_c/t_ya);
+#ifdef YA_SP_SPRINTF_Q
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len+=sprint_uint128_decimal(buf,((uint128_t)v[i&1023]<<64)|v[(i+1)&1023]);
+ t_c=bench_now()-start;
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len+=ya_s_sprintf(buf,"%Qu",((uint128_t)v[i&1023]<<64)|v[(i+1)&1023]);
+ t_ya=bench_now()-start;
+ printf(" %%Qu: sprint_uint128_decimal() %.1f ns/call, ya_s_sprintf() %.1f ns/call (%.2fx) [%" PRIu64 " chars]\n",t_c*1e9/BENCH_LOOPS,t_ya*1e9/BENCH_LOOPS,t_c/t_ya,len);
+#endif
+}
+
+static void bench_shortest(void) /* compare %r with %.17g (which also always round trips) */
+{
+ static char buf[64];
+ static double d[1024];
+ double start;
+ double t_17g,t_r;
+ uint64_t len17=0,lenr=0;
+ for(int i=0;i<1024;++i)
+	d[i]=(double)randu64()/(double)UINT64_MAX*pow(10,(int)(randu64()%40)-20); /* random doubles with a range of exponents */
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len17+=ya_s_sprintf(buf,"%.17g",d[i&1023]);
+ t_17g=bench_now()-start;
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	lenr+=ya_s_sprintf(buf,"%r",d[i&1023]);
+ t_r=bench_now()-start;
+ printf(" random doubles: %%.17g %.1f ns/call (%.1f chars), %%r %.1f ns/call (%.1f chars) (%.2fx)\n",t_17g*1e9/BENCH_LOOPS,(double)len17/BENCH_LOOPS,t_r*1e9/BENCH_LOOPS,(double)lenr/BENCH_LOOPS,t_17g/t_r);
+ for(int i=0;i<1024;++i)
+	d[i]=(double)(randu64()%1000000)/100.0; /* typical "metrics" with 2 decimal places */
+ len17=lenr=0;
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	len17+=ya_s_sprintf(buf,"%.17g",d[i&1023]);
+ t_17g=bench_now()-start;
+ start=bench_now();
+ for(int i=0;i<BENCH_LOOPS;++i)
+	lenr+=ya_s_sprintf(buf,"%r",d[i&1023]);
+ t_r=bench_now()-start;
+ printf(" 2dp decimals: %%.17g %.1f ns/call (%.1f chars), %%r %.1f ns/call (%.1f chars) (%.2fx)\n",t_17g*1e9/BENCH_LOOPS,(double)len17/BENCH_LOOPS,t_r*1e9/BENCH_LOOPS,(double)lenr/BENCH_LOOPS,t_17g/t_r);
+}
+
+static void bench_doubles(void) /* compare %e, %g and %f of doubles with the C library sprintf() (with YA_SP_SPRINTF_LD these go through the long double conversion) */
+{
+ static char buf[512];
+ static double d[1024];
+ const char *fmts[]={"%e","%g","%.3f","%.17g"};
+ double start;
+ double t_c,t_ya;
+ for(int i=0;i<1024;++i)
+	d[i]=(double)randu64()/(double)UINT64_MAX*pow(10,(int)(randu64()%40)-20); /* random doubles with a range of exponents */
+ for(int f=0;f<4;++f)
+	{start=bench_now();
+	 for(int i=0;i<BENCH_LOOPS;++i)
+		sprintf(buf,fmts[f],d[i&1023]);
+	 t_c=bench_now()-start;
+	 start=bench_now();
+	 for(int i=0;i<BENCH_LOOPS;++i)
+		ya_s_sprintf(buf,fmts[f],d[i&1023]);
+	 t_ya=bench_now()-start;
+	 printf(" random doubles: %s sprintf() %.1f ns/call, ya_s_sprintf() %.1f ns/call (%.2fx)\n",fmts[f],t_c*1e9/BENCH_LOOPS,t_ya*1e9/BENCH_LOOPS,t_c/t_ya);
+	}
+}
+
+#define COLD_LOOPS 2000 /* number of calls made for each cold cache benchmark */
+static unsigned char cold_junk[8<<20]; /* larger than the last level cache */
+static void bench_evict(void) /* touch every cache line of cold_junk[] so the tables used by the conversions are no longer in the cache */
+{
+ volatile unsigned char *p=cold_junk;
+ for(size_t i=0;i<sizeof cold_junk;i+=64)
+	++p[i];
+}
+
+static void bench_cold_cache(void) /* %e of doubles (and long doubles) over the whole exponent range with the cache flushed before every call, as for an occasional log line */
+{
+ static char buf[512];
+ static double d[256];
+ double t,t_c=0,t_ya=0;
+ for(int i=0;i<256;++i)
+	d[i]=(double)randu64()/(double)UINT64_MAX*pow(10,(int)(randu64()%600)-300); /* random doubles with exponents from -300 to +300 */
+ for(int i=0;i<COLD_LOOPS;++i)
+	{bench_evict();
+	 t=bench_now();
+	 sprintf(buf,"%.17e",d[i&255]);
+	 t_c+=bench_now()-t;
+	 bench_evict();
+	 t=bench_now();
+	 ya_s_sprintf(buf,"%.17e",d[i&255]);
+	 t_ya+=bench_now()-t;
+	}
+ printf(" cold cache doubles: %%.17e sprintf() %.0f ns/call, ya_s_sprintf() %.0f ns/call (%.2fx)\n",t_c*1e9/COLD_LOOPS,t_ya*1e9/COLD_LOOPS,t_c/t_ya);
+#ifdef YA_SP_SPRINTF_LD
+ {static long double ld[256];
+  for(int i=0;i<256;++i)
+	ld[i]=(long double)randu64()/(long double)UINT64_MAX*powl(10,(int)(randu64()%9800)-4900); /* random long doubles with exponents from -4900 to +4900 */
+  t_c=t_ya=0;
+  for(int i=0;i<COLD_LOOPS;++i)
+	{bench_evict();
+	 t=bench_now();
+	 sprintf(buf,"%.20Le",ld[i&255]);
+	 t_c+=bench_now()-t;
+	 bench_evict();
+	 t=bench_now();
+	 ya_s_sprintf(buf,"%.20Le",ld[i&255]);
+	 t_ya+=bench_now()-t;
+	}
+  printf(" cold cache long doubles: %%.20Le sprintf() %.0f ns/call, ya_s_sprintf() %.0f ns/call (%.2fx)\n",t_c*1e9/COLD_LOOPS,t_ya*1e9/COLD_LOOPS,t_c/t_ya);
+ }
+#endif
+}
+
+#ifndef _WIN32
+static void bench_fd(void) /* throughput of log lines written by ya_s_fprintf(), ya_s_dprintf() and ya_s_bprintf() to /dev/null and to a tmpfs file */
+{
+ static char dbuf[65536];
+ const char *names[]={"/dev/null","/dev/shm/ya_sprintf_bench.txt"};
+ const char *fmt="%s [%5d] request %d took %.3f ms status=0x%08x\n";
+ const int loops=BENCH_LOOPS/2,block=5000; /* the 3 functions take turns writing a block of lines, so changes in the speed of the machine affect them all equally */
+ for(int f=0;f<2;++f)
+	{double t_f=0,t_d=0,t_b=0,t;
+	 uint64_t len=0;
+	 FILE *fp=fopen(names[f],"w");
+	 int fd=open(names[f],O_WRONLY|O_CREAT|O_TRUNC,0644);
+	 ya_s_dbuf b;
+	 if(fp==NULL || fd<0)
+		{printf(" %s: cannot open, skipped\n",names[f]);
+		 if(fp) fclose(fp);
+		 if(fd>=0) close(fd);
+		 continue;
+		}
+	 ya_s_dbuf_init(&b,fd,dbuf,sizeof(dbuf));
+	 for(int i=0;i<loops;i+=block)
+		{t=bench_now();
+		 for(int j=i;j<i+block;++j)
+			len+=ya_s_fprintf(fp,fmt,"12:34:56.789",j&16383,j,j*0.001,j&65535);
+		 fflush(fp);
+		 t_f+=bench_now()-t;
+		 t=bench_now();
+		 for(int j=i;j<i+block;++j)
+			ya_s_dprintf(fd,fmt,"12:34:56.789",j&16383,j,j*0.001,j&65535);
+		 t_d+=bench_now()-t;
+		 t=bench_now();
+		 for(int j=i;j<i+block;++j)
+			ya_s_bprintf(&b,fmt,"12:34:56.789",j&16383,j,j*0.001,j&65535);
+		 ya_s_dbuf_flush(&b);
+		 t_b+=bench_now()-t;
+		}
+	 printf(" %s: ya_s_fprintf() %.1f ns/line, ya_s_dprintf() %.1f ns/line, ya_s_bprintf() (64KB batches) %.1f ns/line (%.0f MB/s)\n",names[f],t_f*1e9/loops,t_d*1e9/loops,t_b*1e9/loops,len/t_b*1e-6);
+	 fclose(fp);
+	 close(fd);
+	 if(f) remove(names[f]);
+	}
+}
+#endif
+
+static char *bench_fwrite_cb(const char *buf,void *user,int len) /* ya_s_vsprintfcb_ex() callback for bulk export to a file */
+{
+ fwrite(buf,1,len,(FILE *)user);
+ return (char *)buf;
+}
+
+static int bench_cb_ex(FILE *fp,char *buf,int buflen,const char *fmt,...)
+{
+ int r;
+ va_list va;
+ va_start(va,fmt);
+ r=ya_s_vsprintfcb_ex(bench_fwrite_cb,fp,buf,buflen,fmt,va);
+ va_end(va);
+ return r;
+}
+
+static void bench_chunk_size(void) /* throughput of 1MB %s and %0*d conversions written to a file with ya_s_vsprintfcb_ex() against the callback buffer size */
+{
+ static char buf[65536],str[1<<20];
+ const int sizes[]={64,256,512,4096,16384,65536};
+ const int loops=100;
+ FILE *fp=fopen(
+#ifdef _WIN32
+	"NUL",
+#else
+	"/dev/null",
+#endif
+	"wb");
+ if(fp==NULL) return;
+ memset(str,'s',sizeof(str)-1);
+ for(int i=0;i<(int)nos_elements_in(sizes);++i)
+	{double t_s,t_d,t;
+	 t=bench_now();
+	 for(int j=0;j<loops;++j)
+		bench_cb_ex(fp,buf,sizes[i],"%s",str);
+	 t_s=bench_now()-t;
+	 t=bench_now();
+	 for(int j=0;j<loops;++j)
+		bench_cb_ex(fp,buf,sizes[i],"%0*d",(int)sizeof(str)-1,j);
+	 t_d=bench_now()-t;
+	 printf(" ya_s_vsprintfcb_ex() %5d byte chunks: %%s %.0f MB/s, %%0*d %.0f MB/s\n",sizes[i],loops*(sizeof(str)-1)/t_s*1e-6,loops*(sizeof(str)-1)/t_d*1e-6);
+	}
+ fclose(fp);
+}
+
+#ifdef YA_SP_MPSC
+static FILE *bench_mpsc_fp;
+static ya_s_mpsc bench_ring;
+static int bench_mpsc_lines,bench_mpsc_running;
+static void *bench_mpsc_fprintf(void *arg) /* a thread writing its share of the log lines to a shared FILE */
+{(void)arg;
+ for(int i=0;i<bench_mpsc_lines;++i)
+	ya_s_fprintf(bench_mpsc_fp,"%s [%5d] request %d took %.3f ms status=0x%08x\n","12:34:56.789",i&16383,i,i*0.001,i&65535);
+ return NULL;
+}
+static void *bench_mpsc_printf(void *arg) /* the same lines to the shared ring */
+{(void)arg;
+ for(int i=0;i<bench_mpsc_lines;++i)
+	ya_s_mpsc_printf(&bench_ring,"%s [%5d] request %d took %.3f ms status=0x%08x\n","12:34:56.789",i&16383,i,i*0.001,i&65535);
+ return NULL;
+}
+static void *bench_mpsc_writer(void *arg) /* the thread writing the ring out */
+{(void)arg;
+ while(__atomic_load_n(&bench_mpsc_running,__ATOMIC_ACQUIRE))
+	if(ya_s_mpsc_write(&bench_ring)==0) usleep(20);
+ ya_s_mpsc_write(&bench_ring);
+ return NULL;
+}
+static void bench_mpsc(void) /* 1 to 64 threads writing log lines to /dev/null through one FILE with ya_s_fprintf() and through one ya_s_mpsc ring */
+{
+ static char ring_mem[1<<20];
+ static pthread_t th[64];
+ pthread_t writer;
+ int fd=open("/dev/null",O_WRONLY);
+ bench_mpsc_fp=fopen("/dev/null","w");
+ if(fd<0 || bench_mpsc_fp==NULL)
+	{printf(" /dev/null: cannot open, skipped\n");
+	 if(fd>=0) close(fd);
+	 if(bench_mpsc_fp) fclose(bench_mpsc_fp);
+	 return;
+	}
+ for(int n=1;n<=64;n*=2)
+	{double t,t_f,t_r;
+	 bench_mpsc_lines=BENCH_LOOPS/2/n;
+	 t=bench_now();
+	 for(int i=0;i<n;++i) pthread_create(&th[i],NULL,bench_mpsc_fprintf,NULL);
+	 for(int i=0;i<n;++i) pthread_join(th[i],NULL);
+	 fflush(bench_mpsc_fp);
+	 t_f=bench_now()-t;
+	 ya_s_mpsc_init(&bench_ring,fd,ring_mem,sizeof(ring_mem));
+	 bench_mpsc_running=1;
+	 t=bench_now();
+	 pthread_create(&writer,NULL,bench_mpsc_writer,NULL);
+	 for(int i=0;i<n;++i) pthread_create(&th[i],NULL,bench_mpsc_printf,NULL);
+	 for(int i=0;i<n;++i) pthread_join(th[i],NULL);
+	 __atomic_store_n(&bench_mpsc_running,0,__ATOMIC_RELEASE);
+	 pthread_join(writer,NULL);
+	 t_r=bench_now()-t;
+	 printf(" %2d threads: ya_s_fprintf() to a shared FILE %.1f ns/line, ya_s_mpsc_printf() to a shared ring %.1f ns/line (%.2fx)\n",n,t_f*1e9/(bench_mpsc_lines*n),t_r*1e9/(bench_mpsc_lines*n),t_f/t_r);
+	}
+ fclose(bench_mpsc_fp);
+ close(fd);
+}
+#endif
+
+#ifdef YA_SP_SPRINTF_LD
+static void bench_long_double(void) /* compare %Le, %Lg and %Lf with the C library sprintf() */
+{
+ static char buf[512];
+ static long double d[1024];
+ const char *fmts[]={"%.20Le","%Lg","%.3Lf"};
+ double start;
+ double t_c,t_ya;
+ for(int i=0;i<1024;++i)
+	d[i]=(long double)randu64()/(long double)UINT64_MAX*powl(10,(int)(randu64()%60)-30); /* random long doubles with a range of exponents */
+ for(int f=0;f<3;++f)
+	{start=bench_now();
+	 for(int i=0;i<BENCH_LOOPS;++i)
+		sprintf(buf,fmts[f],d[i&1023]);
+	 t_c=bench_now()-start;
+	 start=bench_now();
+	 for(int i=0;i<BENCH_LOOPS;++i)
+		ya_s_sprintf(buf,fmts[f],d[i&1023]);
+	 t_ya=bench_now()-start;
+	 printf(" random long doubles: %s sprintf() %.1f ns/call, ya_s_sprintf() %.1f ns/call (%.2fx)\n",fmts[f],t_c*1e9/BENCH_LOOPS,t_ya*1e9/BENCH_LOOPS,t_c/t_ya);
+	}
+}
+#endif
+
+#ifdef YA_SP_SPRINTF_Q
+static void bench_float128(void) /* compare %Qe, %Qg and %Qf with quadmath_snprintf() */
+{
+ static char buf[512];
+ static __float128 d[1024];
+ const char *fmts[]={"%.35Qe","%Qg","%.3Qf"};
+ double start;
+ double t_c,t_ya;
+ for(int i=0;i<1024;++i)
+	d[i]=((__float128)randu64()*0x1p64Q+randu64())*0x1p-128Q*powq(10,(int)(randu64()%60)-30); /* random __float128's with a range of exponents */
+ for(int f=0;f<3;++f)
+	{start=bench_now();
+	 for(int i=0;i<BENCH_LOOPS/10;++i)
+		quadmath_snprintf(buf,sizeof buf,fmts[f],d[i&1023]);
+	 t_c=(bench_now()-start)*10;
+	 start=bench_now();
+	 for(int i=0;i<BENCH_LOOPS;++i)
+		ya_s_sprintf(buf,fmts[f],d[i&1023]);
+	 t_ya=bench_now()-start;
+	 printf(" random __float128s: %s quadmath_snprintf() %.1f ns/call, ya_s_sprintf() %.1f ns/call (%.2fx)\n",fmts[f],t_c*1e9/BENCH_LOOPS,t_ya*1e9/BENCH_LOOPS,t_c/t_ya);
+	}
+}
+#endif
+#endif
 
 int main(int argc, char *argv[]) 
 { 
@@ -1497,7 +2553,30 @@ int main(int argc, char *argv[])
 			}
 	 	 printf("  Just checked %.18g\n",du.d);	
 		}    
-	
+#ifdef YA_SP_SPRINTF_IMPLEMENTATION
+	printf(" Starting extra %%r (shortest round trip) checks:\n");
+	// every binary exponent with the smallest, next smallest and largest mantissas (powers of 2 have an asymmetric rounding interval) 
+	for(uint64_t e=0;e<2047;++e)
+		{uint64_t m[]={0,1,2,UINT64_C(0xfffffffffffff),UINT64_C(0xffffffffffffe)};
+		 for(int i=0;i<(int)nos_elements_in(m);++i)
+		 	{du.u=(e<<52)|m[i];
+		 	 check_shortest(NULL,du.d);
+		 	 check_shortest(NULL,-du.d);
+		 	}
+		}
+	// integers and "simple" decimals (where the shortest string is much shorter than 17 digits)
+	for(int i=0;i<1000000;++i)
+		{check_shortest(NULL,(double)i);
+		 check_shortest(NULL,i/1000.0);
+		 check_shortest(NULL,i*1e-300);
+		 check_shortest(NULL,i*1e300);
+		}
+	// and lots more random doubles
+	for(int i=0;i<4000000;++i)
+		{du.u=randu64();
+		 check_shortest(NULL,du.d);
+		}
+#endif	
 	// end of tests 
 #ifdef USE_HR_TIMER	
 	time_taken=read_HR_Timer();
@@ -1518,6 +2597,9 @@ int main(int argc, char *argv[])
 	printf(" %" PRIu64 " errors when 18 sf string converted back to a double (%" PRIu64 " are 1 bit) (sprintf gives %" PRIu64  " differences)\n",errs_dbl18,errs_dbl18_1bit,errs_printf18);
 	printf(" %" PRIu64 " errors when 17 sf string converted back to a double (%" PRIu64 " are 1 bit) (sprintf gives %" PRIu64  " differences)\n",errs_dbl17,errs_dbl17_1bit,errs_printf17);
 	printf(" %" PRIu64 " errors when 16 sf string converted back to a double (%" PRIu64 " are 1 bit) (sprintf gives %" PRIu64  " differences)\n",errs_dbl16,errs_dbl16_1bit,errs_printf16);	
+#ifdef YA_SP_SPRINTF_IMPLEMENTATION
+	printf(" %%r (shortest round trip): %" PRIu64 " tests, %" PRIu64 " did not convert back to the same double, %" PRIu64 " were not the shortest\n",nos_shortest,errs_shortest,errs_shortest_len);
+#endif
 	printf(" Differences between built in \"libc\" sprintf() and tested sprintf() are:\n");
 	for(int i=2;i<=19;++i)
 		{
@@ -1527,7 +2609,7 @@ int main(int argc, char *argv[])
 	printf(" %" PRIu64 " exponent corrections done in float-to-string()\n",count_exp_loops);
 #endif	
 #endif
-#ifdef __SIZEOF_INT128__ 
+#ifdef YA_SP_SPRINTF_Q /* chk_fast_strtof128() is only defined when __float128 is supported */
 	chk_fast_strtof128() ; // tests for fast_strtof128() if compiler supports __float128 data type
 #endif
 #if defined(PART2_SPRINTF_TESTS) && defined(YA_SP_SPRINTF_IMPLEMENTATION)
@@ -3587,24 +4669,24 @@ int main(int argc, char *argv[])
     scnt++;
     i=-2536000;
     u128=i;
-    r_ya=ya_s_sprintf(buf_ya,"%$.3Qu",u128);
+    r_ya=ya_s_sprintf(buf_ya,"%$.3Qu",u128); // 340282366920938.46347 after 8 divisions by 1000 using long doubles so .463 is correctly rounded
     r=ya_s_sprintf(buf,"%Qu 0x%Qx",u128,u128);
     if(r_ya!=21) 
 		{++serrs;
     	 printf("%%$.3Qu(%s) gives <%s> length %d should be length 21\n",buf,buf_ya,r_ya);
     	}
-    if(strcmp(buf_ya,"340282366920938.464 Y")) 
+    if(strcmp(buf_ya,"340282366920938.463 Y")) 
 		{++serrs;
-    	 printf("%%$.3Qu(%s) gives <%s> length %d should give <340282366920938.464 Y> \n",buf,buf_ya,r_ya);
+    	 printf("%%$.3Qu(%s) gives <%s> length %d should give <340282366920938.463 Y> \n",buf,buf_ya,r_ya);
     	} 
     r_ya=ya_s_sprintf(buf_ya,"%$.3I128u",u128);
     if(r_ya!=21) 
 		{++serrs;
     	 printf("%%$.3I128u(%s) gives <%s> length %d should be length 21\n",buf,buf_ya,r_ya);
     	}
-    if(strcmp(buf_ya,"340282366920938.464 Y")) 
+    if(strcmp(buf_ya,"340282366920938.463 Y")) 
 		{++serrs;
-    	 printf("%%$.3I128u(%s) gives <%s> length %d should give <340282366920938.464 Y> \n",buf,buf_ya,r_ya);
+    	 printf("%%$.3I128u(%s) gives <%s> length %d should give <340282366920938.463 Y> \n",buf,buf_ya,r_ya);
     	}     	
 #endif				
 	// now check double
@@ -4159,6 +5241,11 @@ int main(int argc, char *argv[])
 #ifdef YA_SP_SPRINTF_Q /* 128 bit variables (int  & float) supported by compiler */	
 	{ printf("Basic checks for %%L and %%Q suffixes\n");
 	 unsigned int start_scnt=scnt,start_serrs=serrs;
+#ifdef YA_S__Q_EXACT
+	 const int q_via_ld=0; // %Qe, %Qf and %Qg are converted exactly
+#else
+	 const int q_via_ld=1; // %Qe, %Qf and %Qg are converted via long doubles so there are some expected errors
+#endif
 	 double d;
 	 long double dl;
 	 __float128 d128;
@@ -4191,7 +5278,7 @@ int main(int argc, char *argv[])
 		 // r=sprintf(buf,fstr,d128);
 		 r=quadmath_snprintf (buf, sizeof buf,fstr,d128);
 		 r_ya=ya_s_sprintf(buf_ya,fstr,d128);
-		 if(!isnan(dl) &&(d128==6.47517511943802511092443895822764655e-4946F128 || (dl==0 && d128!=0) || (isinf(dl) && !isinfq(d128) ))) 
+		 if(q_via_ld && !isnan(dl) &&(d128==6.47517511943802511092443895822764655e-4946F128 || (dl==0 && d128!=0) || (isinf(dl) && !isinfq(d128) ))) 
 		 	{++expected_errs;
 #ifdef PR_EXPECTED_ERRORS		 	
 			 printf("%s: Expected error: sprintf() gives %s ya_sprintf() gives %s\n",fstr,buf,buf_ya);
@@ -4202,7 +5289,7 @@ int main(int argc, char *argv[])
  		 ++scnt;// now check %I128 as alternative to %Q
 		 fstr="%I128g";
 		 r_ya=ya_s_sprintf(buf_ya,fstr,d128);
-		 if(!isnan(dl) &&(d128==6.47517511943802511092443895822764655e-4946F128 || (dl==0 && d128!=0) || (isinf(dl) && !isinfq(d128) ))) 
+		 if(q_via_ld && !isnan(dl) &&(d128==6.47517511943802511092443895822764655e-4946F128 || (dl==0 && d128!=0) || (isinf(dl) && !isinfq(d128) ))) 
 		 	{++expected_errs;
 #ifdef PR_EXPECTED_ERRORS		 	
 			 printf("%s: Expected error: sprintf() gives %s ya_sprintf() gives %s\n",fstr,buf,buf_ya);
@@ -4236,7 +5323,7 @@ int main(int argc, char *argv[])
 		 // r=sprintf(buf,fstr,d128);
 		 r=quadmath_snprintf (buf, sizeof buf,fstr,d128);
 		 r_ya=ya_s_sprintf(buf_ya,fstr,d128);
-		 if(!isnan(dl) &&(d128==6.47517511943802511092443895822764655e-4946F128 || (dl==0 && d128!=0) || (isinf(dl) && !isinfq(d128) ))) 
+		 if(q_via_ld && !isnan(dl) &&(d128==6.47517511943802511092443895822764655e-4946F128 || (dl==0 && d128!=0) || (isinf(dl) && !isinfq(d128) ))) 
 		 	{++expected_errs;
 #ifdef PR_EXPECTED_ERRORS		 	
 			 printf("%s: Expected error: sprintf() gives %s ya_sprintf() gives %s\n",fstr,buf,buf_ya);
@@ -4247,7 +5334,7 @@ int main(int argc, char *argv[])
 		 ++scnt;
 		 fstr="%I128e";
 		 r_ya=ya_s_sprintf(buf_ya,fstr,d128);
-		 if(!isnan(dl) &&(d128==6.47517511943802511092443895822764655e-4946F128 || (dl==0 && d128!=0) || (isinf(dl) && !isinfq(d128) ))) 
+		 if(q_via_ld && !isnan(dl) &&(d128==6.47517511943802511092443895822764655e-4946F128 || (dl==0 && d128!=0) || (isinf(dl) && !isinfq(d128) ))) 
 		 	{++expected_errs;
 #ifdef PR_EXPECTED_ERRORS		 	
 			 printf("%s: Expected error: sprintf() gives %s ya_sprintf() gives %s\n",fstr,buf,buf_ya);
@@ -4281,7 +5368,7 @@ int main(int argc, char *argv[])
 		 // r=sprintf(buf,fstr,d128);
 		 r=quadmath_snprintf (buf, sizeof buf,fstr,d128);
 		 r_ya=ya_s_sprintf(buf_ya,fstr,d128);
-		 if(!isnan(dl) &&(/*(d==0 && dl!=0) ||*/ (isinf(dl) && !isinfq(d128) ) )) 
+		 if(q_via_ld && !isnan(dl) &&(/*(d==0 && dl!=0) ||*/ (isinf(dl) && !isinfq(d128) ) )) 
 		 	{++expected_errs;
 #ifdef PR_EXPECTED_ERRORS		 	
 			 printf("%s: Expected error: sprintf() gives %s ya_sprintf() gives %s\n",fstr,buf,buf_ya);
@@ -4292,7 +5379,7 @@ int main(int argc, char *argv[])
 		 ++scnt;
 		 fstr="%I128f";
 		 r_ya=ya_s_sprintf(buf_ya,fstr,d128);
-		 if(!isnan(dl) &&(/*(d==0 && dl!=0) ||*/ (isinf(dl) && !isinfq(d128) ) )) 
+		 if(q_via_ld && !isnan(dl) &&(/*(d==0 && dl!=0) ||*/ (isinf(dl) && !isinfq(d128) ) )) 
 		 	{++expected_errs;
 #ifdef PR_EXPECTED_ERRORS		 	
 			 printf("%s: Expected error: sprintf() gives %s ya_sprintf() gives %s\n",fstr,buf,buf_ya);
@@ -4476,6 +5563,242 @@ int main(int argc, char *argv[])
 		printf("%u sprintf tests completed on %%L, %u unexpected errors found (+ %u expected errors)\n",scnt-start_scnt,serrs-start_serrs,expected_errs);	
 	 } 	 
 #endif	 
+#endif
+	{ printf("Checking integer to decimal conversions (%%d, %%u, %%lld and %%llu with random widths and precisions):\n");
+	 unsigned int start_scnt=scnt,start_serrs=serrs;
+	 static char *ifmts[]={"%*.*d","%-*.*d","%+*.*d","%0*d","%*.*u","%*.*lld","%-*.*llu","% *.*lld","%0*llu"};
+	 uint64_t v;
+	 int w,pr;
+	 for(int i=0;i<1000000;++i)
+	 	{v=randu64()>>(randu64()%64); // random number of digits
+	 	 w=(int)(randu64()%24);
+	 	 pr=(int)(randu64()%24)-1; // -1 => no precision
+	 	 fstr=ifmts[i%(sizeof(ifmts)/sizeof(ifmts[0]))];
+	 	 if(pr==0 && (fstr[strlen(fstr)-2]=='l' ? v==0 : (int)v==0)) pr=1; // ya_sprintf() prints 0 for %.0d while C99 says this should give no characters
+		 ++scnt;
+		 if(fstr[1]=='0' && fstr[strlen(fstr)-2]=='l')
+			{r=sprintf(buf,fstr,w,(unsigned long long)v);
+			 r_ya=ya_s_sprintf(buf_ya,fstr,w,(unsigned long long)v);
+			}
+		 else if(fstr[1]=='0')
+			{r=sprintf(buf,fstr,w,(int)v);
+			 r_ya=ya_s_sprintf(buf_ya,fstr,w,(int)v);
+			}
+		 else if(fstr[strlen(fstr)-2]=='l')
+			{r=sprintf(buf,fstr,w,pr,(unsigned long long)v);
+			 r_ya=ya_s_sprintf(buf_ya,fstr,w,pr,(unsigned long long)v);
+			}
+		 else
+			{r=sprintf(buf,fstr,w,pr,(int)v);
+			 r_ya=ya_s_sprintf(buf_ya,fstr,w,pr,(int)v);
+			}
+		 if(strcmp(buf,buf_ya)) {++serrs;printf("%s: sprintf(w=%d,pr=%d) gives %s ya_sprintf() gives %s\n",fstr,w,pr,buf,buf_ya);}
+		 else if(r!=r_ya){ ++serrs;printf ("%s: sprintf() returns %d ya_sprintf() returns %d\n",fstr,r,r_ya);}
+		}
+	 for(int i=0;i<100000;++i)
+	 	{// thousands separators (default separators), check against the digits from sprintf()
+	 	 char *p=buf+64;
+	 	 int nd;
+	 	 v=randu64()>>(randu64()%64);
+	 	 nd=sprintf(buf+128,"%llu",(unsigned long long)v);
+	 	 *p=0;
+	 	 for(int j=0;j<nd;++j)
+	 	 	{if(j && j%3==0) *--p=',';
+	 	 	 *--p=buf[128+nd-1-j];
+	 	 	}
+		 ++scnt;
+		 r_ya=ya_s_sprintf(buf_ya,"%'llu",(unsigned long long)v);
+		 if(strcmp(p,buf_ya)) {++serrs;printf("%%'llu: expected %s ya_sprintf() gives %s\n",p,buf_ya);}
+		}
+#ifdef YA_SP_SPRINTF_Q
+	 for(int i=0;i<1000000;++i)
+	 	{// 128 bit integers
+	 	 uint128_t u=((uint128_t)randu64()<<64)|randu64();
+	 	 u>>=randu64()%128;
+		 ++scnt;
+		 if(i&1)
+			{r=sprint_int128_decimal(buf,(int128_t)u);
+			 r_ya=ya_s_sprintf(buf_ya,"%I128d",(int128_t)u);
+			}
+		 else
+			{r=sprint_uint128_decimal(buf,u);
+			 r_ya=ya_s_sprintf(buf_ya,"%I128u",u);
+			}
+		 if(strcmp(buf,buf_ya)) {++serrs;printf("%%I128: expected %s ya_sprintf() gives %s\n",buf,buf_ya);}
+		 else if(r!=r_ya){ ++serrs;printf ("%%I128: expected return %d ya_sprintf() returns %d\n",r,r_ya);}
+		}
+#endif
+	  if(serrs-start_serrs==0)
+		printf("%u sprintf tests completed on integers, no errors found\n",scnt-start_scnt);
+      else	
+		printf("%u sprintf tests completed on integers, %u errors found\n",scnt-start_scnt,serrs-start_serrs);	
+	 }
+#ifdef YA_S__DBL_EXACT /* exact double conversion in use */
+	{ printf("Checking exact double conversions (%%e, %%f and %%g up to 17 significant digits):\n");
+	 unsigned int start_scnt=scnt,start_serrs=serrs;
+	 double d;
+	 uint64_t m;
+	 int pr;
+	 for(int i=0;i<1000000;++i)
+	 	{// random doubles over the full range including denormals
+	 	 m=randu64();
+	 	 if((i&7)==0) m>>=12+randu64()%52; // denormals and very small numbers
+	 	 memcpy(&d,&m,sizeof(d));
+	 	 if(isnan(d) || isinf(d)) continue;
+	 	 pr=(int)(randu64()%17);
+		 ++scnt;
+		 fstr=(i&1)?"%.*e":"%.*g";
+		 r=sprintf(buf,fstr,pr,d);
+		 r_ya=ya_s_sprintf(buf_ya,fstr,pr,d);
+		 if(strcmp(buf,buf_ya)) {++serrs;printf("%s: sprintf(pr=%d) gives %s ya_sprintf() gives %s\n",fstr,pr,buf,buf_ya);}
+		 else if(r!=r_ya){ ++serrs;printf ("%s: sprintf() returns %d ya_sprintf() returns %d\n",fstr,r,r_ya);}
+		}
+	 for(int i=0;i<1000000;++i)
+	 	{// exact binary fractions k/2^j, printed with %.*f to test ties (round to even)
+	 	 int j=(int)(randu64()%13);
+	 	 d=ldexp((double)(randu64()>>(48+randu64()%16)),-j); // at most 17 significant digits
+	 	 if(randu64()&1) d= -d;
+	 	 pr=(int)(randu64()%(j+1));
+		 ++scnt;
+		 fstr="%.*f";
+		 r=sprintf(buf,fstr,pr,d);
+		 r_ya=ya_s_sprintf(buf_ya,fstr,pr,d);
+		 if(strcmp(buf,buf_ya)) {++serrs;printf("%s: sprintf(pr=%d) gives %s ya_sprintf() gives %s\n",fstr,pr,buf,buf_ya);}
+		 else if(r!=r_ya){ ++serrs;printf ("%s: sprintf() returns %d ya_sprintf() returns %d\n",fstr,r,r_ya);}
+		}
+	 for(int e=-323;e<=308;++e)
+	 	{// powers of 10 and their neighbours
+	 	 double p10=pow(10.0,e);
+	 	 double v[3]={p10,nextafter(p10,0.0),nextafter(p10,HUGE_VAL)};
+	 	 for(int k=0;k<3;++k)
+	 	 	{pr=(e+k)%17;
+	 	 	 if(pr<0) pr= -pr;
+			 ++scnt;
+			 fstr="%.*e";
+			 r=sprintf(buf,fstr,pr,v[k]);
+			 r_ya=ya_s_sprintf(buf_ya,fstr,pr,v[k]);
+			 if(strcmp(buf,buf_ya)) {++serrs;printf("%s: sprintf(pr=%d) gives %s ya_sprintf() gives %s\n",fstr,pr,buf,buf_ya);}
+			 else if(r!=r_ya){ ++serrs;printf ("%s: sprintf() returns %d ya_sprintf() returns %d\n",fstr,r,r_ya);}
+			}
+		}
+	  if(serrs-start_serrs==0)
+		printf("%u sprintf tests completed on exact doubles, no errors found\n",scnt-start_scnt);
+      else	
+		printf("%u sprintf tests completed on exact doubles, %u errors found\n",scnt-start_scnt,serrs-start_serrs);	
+	 }
+#elif defined(YA_SP_SPRINTF_LD) && !defined(YA_SP_DD_SCALING)
+	printf("Exact double conversions are only used without long doubles, compile with -DTEST_NO_LD to check them\n");
+#endif
+#ifdef YA_S__LD_EXACT /* exact long double conversion in use */
+	{ printf("Checking exact long double conversions (%%Le, %%Lf and %%Lg up to 32 significant digits):\n");
+	 unsigned int start_scnt=scnt,start_serrs=serrs;
+	 long double dl;
+	 uint64_t m;
+	 uint16_t se;
+	 int pr;
+	 for(int i=0;i<1000000;++i)
+	 	{// random long doubles over the full range including denormals
+	 	 m=randu64()|UINT64_C(0x8000000000000000);
+		 se=(uint16_t)(randu64()%0x7fff);
+		 if(se==0) m>>=1+randu64()%63; // denormal
+		 se|=(uint16_t)((randu64()&1)<<15); // random sign
+		 memcpy(&dl,&m,sizeof(m));
+		 memcpy((char *)&dl+8,&se,sizeof(se));
+		 pr=(int)(randu64()%32);
+		 ++scnt;
+		 fstr=(i&1)?"%.*Le":"%.*Lg";
+		 r=sprintf(buf,fstr,pr,dl);
+		 r_ya=ya_s_sprintf(buf_ya,fstr,pr,dl);
+		 if(strcmp(buf,buf_ya)) {++serrs;printf("%s: sprintf(pr=%d) gives %s ya_sprintf() gives %s\n",fstr,pr,buf,buf_ya);}
+		 else if(r!=r_ya){ ++serrs;printf ("%s: sprintf() returns %d ya_sprintf() returns %d\n",fstr,r,r_ya);}
+		}
+	 for(int i=0;i<1000000;++i)
+	 	{// exact binary fractions k/2^j, printed with %.*Lf to test ties (round to even)
+	 	 int j=(int)(randu64()%21);
+	 	 dl=ldexpl((long double)(randu64()>>(34+randu64()%30)),-j);
+	 	 if(randu64()&1) dl= -dl;
+	 	 pr=(int)(randu64()%(j+1));
+		 ++scnt;
+		 fstr="%.*Lf";
+		 r=sprintf(buf,fstr,pr,dl);
+		 r_ya=ya_s_sprintf(buf_ya,fstr,pr,dl);
+		 if(strcmp(buf,buf_ya)) {++serrs;printf("%s: sprintf(pr=%d) gives %s ya_sprintf() gives %s\n",fstr,pr,buf,buf_ya);}
+		 else if(r!=r_ya){ ++serrs;printf ("%s: sprintf() returns %d ya_sprintf() returns %d\n",fstr,r,r_ya);}
+		}
+	 for(int e=-4950;e<=4932;++e)
+	 	{// powers of 10 and their neighbours
+	 	 long double p10=powl(10.0L,e);
+	 	 long double v[3]={p10,nextafterl(p10,0.0L),nextafterl(p10,HUGE_VALL)};
+	 	 for(int k=0;k<3;++k)
+	 	 	{pr=(e+k)%32;
+	 	 	 if(pr<0) pr= -pr;
+			 ++scnt;
+			 fstr="%.*Le";
+			 r=sprintf(buf,fstr,pr,v[k]);
+			 r_ya=ya_s_sprintf(buf_ya,fstr,pr,v[k]);
+			 if(strcmp(buf,buf_ya)) {++serrs;printf("%s: sprintf(pr=%d) gives %s ya_sprintf() gives %s\n",fstr,pr,buf,buf_ya);}
+			 else if(r!=r_ya){ ++serrs;printf ("%s: sprintf() returns %d ya_sprintf() returns %d\n",fstr,r,r_ya);}
+			}
+		}
+	  if(serrs-start_serrs==0)
+		printf("%u sprintf tests completed on exact long doubles, no errors found\n",scnt-start_scnt);
+      else	
+		printf("%u sprintf tests completed on exact long doubles, %u errors found\n",scnt-start_scnt,serrs-start_serrs);	
+	 }
+#endif
+#ifdef YA_S__Q_EXACT /* exact __float128 conversion in use */
+	{ printf("Checking exact __float128 conversions (%%Qe, %%Qf and %%Qg up to 36 significant digits):\n");
+	 unsigned int start_scnt=scnt,start_serrs=serrs;
+	 __float128 d128;
+	 __uint128_t b128;
+	 int pr;
+	 for(int i=0;i<1000000;++i)
+	 	{// random __float128's over the full range including denormals
+	 	 b128=((__uint128_t)randu64()<<64)|randu64();
+	 	 if((i&3)==0) b128>>=1+randu64()%120; // denormals and very small numbers
+		 memcpy(&d128,&b128,sizeof(d128));
+		 if(isnanq(d128) || isinfq(d128)) continue;
+		 pr=(int)(randu64()%36);
+		 ++scnt;
+		 fstr=(i&1)?"%.*Qe":"%.*Qg";
+		 r=quadmath_snprintf(buf,sizeof buf,fstr,pr,d128);
+		 r_ya=ya_s_sprintf(buf_ya,fstr,pr,d128);
+		 if(strcmp(buf,buf_ya)) {++serrs;printf("%s: quadmath_snprintf(pr=%d) gives %s ya_sprintf() gives %s\n",fstr,pr,buf,buf_ya);}
+		 else if(r!=r_ya){ ++serrs;printf ("%s: quadmath_snprintf() returns %d ya_sprintf() returns %d\n",fstr,r,r_ya);}
+		}
+	 for(int i=0;i<1000000;++i)
+	 	{// exact binary fractions k/2^j, printed with %.*Qf to test ties (round to even)
+	 	 int j=(int)(randu64()%25);
+	 	 d128=ldexpq((__float128)(randu64()>>(25+randu64()%39)),-j); // < 2^39 so at most 12+24=36 significant digits
+	 	 if(randu64()&1) d128= -d128;
+	 	 pr=(int)(randu64()%(j+1));
+		 ++scnt;
+		 fstr="%.*Qf";
+		 r=quadmath_snprintf(buf,sizeof buf,fstr,pr,d128);
+		 r_ya=ya_s_sprintf(buf_ya,fstr,pr,d128);
+		 if(strcmp(buf,buf_ya)) {++serrs;printf("%s: quadmath_snprintf(pr=%d) gives %s ya_sprintf() gives %s\n",fstr,pr,buf,buf_ya);}
+		 else if(r!=r_ya){ ++serrs;printf ("%s: quadmath_snprintf() returns %d ya_sprintf() returns %d\n",fstr,r,r_ya);}
+		}
+	 for(int e=-4965;e<=4932;++e)
+	 	{// powers of 10 and their neighbours
+	 	 __float128 p10=powq(10.0Q,e);
+	 	 __float128 v[3]={p10,nextafterq(p10,0.0Q),nextafterq(p10,HUGE_VALQ)};
+	 	 for(int k=0;k<3;++k)
+	 	 	{pr=(e+k)%36;
+	 	 	 if(pr<0) pr= -pr;
+			 ++scnt;
+			 fstr="%.*Qe";
+			 r=quadmath_snprintf(buf,sizeof buf,fstr,pr,v[k]);
+			 r_ya=ya_s_sprintf(buf_ya,fstr,pr,v[k]);
+			 if(strcmp(buf,buf_ya)) {++serrs;printf("%s: quadmath_snprintf(pr=%d) gives %s ya_sprintf() gives %s\n",fstr,pr,buf,buf_ya);}
+			 else if(r!=r_ya){ ++serrs;printf ("%s: quadmath_snprintf() returns %d ya_sprintf() returns %d\n",fstr,r,r_ya);}
+			}
+		}
+	  if(serrs-start_serrs==0)
+		printf("%u sprintf tests completed on exact __float128s, no errors found\n",scnt-start_scnt);
+      else	
+		printf("%u sprintf tests completed on exact __float128s, %u errors found\n",scnt-start_scnt,serrs-start_serrs);	
+	 }
 #endif
 	 
 #define TYPE_SIGNED(t) (! ((t) 0 < (t) -1))
@@ -4727,6 +6050,470 @@ int main(int argc, char *argv[])
 	 	}
 	}	
 #endif	// YA_SP_SPRINTF_Q
+#ifdef __GNUC__
+	{ printf("Checking stack used by ya_s_sprintf() and ya_s_snprintf():\n");
+	 unsigned int start_scnt=scnt,start_serrs=serrs;
+	 size_t used,most=0;
+	 double d=DBL_MAX,dmin=4.9406564584124654e-324;
+	 uint64_t u=UINT64_MAX;
+#ifdef YA_SP_SPRINTF_LD
+	 long double ld=LDBL_MAX,ldmin=LDBL_MIN/4;
+#endif
+#ifdef YA_S__LD_EXACT
+	 long double ldcmp; /* a denormal so close to a rounding point that %.31Le needs the big number comparison with 5^4963 (the deepest path) */
+	 memcpy(&ldcmp,"\x6e\xe0\x2b\x1a\x92\xd3\x1f\xf2\x01\x00",10);
+#endif
+#ifdef YA_SP_SPRINTF_Q
+	 __float128 q=FLT128_MAX,qmin=FLT128_DENORM_MIN;
+	 __uint128_t u128=~(__uint128_t)0;
+#endif
+	 struct {int (*fn)(const char *,void *); const char *fmt; void *v;} t[]= /* the conversions that needed the most stack before */
+	 	{{stack_d,"%'f",&d},{stack_d_sn,"%'f",&d},{stack_d,"%.350f",&dmin},{stack_d,"%#.400g",&d},{stack_d,"%'.17e",&dmin},{stack_d,"%r",&dmin},{stack_d,"%a",&d},
+	 	 {stack_u64,"%'llu",&u},{stack_u64,"%'.5000llx",&u},{stack_u64,"%.5000llo",&u},{stack_u64,"%'llb",&u},
+#ifdef YA_SP_SPRINTF_LD
+	 	 {stack_ld,"%'Lf",&ld},{stack_ld,"%.350Lf",&ldmin},{stack_ld,"%.40Le",&ldmin},{stack_ld_sn,"%'Lf",&ld},{stack_ld_sn,"%#.5000Lg",&ld},
+#endif
+#ifdef YA_S__LD_EXACT
+	 	 {stack_ld,"%.31Le",&ldcmp},{stack_ld_sn,"%.31Le",&ldcmp},
+#endif
+#ifdef YA_SP_SPRINTF_Q
+	 	 {stack_q,"%'Qf",&q},{stack_q,"%.350Qf",&qmin},{stack_q,"%.40Qe",&qmin},{stack_i128,"%'I128b",&u128},{stack_i128,"%'.5000I128u",&u128},
+#endif
+	 	};
+	 for(size_t i=0;i<sizeof(t)/sizeof(t[0]);++i)
+	 	{
+	 	 used=stack_used(t[i].fn,t[i].fmt,t[i].v);
+	 	 if(used>most) most=used;
+	 	 ++scnt;
+	 	 if(used>STACK_LIMIT) {++serrs;printf("%s: used %u bytes of stack (limit is %u)\n",t[i].fmt,(unsigned)used,STACK_LIMIT);}
+	 	}
+	  if(serrs-start_serrs==0)
+		printf("%u stack tests completed, at most %u bytes of stack used (limit is %u), no errors found\n",scnt-start_scnt,(unsigned)most,STACK_LIMIT);
+      else	
+		printf("%u stack tests completed, %u errors found\n",scnt-start_scnt,serrs-start_serrs);	
+	 }
+#endif
+	printf("Checking ya_s_compile_format() and ya_s_exec():\n");
+	{static ya_s_format_program prog;
+	 static char buf_p[1000];
+	 int r_p;
+	 check_prog("%*d|%-*d|%.*f|%*.*s|",buf,sprintf(buf,"%*d|%-*d|%.*f|%*.*s|",6,42,-6,42,3,3.14159,8,3,"abcdef"),6,42,-6,42,3,3.14159,8,3,"abcdef");
+	 check_prog("no conversions at all",buf,sprintf(buf,"no conversions at all"));
+	 check_prog("%% %c%%%s %'d",buf,ya_s_sprintf(buf,"%% %c%%%s %'d",'x',"str",1234567),'x',"str",1234567);
+	 scnt++;
+	 if(!ya_s_compile_format(&prog,"abc%")) {++serrs;printf("ya_s_compile_format(\"abc%%\") failed\n");}
+	 else
+	 	{r_p=exec_sprintf(buf_p,&prog);
+	 	 r_ya=ya_s_sprintf(buf_ya,"abc%");
+		 if(r_p!=3 || r_ya!=3 || strcmp(buf_p,"abc") || strcmp(buf_ya,"abc")) {++serrs;printf("\"abc%%\": ya_sprintf() gives %s ya_s_exec() gives %s\n",buf_ya,buf_p);}
+		}
+	 scnt++;
+	 strcpy(buf,"");
+	 for(int i=0;i<=YA_SP_FORMAT_MAXOPS;++i) strcat(buf,"%d"); // one too many conversions
+	 if(ya_s_compile_format(&prog,buf)) {++serrs;printf("ya_s_compile_format() accepted %d conversions\n",YA_SP_FORMAT_MAXOPS+1);}
+	 scnt++;
+	 if(ya_s_compile_format(&prog,NULL)) {++serrs;printf("ya_s_compile_format(NULL) did not fail\n");}
+	}
+	printf("Checking ya_s_vsprintfsink():\n");
+	{static char big[5000];
+	 memset(big,'a',sizeof(big)-1);
+	 check_sink("",0);
+	 check_sink("no conversions at all",0);
+	 check_sink("%s=%d %x|%-8.3f|%+e %c%%",0,"key",-123456,0xbeefu,3.14159,-1e-300,'z');
+	 check_sink("%01000d|%'01000d|%-1000s|%.*s",0,99,-1234,"abc",4000,big);
+	 check_sink("%'.40f %.300e %#.0g %a",0,1e300,1.0/3,1e22,0.1);
+	 check_sink("%s%s%s",0,big,big,big);
+	 check_sink("%s%s%s",0,big,"",big);
+	 check_sink("%s%01000d%s",100,big,7,big);
+	 check_sink("%01000d%s",1500,7,big);
+	 for(int n=2;n<=2048;n=n*3+1)
+	 	{check_cb_ex(n,"%s=%d %x|%-8.3f|%+e %c%%","key",-123456,0xbeefu,3.14159,-1e-300,'z');
+	 	 check_cb_ex(n,"%01000d|%'01000d|%-1000s|%.*s",99,-1234,"abc",4000,big);
+	 	 check_cb_ex(n,"%'.40f %.300e %#.0g %a %I64u",1e300,1.0/3,1e22,0.1,UINT64_MAX);
+	 	}
+	}
+	printf("Checking ya_s_format_length():\n");
+	{static char big[5000];
+	 int n1=0,n2=0,n3=0;
+	 short h=0;
+	 memset(big,'a',sizeof(big)-1);
+	 check_length("");
+	 check_length("no conversions at all %% %");
+	 check_length("%s=%d %x|%-8.3f|%+e %c%%","key",-123456,0xbeefu,3.14159,-1e-300,'z');
+	 check_length("%*d|%-*d|%*d|%.*d|%.*d|%*.*s|",6,42,-6,42,-3,123456,5,-7,-5,7,8,3,"abcdef");
+	 check_length("%01000d|%'01000d|%-1000s|%.*s|%.3s|%s|%.2s|%10s",99,-1234,"abc",4000,big,"ab",(char *)NULL,(char *)NULL,(char *)NULL);
+	 check_length("%'d %'d %'u %'lld %'12d %' d %'+d",0,-1234567,4000000000u,-9223372036854775807LL-1,123456,1000,999);
+	 check_length("%hd %hhd %hu %hhu %hx %hhx %hd %hhd",-1,-1,70000,300,0x12345,0x1ff,32768,128);
+	 check_length("%.0d|%.0x|%#.0x|%#x|%#o|%#b|%#B|%.5x|%08.3X|%-#10o",0,0,0,0,0,5,5,255,0xabc,8);
+	 check_length("%p %20p %-20p %p",(void *)0,(void *)big,(void *)big,(void *)0x1234);
+	 check_length("%llx %llo %llb %lld %I64u %jd %zu %td",UINT64_MAX,UINT64_MAX,UINT64_MAX,INT64_MIN,UINT64_MAX,(intmax_t)-1,(size_t)123,(ptrdiff_t)-5);
+	 check_length("%'x %'.20x %'020b %$d %$$d %_$d %$.3d",0x12345678u,0xabcu,5,123456,999999999,2000,-1024);
+	 check_length("%'.40f %.300e %#.0g %a %G %r %R %f",1e300,1.0/3,1e22,0.1,-1e-300,0.1,2.5,-0.0);
+	 check_length("%f %e %g %10.3f %-+12e",INFINITY,-INFINITY,NAN,NAN,INFINITY);
+	 check_length("%k|%5k|%-5y|%",1,2);
+#ifdef YA_SP_SPRINTF_LD
+	 check_length("%Lf %.30Le %Lg %La",1e4000L,-1.0L/3,1e-4000L,0.1L);
+#endif
+#ifdef YA_SP_SPRINTF_Q
+	 check_length("%Qf %.30Qe %Qg %I128d %'I128u %I128x %.50I128d",(__float128)1e300,(__float128)-1/3,(__float128)1e-300,(ya_s__int128_t)-1,~(ya_s__uint128_t)0,~(ya_s__uint128_t)0,(ya_s__int128_t)7);
+#endif
+	 scnt++;
+	 n1=ya_s_format_length("abc%n%5d%hn%s%n%c",&n2,42,&h,big,&n3,'x');
+	 if(n1!=(int)strlen(big)+9 || n2!=3 || h!=8 || n3!=n1-1) {++serrs;printf("ya_s_format_length() with %%n returns %d (%%n gives %d %d %d)\n",n1,n2,h,n3);}
+	 scnt++;
+	 if(ya_s_format_length(NULL)!=0) {++serrs;printf("ya_s_format_length(NULL) did not return 0\n");}
+	}
+	printf("Checking ya_s_asprintf():\n");
+	{static char big[100000],mem[1<<20];
+	 char *s1,*s2;
+	 ya_s_arena arena={ya_s_bump_grow,&test_bump};
+	 memset(big,'a',sizeof(big)-1);
+	 ya_s_bump_init(&test_bump,mem,sizeof(mem));
+	 check_asprintf("");
+	 check_asprintf("no conversions at all");
+	 check_asprintf("%s=%d %x|%-8.3f|%+e %c%%","key",-123456,0xbeefu,3.14159,-1e-300,'z');
+	 for(int n=YA_SP_SPRINTF_MIN-3;n<=YA_SP_SPRINTF_MIN+2;++n) /* either side of the switch from the stack buffer to the heap */
+	 	check_asprintf("%*s|%d",n,"x",n);
+	 check_asprintf("%01000d|%'01000d|%-1000s|%.*s",99,-1234,"abc",4000,big);
+	 check_asprintf("%s%s%s",big,"",big);
+	 check_asprintf("%'.40f %.300e %#.0g %a %Lf",1e300,1.0/3,1e22,0.1,1e4000L);
+	 /* strings from an arena stay put as later ones are added, and are freed together */
+	 scnt++;
+	 ya_s_bump_reset(&test_bump);
+	 if(ya_s_asprintf_arena(&arena,&s1,"%d %s",1,"first")!=7 || ya_s_asprintf_arena(&arena,&s2,"%.*s",2000,big)!=2000 || strcmp(s1,"1 first") || s2!=s1+8 || test_bump.used!=8+2001)
+	 	{++serrs;printf("ya_s_asprintf_arena() gives %s (%d bytes used)\n",s1,(int)test_bump.used);}
+	 scnt++;
+	 ya_s_bump_init(&test_bump,mem,1000); /* too small */
+	 if(ya_s_asprintf_arena(&arena,&s1,"%.*s",1000,big)!=-1 || s1!=NULL) {++serrs;printf("ya_s_asprintf_arena() did not fail when out of memory\n");}
+	 if(ya_s_asprintf_arena(&arena,&s1,"%.*s",999,big)!=999 || s1!=mem) {++serrs;printf("ya_s_asprintf_arena() failed with 1000 bytes\n");}
+	 ya_s_bump_reset(&test_bump);
+	 if(test_bump.used!=0) {++serrs;printf("ya_s_bump_reset() did not free the arena\n");}
+	}
+#ifdef YA_SP_LOG
+	printf("Checking ya_s_log():\n");
+	{static char expect[200000],big[600];
+	 static ya_s_log_ring small;
+	 static char small_mem[512];
+	 int len=0,n=0,drained=0,r,ok=1,nn;
+	 memset(big,'s',sizeof(big)-1);
+	 scnt++;
+	 ya_s_log_attach(NULL);
+	 if(ya_s_log("%d",1)!=-1) {++serrs;printf("ya_s_log() without a ring did not fail\n");}
+	 /* a small ring so records wrap round its end and it fills up */
+	 ya_s_log_ring_init(&small,small_mem,sizeof(small_mem)+100); /* rounded down to 512 */
+	 ya_s_log_attach(&small);
+	 log_pos=0;
+	 for(int i=0;i<2000;++i)
+	 	{const char *str=big+sizeof(big)-1-(i*37)%200;
+	 	 r=ya_s_log("%d %s|%*.*f %c %llx %p %%%n",i,str,i%13-6,i%5,i*0.37,'a'+i%26,(unsigned long long)i<<40,(void *)(size_t)i,&nn);
+	 	 if(r==0)
+	 	 	{len+=ya_s_sprintf(expect+len,"%d %s|%*.*f %c %llx %p %%",i,str,i%13-6,i%5,i*0.37,'a'+i%26,(unsigned long long)i<<40,(void *)(size_t)i);
+	 	 	 ++n;
+	 	 	}
+	 	 if(i%7==6) drained+=ya_s_log_drain(&log_sink);
+	 	 if(len>(int)sizeof(expect)-1000)
+	 	 	{drained+=ya_s_log_drain(&log_sink);
+	 	 	 log_out[log_pos]=0;
+	 	 	 if(log_pos!=len || strcmp(log_out,expect)) ok=0;
+	 	 	 log_pos=len=0;
+	 	 	}
+	 	}
+	 drained+=ya_s_log_drain(&log_sink);
+	 log_out[log_pos]=0;
+	 scnt++;
+	 if(!ok || log_pos!=len || strcmp(log_out,expect) || drained!=n) {++serrs;printf("ya_s_log() into a small ring: %d records drained of %d, output %s\n",drained,n,ok && log_pos==len && !strcmp(log_out,expect)?"correct":"wrong");}
+	 scnt++;
+	 if(small.dropped==0 || small.dropped+n!=2000) {++serrs;printf("ya_s_log() into a small ring: %u dropped, %d logged of 2000\n",small.dropped,n);}
+	 scnt++;
+	 if(ya_s_log("%s",big)!=-1) {++serrs;printf("ya_s_log() of a string longer than the ring did not fail\n");}
+	 ya_s_log_attach(test_ring.mem?&test_ring:NULL);
+	}
+	printf("Checking ya_s_log_capture():\n");
+	{FILE *fp=tmpfile();
+	 static char expect[400000],fmts[5000][20],file[1<<20],io[1000];
+	 static char const *defs[4096];
+	 static ya_s_log_ring cap;
+	 static char cap_mem[1<<19];
+	 ya_s_dbuf b;
+	 int len=0,n=0,got=0,ok=1,r,flen=0,pos,ndefs=0,bad=0;
+	 scnt++;
+	 if(fp==NULL) {++serrs;printf("tmpfile() failed\n");}
+	 else
+	 	{ya_s_log_ring_init(&cap,cap_mem,sizeof(cap_mem));
+	 	 ya_s_log_attach(&cap);
+	 	 ya_s_dbuf_init(&b,fileno(fp),io,sizeof(io)); /* a small buffer so records straddle the end of it */
+	 	 if(ya_s_log_capture_start(&b)) ok=0;
+	 	 /* 5002 format strings per capture (5001 without long doubles) for the writer's 4096 ids, so the ids of the ones used every 10 calls are taken over part way through a capture */
+	 	 for(int i=0;i<10000;++i)
+	 	 	{char *f=fmts[i%5000];
+	 	 	 if(i<5000) ya_s_sprintf(f,"%d:%%d %%s %%g\n",i);
+	 	 	 if(ya_s_log(f,i,"str",i*0.5)==0) {len+=ya_s_sprintf(expect+len,f,i,"str",i*0.5);++n;}
+	 	 	 if(i%10==0 && ya_s_log("%s|%5.2Lf|%lld|%c\n",i%3?"s":NULL,(long double)i/3,(long long)i<<33,'a'+i%26)==0)
+	 	 	 	{len+=ya_s_sprintf(expect+len,"%s|%5.2Lf|%lld|%c\n",i%3?"s":NULL,(long double)i/3,(long long)i<<33,'a'+i%26);++n;}
+	 	 	 if(i%10==5 && ya_s_log("%s=%d\n","i",i)==0) {len+=ya_s_sprintf(expect+len,"%s=%d\n","i",i);++n;}
+	 	 	 if(i%5000==4999)
+	 	 	 	{if((r=ya_s_log_capture(&b))<0) ok=0;
+	 	 	 	 else got+=r;
+	 	 	 	}
+	 	 	}
+	 	 /* a format string buffer reused with new text once its records have been captured */
+	 	 strcpy(fmts[0],"A=%d\n");
+	 	 if(ya_s_log(fmts[0],1)==0) {len+=ya_s_sprintf(expect+len,fmts[0],1);++n;}
+	 	 if((r=ya_s_log_capture(&b))<0) ok=0;
+	 	 else got+=r;
+	 	 strcpy(fmts[0],"B=%s\n");
+	 	 if(ya_s_log(fmts[0],"x")==0) {len+=ya_s_sprintf(expect+len,fmts[0],"x");++n;}
+	 	 if((r=ya_s_log_capture(&b))<0) ok=0;
+	 	 else got+=r;
+	 	 ya_s_log_attach(test_ring.mem?&test_ring:NULL);
+	 	 rewind(fp);
+	 	 flen=(int)fread(file,1,sizeof(file),fp);
+	 	 fclose(fp);
+	 	 /* read it back as ya_decode does */
+	 	 log_pos=0;
+	 	 pos=ya_s_log_capture_check(file,(size_t)flen);
+	 	 if(pos!=16) ok=0;
+	 	 while(ok && pos+8<=flen)
+	 	 	{uint32_t rlen,id;
+	 	 	 memcpy(&rlen,file+pos,4);
+	 	 	 memcpy(&id,file+pos+4,4);
+	 	 	 if(rlen<8 || rlen>(uint32_t)(flen-pos)) {ok=0;break;}
+	 	 	 if(id&0x80000000u)
+	 	 	 	{id&=0x7fffffff;
+	 	 	 	 if(id>=4096 || rlen==8 || file[pos+rlen-1]!=0) {ok=0;break;} /* ids are reused, and the text includes its nul */
+	 	 	 	 defs[id]=file+pos+8;
+	 	 	 	 ++ndefs;
+	 	 	 	}
+	 	 	 else if(id>=4096 || defs[id]==NULL || ya_s_log_replay(&log_sink,defs[id],file+pos+8,(int)rlen-8)<0) ++bad;
+	 	 	 pos+=rlen;
+	 	 	}
+	 	 if(pos!=flen) ok=0;
+	 	 log_out[log_pos]=0;
+	 	 if(!ok || bad || got!=n || log_pos!=len || strcmp(log_out,expect)) {++serrs;printf("ya_s_log_capture(): %d records captured of %d, %d could not be replayed, output %s\n",got,n,bad,log_pos==len && !strcmp(log_out,expect)?"correct":"wrong");}
+	 	 scnt++;
+	 	 if(ndefs<=2*5001+2 || ndefs>n) {++serrs;printf("ya_s_log_capture(): %d format strings written for %d records, ids were not taken over\n",ndefs,n);}
+	 	 scnt++;
+	 	 file[0]='x';
+	 	 if(ya_s_log_capture_check(file,(size_t)flen)!=-1 || ya_s_log_capture_check(file+1,10)!=-1) {++serrs;printf("ya_s_log_capture_check() accepted a bad header\n");}
+	 	}
+	}
+#endif
+#ifndef _WIN32
+	printf("Checking format strings and %%.*s strings that end just before a PROT_NONE page:\n");
+	{long pg=sysconf(_SC_PAGESIZE);
+	 char *mem=mmap(NULL,2*pg,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+	 const char *ints[]={"%d","%5d","%-3x"},*strs[]={"%s","%.2s"}; /* conversions used in the random format strings, alternately ints and strings and at most 8 of them */
+	 static char f[300],buf[400],buf_ya[400];
+	 unsigned int start_serrs=serrs;
+	 int r,r_ya;
+	 scnt++;
+	 if(mem==MAP_FAILED || mprotect(mem+pg,pg,PROT_NONE)) {++serrs;printf("mmap() or mprotect() failed\n");}
+	 else
+	 	{for(int i=0;i<100000 && serrs-start_serrs<10;++i)
+	 	 	{int len=0,nconv=0,cnt=(int)(randu64()%300);
+	 	 	 char *fp;
+	 	 	 while(len<200 && randu64()%8)
+	 	 	 	{int k=(int)(randu64()%4);
+	 	 	 	 const char *c=NULL;
+	 	 	 	 if(k==0 && nconv<8) c=nconv++%2?strs[randu64()%2]:ints[randu64()%3];
+	 	 	 	 else if(k==1) c="%%";
+	 	 	 	 if(c) {strcpy(f+len,c);len+=(int)strlen(c);}
+	 	 	 	 else for(k=(int)(randu64()%40);k>0;--k) f[len++]=(char)('a'+randu64()%26); /* a literal run of up to 39 chars */
+	 	 	 	}
+	 	 	 f[len]=0;
+	 	 	 fp=mem+pg-len-1; /* the terminating 0 is the last readable byte */
+	 	 	 memcpy(fp,f,len+1);
+	 	 	 scnt++;
+	 	 	 r=snprintf(buf,cnt,fp,1,"ab",-22,"cde",333,"f",4444,"",55555,"ghij");
+	 	 	 r_ya=ya_s_snprintf(buf_ya,cnt,fp,1,"ab",-22,"cde",333,"f",4444,"",55555,"ghij");
+	 	 	 if(r!=r_ya || (cnt>0 && strcmp(buf,buf_ya))) {++serrs;printf("\"%s\": snprintf(%d) gives %d \"%s\", ya_s_snprintf(%d) gives %d \"%s\"\n",f,cnt,r,cnt?buf:"",cnt,r_ya,cnt?buf_ya:"");}
+	 	 	}
+	 	 memcpy(mem+pg-10,"0123456789",10); /* no terminating 0, which %.10s does not need */
+	 	 scnt++;
+	 	 for(int p=0;p<=10;++p)
+	 	 	{r_ya=ya_s_snprintf(buf_ya,sizeof(buf_ya),"%.10s|%.*s|%-12.10s|",mem+pg-10,p,mem+pg-p,mem+pg-10);
+	 	 	 r=snprintf(buf,sizeof(buf),"0123456789|%.*s|0123456789  |",p,"0123456789"+10-p);
+	 	 	 if(r!=r_ya || strcmp(buf,buf_ya)) {++serrs;printf("%%.10s of a string without a terminating 0 gives \"%s\", expected \"%s\"\n",buf_ya,buf);}
+	 	 	}
+	 	 munmap(mem,2*pg);
+	 	}
+	}
+	printf("Checking ya_s_dprintf() and ya_s_bprintf():\n");
+	{FILE *fp=tmpfile();
+	 static char expect[40000],got[40000],big[3000];
+	 char small[100];
+	 ya_s_dbuf b;
+	 int fd,n=0,r,len=0;
+	 memset(big,'b',sizeof(big)-1);
+	 scnt++;
+	 if(fp==NULL) {++serrs;printf("tmpfile() failed\n");}
+	 else
+	 	{fd=fileno(fp);
+	 	 len+=ya_s_sprintf(expect+len,"%s %d\n","dprintf",1);
+	 	 n+=ya_s_dprintf(fd,"%s %d\n","dprintf",1);
+	 	 len+=ya_s_sprintf(expect+len,"%s|%01000d\n",big,2);
+	 	 n+=ya_s_dprintf(fd,"%s|%01000d\n",big,2);
+	 	 ya_s_dbuf_init(&b,fd,small,sizeof(small)); /* a small buffer so lines straddle the end of it */
+	 	 for(int i=0;i<200;++i)
+	 	 	{len+=ya_s_sprintf(expect+len,"line %d %.*s %g\n",i,i%150,big,i*0.25);
+	 	 	 n+=ya_s_bprintf(&b,"line %d %.*s %g\n",i,i%150,big,i*0.25);
+	 	 	}
+	 	 len+=ya_s_sprintf(expect+len,"%s\n",big);
+	 	 n+=ya_s_bprintf(&b,"%s\n",big);
+	 	 if(ya_s_dbuf_flush(&b)) {++serrs;printf("ya_s_dbuf_flush() failed\n");}
+	 	 lseek(fd,0,SEEK_SET);
+	 	 r=(int)read(fd,got,sizeof(got));
+	 	 if(n!=len || r!=len || memcmp(got,expect,len)) {++serrs;printf("ya_s_dprintf()/ya_s_bprintf() wrote %d chars (returned %d), expected %d\n",r,n,len);}
+	 	 fclose(fp);
+	 	}
+	 scnt++;
+	 if(ya_s_dprintf(-1,"%d",1)!=-1) {++serrs;printf("ya_s_dprintf() to a bad file descriptor did not return -1\n");}
+	}
+#endif
+#ifdef __GLIBC__
+	printf("Checking ya_s_dprintf() and ya_s_fprintf() called from inside ya_s_fprintf():\n");
+	{FILE *fp=tmpfile(),*f=NULL;
+	 static char expect[4000],got[4000];
+	 nest_cookie_fns fns={NULL,nest_write,NULL,NULL};
+	 int len,n,r;
+	 nest_fp=tmpfile();
+	 scnt++;
+	 if(fp==NULL || nest_fp==NULL || (f=fopencookie(NULL,"w",fns))==NULL) {++serrs;printf("tmpfile() or fopencookie() failed\n");}
+	 else
+	 	{setvbuf(f,NULL,_IONBF,0); /* so ya_s_fprintf()'s fwrite() calls nest_write() at once */
+	 	 nest_fd=fileno(fp);
+	 	 nest_len=0;
+	 	 len=ya_s_sprintf(expect,"%s|%01000d|%g\n","outer",1,0.5);
+	 	 n=ya_s_fprintf(f,"%s|%01000d|%g\n","outer",1,0.5);
+	 	 fclose(f);
+	 	 if(n!=len || nest_len!=len || memcmp(nest_got,expect,len)) {++serrs;printf("ya_s_fprintf() output was overwritten by the calls made from its stream's write hook (%d chars written, %d expected)\n",nest_len,len);}
+	 	 for(int i=0;i<2;++i)
+	 	 	{scnt++;
+	 	 	 len=ya_s_sprintf(expect,"write of %d chars %0700d\n",n,7+i);
+	 	 	 if(i==1) fflush(nest_fp);
+	 	 	 lseek(i==0?nest_fd:fileno(nest_fp),0,SEEK_SET);
+	 	 	 r=(int)read(i==0?nest_fd:fileno(nest_fp),got,sizeof(got));
+	 	 	 if(r!=len || memcmp(got,expect,len)) {++serrs;printf("nested ya_s_%s() wrote %d chars, expected %d\n",i==0?"dprintf":"fprintf",r,len);}
+	 	 	}
+	 	}
+	 if(fp) fclose(fp);
+	 if(nest_fp) fclose(nest_fp);
+	}
+#endif
+#ifdef YA_SP_MPSC
+	printf("Checking ya_s_mpsc_printf():\n");
+	{FILE *fp=tmpfile();
+	 static char got[200000],expect[40000],big[20000],mem[1<<16];
+	 static int next[4];
+	 ya_s_mpsc r;
+	 pthread_t th[4];
+	 int fd,n=0,len,total=0,bad=0;
+	 scnt++;
+	 if(fp==NULL) {++serrs;printf("tmpfile() failed\n");}
+	 else
+	 	{fd=fileno(fp);
+	 	 memset(mpsc_long,'m',sizeof(mpsc_long)-1);
+	 	 ya_s_mpsc_init(&test_mpsc,fd,test_mpsc_mem+1,sizeof(test_mpsc_mem)-1); /* misaligned, and rounded down to 2048 bytes */
+	 	 mpsc_done=0;
+	 	 for(int t=0;t<4;++t) pthread_create(&th[t],NULL,mpsc_producer,(void *)(size_t)t);
+	 	 while(__atomic_load_n(&mpsc_done,__ATOMIC_ACQUIRE)<4) /* a writer thread, but the producers also write the ring out when it is full */
+	 	 	{int w=ya_s_mpsc_write(&test_mpsc);
+	 	 	 if(w<0) break;
+	 	 	 total+=w;
+	 	 	 if(w==0) sched_yield();
+	 	 	}
+	 	 for(int t=0;t<4;++t) pthread_join(th[t],NULL);
+	 	 ya_s_mpsc_write(&test_mpsc);
+	 	 /* every line of each thread, in order */
+	 	 lseek(fd,0,SEEK_SET);
+	 	 FILE *in=fdopen(dup(fd),"r");
+	 	 if(in==NULL) bad=1;
+	 	 else
+	 	 	{while(fgets(got,sizeof(got),in))
+	 	 	 	{int t,i,k=0;
+	 	 	 	 if(sscanf(got,"thread %d line %d %n",&t,&i,&k)!=2 || t<0 || t>3 || i!=next[t]++ || (int)strlen(got+k)!=(i%100==99?(int)sizeof(mpsc_long):0)) ++bad;
+	 	 	 	 ++n;
+	 	 	 	}
+	 	 	 fclose(in);
+	 	 	}
+	 	 if(bad || n!=20000 || test_mpsc.err || test_mpsc.head!=test_mpsc.tail) {++serrs;printf("ya_s_mpsc_printf() from 4 threads: %d lines read of 20000, %d wrong\n",n,bad);}
+	 	 /* output longer than YA_SP_IO_BUF is formatted straight into the ring, and longer than half the ring is refused */
+	 	 memset(big,'B',sizeof(big)-1);
+	 	 ftruncate(fd,0);
+	 	 lseek(fd,0,SEEK_SET);
+	 	 ya_s_mpsc_init(&r,fd,mem,sizeof(mem));
+	 	 len=ya_s_sprintf(expect,"%s|%d\n",big,5);
+	 	 scnt++;
+	 	 if(ya_s_mpsc_printf(&r,"%s|%d\n",big,5)!=len || ya_s_mpsc_printf(&r,"%s%s",big,big)!=-1 || ya_s_mpsc_write(&r)!=len)
+	 	 	{++serrs;printf("ya_s_mpsc_printf() of long lines failed\n");}
+	 	 lseek(fd,0,SEEK_SET);
+	 	 scnt++;
+	 	 if(read(fd,got,sizeof(got))!=len || memcmp(got,expect,len)) {++serrs;printf("ya_s_mpsc_printf() of a long line wrote the wrong output\n");}
+	 	 fclose(fp);
+	 	}
+	}
+#endif
+	printf("Checking ya_s_locale:\n");
+	{ya_s_locale lc={'_',',',3,"Infinity","NaN"};
+	 static const ya_s_locale de={'.',',',3,NULL,NULL};
+	 char buf[200];
+	 int bad=0;
+	 for(int g=1;g<=9;++g)
+	 	{lc.grouping=(unsigned char)g;
+	 	 for(int i=0;i<300;++i)
+	 	 	{uint64_t u=(i*0x9E3779B97F4A7C15ULL)>>(i%64);
+	 	 	 double d=(double)u/(1+i%7)*((i&1)?-1:1);
+	 	 	 bad+=check_grouped(&lc,"%'d","%d",(int)u);
+	 	 	 bad+=check_grouped(&lc,"%'llu","%llu",(unsigned long long)u);
+	 	 	 bad+=check_grouped(&lc,"%'lld","%lld",(long long)u);
+	 	 	 bad+=check_grouped(&lc,"%'.3f","%.3f",d);
+	 	 	 bad+=check_grouped(&lc,"%'.0f","%.0f",d*1e10);
+	 	 	 bad+=check_grouped(&lc,"%'f","%f",d*1e200); /* zeros past the digits kept */
+#ifdef YA_SP_SPRINTF_LD
+	 	 	 bad+=check_grouped(&lc,"%'.2Lf","%.2Lf",(long double)d*1e30L);
+#endif
+#ifdef YA_SP_SPRINTF_Q
+	 	 	 bad+=check_grouped(&lc,"%'I128d","%I128d",(int128_t)u*(int128_t)u*((i&1)?-1:1));
+	 	 	 bad+=check_grouped(&lc,"%'.1Qf","%.1Qf",(__float128)d);
+#endif
+	 	 	 scnt+=9;
+	 	 	}
+	 	 ya_s_set_locale(&lc);
+	 	 scnt++;
+	 	 if(ya_s_format_length("%'d %'lld",-1234567,123456789012345LL)!=ya_s_sprintf(buf,"%'d %'lld",-1234567,123456789012345LL)) {++bad;printf("ya_s_format_length() with grouping %d gave a different length\n",g);}
+	 	 ya_s_set_locale(NULL);
+	 	}
+	 lc.grouping=4;
+	 ya_s_set_locale(&lc);
+	 ya_s_sprintf(buf,"%'020d|%'.2f|%f|%E|%e|%5.1f|%.3f",-12345,0.5,INFINITY,-INFINITY,NAN,INFINITY,1.0);
+	 scnt++;
+	 if(strcmp(buf,"-0000_0000_0001_2345|0,50|Infinity|-Infinity|NaN|Infinity|1,000")) {++bad;printf("ya_s_locale: got \"%s\"\n",buf);}
+	 lc.grouping=0; /* 3 */
+	 ya_s_sprintf(buf,"%'d",1234567);
+	 scnt++;
+	 if(strcmp(buf,"1_234_567")) {++bad;printf("ya_s_locale with grouping 0: got \"%s\"\n",buf);}
+	 scnt++;
+	 if(ya_s_set_locale(NULL)!=&lc) {++bad;printf("ya_s_set_locale() did not return the previous locale\n");}
+	 /* for one call only */
+	 loc_sprintf(buf,&de,"%'.2f",1234.5);
+	 scnt++;
+	 if(strcmp(buf,"1.234,50")) {++bad;printf("ya_s_vsprintfcb_locale(): got \"%s\"\n",buf);}
+	 ya_s_sprintf(buf,"%'.2f",1234.5);
+	 scnt++;
+	 if(strcmp(buf,"1,234.50")) {++bad;printf("ya_s_vsprintfcb_locale() changed the default locale: got \"%s\"\n",buf);}
+#ifndef _WIN32
+	 {pthread_t th[2];
+	  void *r0,*r1;
+	  pthread_create(&th[0],NULL,locale_thread,(void *)&de);
+	  pthread_create(&th[1],NULL,locale_thread,(void *)&lc);
+	  pthread_join(th[0],&r0);
+	  pthread_join(th[1],&r1);
+	  scnt++;
+	  if(r0 || r1) {++bad;printf("ya_s_set_locale() in 2 threads at once: %zu and %zu wrong\n",(size_t)r0,(size_t)r1);}
+	 }
+#endif
+	 serrs+=bad;
+	}
 	printf("Now checking ya_printf():\n");
 	{
 #ifdef YA_SP_SPRINTF_Q /* 128 bit variables (int  & float) supported by compiler */	
@@ -4767,10 +6554,44 @@ int main(int argc, char *argv[])
   time_taken=read_HR_Timer();
   printf("PART2: All tests completed in %g secs\n",time_taken);  
 #endif  
+#ifdef YA_SP_FORMAT_CACHE_STATS
+  {unsigned long long hits,misses;
+   ya_s_format_cache_stats(&hits,&misses);
+   printf("PART2: format cache %llu hits %llu misses\n",hits,misses);
+  }
+#endif
   if(serrs==0)
 		printf("PART2: %u sprintf tests completed, no errors found\n",scnt);
   else	
 		printf("PART2: %u sprintf tests completed, %u errors found (%u errors expected)\n",scnt,serrs,expected_errs);
 #endif 	  	  
+#if defined(PART3_SPRINTF_BENCHMARKS) && defined(YA_SP_SPRINTF_IMPLEMENTATION)
+  printf("Starting PART3 sprintf benchmarks:\n");
+  bench_compiled_format();
+  bench_format_length();
+  bench_asprintf();
+  bench_literals();
+  bench_padding();
+  bench_integers();
+  bench_shortest();
+  bench_doubles();
+  bench_cold_cache();
+  bench_chunk_size();
+#ifndef _WIN32
+  bench_fd();
+#endif
+#if defined(YA_SP_LOG) && !defined(_WIN32)
+  bench_log();
+#endif
+#ifdef YA_SP_MPSC
+  bench_mpsc();
+#endif
+#ifdef YA_SP_SPRINTF_LD
+  bench_long_double();
+#endif
+#ifdef YA_SP_SPRINTF_Q
+  bench_float128();
+#endif
+#endif
   return 0;
 }
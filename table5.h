@@ -0,0 +1,1168 @@
+/* This file was automatically created by a short python script that computes 5^i and 2^k/5^i with exact integer arithmetic */
+/*
+------------------------------------------------------------------------------
+This software is available under 2 licenses -- choose whichever you prefer.
+------------------------------------------------------------------------------
+ALTERNATIVE A - MIT License
+Copyright (c) 2020 Peter Miller
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+of the Software, and to permit persons to whom the Software is furnished to do
+so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+------------------------------------------------------------------------------
+ALTERNATIVE B - Public Domain (www.unlicense.org)
+This is free and unencumbered software released into the public domain.
+Anyone is free to copy, modify, publish, use, compile, sell, or distribute this
+software, either in source code form or as a compiled binary, for any purpose,
+commercial or non-commercial, and by any means.
+In jurisdictions that recognize copyright laws, the author or authors of this
+software dedicate any and all copyright interest in the software to the public
+domain. We make this dedication for the benefit of the public at large and to
+the detriment of our heirs and successors. We intend this dedication to be an
+overt act of relinquishment in perpetuity of all present and future rights to
+this software under copyright law.
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION
+WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+------------------------------------------------------------------------------
+*/
+
+#ifndef TABLE5_H_INCLUDE
+#define TABLE5_H_INCLUDE
+/* tables for the shortest round trip conversion of a double (%r) in ya_sprintf.h
+   ya_s__pow5_split[i] is 5^i normalised to exactly 125 bits (5^i >> (bitlength(5^i)-125)), i=0..342
+   ya_s__pow5_inv_split[i] is 2^(bitlength(5^i)-1+125)/5^i +1, i=0..341
+   each entry is { low 64 bits, high 64 bits }
+*/
+#define YA_S__POW5_BITCOUNT 125
+#define YA_S__POW5_INV_BITCOUNT 125
+static const uint64_t ya_s__pow5_split[343][2] = /* 5^i to 125 bits */
+  {
+   { UINT64_C(0), UINT64_C(1152921504606846976) }, // 0
+   { UINT64_C(0), UINT64_C(1441151880758558720) }, // 1
+   { UINT64_C(0), UINT64_C(1801439850948198400) }, // 2
+   { UINT64_C(0), UINT64_C(2251799813685248000) }, // 3
+   { UINT64_C(0), UINT64_C(1407374883553280000) }, // 4
+   { UINT64_C(0), UINT64_C(1759218604441600000) }, // 5
+   { UINT64_C(0), UINT64_C(2199023255552000000) }, // 6
+   { UINT64_C(0), UINT64_C(1374389534720000000) }, // 7
+   { UINT64_C(0), UINT64_C(1717986918400000000) }, // 8
+   { UINT64_C(0), UINT64_C(2147483648000000000) }, // 9
+   { UINT64_C(0), UINT64_C(1342177280000000000) }, // 10
+   { UINT64_C(0), UINT64_C(1677721600000000000) }, // 11
+   { UINT64_C(0), UINT64_C(2097152000000000000) }, // 12
+   { UINT64_C(0), UINT64_C(1310720000000000000) }, // 13
+   { UINT64_C(0), UINT64_C(1638400000000000000) }, // 14
+   { UINT64_C(0), UINT64_C(2048000000000000000) }, // 15
+   { UINT64_C(0), UINT64_C(1280000000000000000) }, // 16
+   { UINT64_C(0), UINT64_C(1600000000000000000) }, // 17
+   { UINT64_C(0), UINT64_C(2000000000000000000) }, // 18
+   { UINT64_C(0), UINT64_C(1250000000000000000) }, // 19
+   { UINT64_C(0), UINT64_C(1562500000000000000) }, // 20
+   { UINT64_C(0), UINT64_C(1953125000000000000) }, // 21
+   { UINT64_C(0), UINT64_C(1220703125000000000) }, // 22
+   { UINT64_C(0), UINT64_C(1525878906250000000) }, // 23
+   { UINT64_C(0), UINT64_C(1907348632812500000) }, // 24
+   { UINT64_C(0), UINT64_C(1192092895507812500) }, // 25
+   { UINT64_C(0), UINT64_C(1490116119384765625) }, // 26
+   { UINT64_C(4611686018427387904), UINT64_C(1862645149230957031) }, // 27
+   { UINT64_C(9799832789158199296), UINT64_C(1164153218269348144) }, // 28
+   { UINT64_C(12249790986447749120), UINT64_C(1455191522836685180) }, // 29
+   { UINT64_C(15312238733059686400), UINT64_C(1818989403545856475) }, // 30
+   { UINT64_C(14528612397897220096), UINT64_C(2273736754432320594) }, // 31
+   { UINT64_C(13692068767113150464), UINT64_C(1421085471520200371) }, // 32
+   { UINT64_C(12503399940464050176), UINT64_C(1776356839400250464) }, // 33
+   { UINT64_C(15629249925580062720), UINT64_C(2220446049250313080) }, // 34
+   { UINT64_C(9768281203487539200), UINT64_C(1387778780781445675) }, // 35
+   { UINT64_C(7598665485932036096), UINT64_C(1734723475976807094) }, // 36
+   { UINT64_C(274959820560269312), UINT64_C(2168404344971008868) }, // 37
+   { UINT64_C(9395221924704944128), UINT64_C(1355252715606880542) }, // 38
+   { UINT64_C(2520655369026404352), UINT64_C(1694065894508600678) }, // 39
+   { UINT64_C(12374191248137781248), UINT64_C(2117582368135750847) }, // 40
+   { UINT64_C(14651398557727195136), UINT64_C(1323488980084844279) }, // 41
+   { UINT64_C(13702562178731606016), UINT64_C(1654361225106055349) }, // 42
+   { UINT64_C(3293144668132343808), UINT64_C(2067951531382569187) }, // 43
+   { UINT64_C(18199116482078572544), UINT64_C(1292469707114105741) }, // 44
+   { UINT64_C(8913837547316051968), UINT64_C(1615587133892632177) }, // 45
+   { UINT64_C(15753982952572452864), UINT64_C(2019483917365790221) }, // 46
+   { UINT64_C(12152082354571476992), UINT64_C(1262177448353618888) }, // 47
+   { UINT64_C(15190102943214346240), UINT64_C(1577721810442023610) }, // 48
+   { UINT64_C(9764256642163156992), UINT64_C(1972152263052529513) }, // 49
+   { UINT64_C(17631875447420442880), UINT64_C(1232595164407830945) }, // 50
+   { UINT64_C(8204786253993389888), UINT64_C(1540743955509788682) }, // 51
+   { UINT64_C(1032610780636961552), UINT64_C(1925929944387235853) }, // 52
+   { UINT64_C(2951224747111794922), UINT64_C(1203706215242022408) }, // 53
+   { UINT64_C(3689030933889743652), UINT64_C(1504632769052528010) }, // 54
+   { UINT64_C(13834660704216955373), UINT64_C(1880790961315660012) }, // 55
+   { UINT64_C(17870034976990372916), UINT64_C(1175494350822287507) }, // 56
+   { UINT64_C(17725857702810578241), UINT64_C(1469367938527859384) }, // 57
+   { UINT64_C(3710578054803671186), UINT64_C(1836709923159824231) }, // 58
+   { UINT64_C(26536550077201078), UINT64_C(2295887403949780289) }, // 59
+   { UINT64_C(11545800389866720434), UINT64_C(1434929627468612680) }, // 60
+   { UINT64_C(14432250487333400542), UINT64_C(1793662034335765850) }, // 61
+   { UINT64_C(8816941072311974870), UINT64_C(2242077542919707313) }, // 62
+   { UINT64_C(17039803216263454053), UINT64_C(1401298464324817070) }, // 63
+   { UINT64_C(12076381983474541759), UINT64_C(1751623080406021338) }, // 64
+   { UINT64_C(5872105442488401391), UINT64_C(2189528850507526673) }, // 65
+   { UINT64_C(15199280947623720629), UINT64_C(1368455531567204170) }, // 66
+   { UINT64_C(9775729147674874978), UINT64_C(1710569414459005213) }, // 67
+   { UINT64_C(16831347453020981627), UINT64_C(2138211768073756516) }, // 68
+   { UINT64_C(1296220121283337709), UINT64_C(1336382355046097823) }, // 69
+   { UINT64_C(15455333206886335848), UINT64_C(1670477943807622278) }, // 70
+   { UINT64_C(10095794471753144002), UINT64_C(2088097429759527848) }, // 71
+   { UINT64_C(6309871544845715001), UINT64_C(1305060893599704905) }, // 72
+   { UINT64_C(12499025449484531656), UINT64_C(1631326116999631131) }, // 73
+   { UINT64_C(11012095793428276666), UINT64_C(2039157646249538914) }, // 74
+   { UINT64_C(11494245889320060820), UINT64_C(1274473528905961821) }, // 75
+   { UINT64_C(532749306367912313), UINT64_C(1593091911132452277) }, // 76
+   { UINT64_C(5277622651387278295), UINT64_C(1991364888915565346) }, // 77
+   { UINT64_C(7910200175544436838), UINT64_C(1244603055572228341) }, // 78
+   { UINT64_C(14499436237857933952), UINT64_C(1555753819465285426) }, // 79
+   { UINT64_C(8900923260467641632), UINT64_C(1944692274331606783) }, // 80
+   { UINT64_C(12480606065433357876), UINT64_C(1215432671457254239) }, // 81
+   { UINT64_C(10989071563364309441), UINT64_C(1519290839321567799) }, // 82
+   { UINT64_C(9124653435777998898), UINT64_C(1899113549151959749) }, // 83
+   { UINT64_C(8008751406574943263), UINT64_C(1186945968219974843) }, // 84
+   { UINT64_C(5399253239791291175), UINT64_C(1483682460274968554) }, // 85
+   { UINT64_C(15972438586593889776), UINT64_C(1854603075343710692) }, // 86
+   { UINT64_C(759402079766405302), UINT64_C(1159126922089819183) }, // 87
+   { UINT64_C(14784310654990170340), UINT64_C(1448908652612273978) }, // 88
+   { UINT64_C(9257016281882937117), UINT64_C(1811135815765342473) }, // 89
+   { UINT64_C(16182956370781059300), UINT64_C(2263919769706678091) }, // 90
+   { UINT64_C(7808504722524468110), UINT64_C(1414949856066673807) }, // 91
+   { UINT64_C(5148944884728197234), UINT64_C(1768687320083342259) }, // 92
+   { UINT64_C(1824495087482858639), UINT64_C(2210859150104177824) }, // 93
+   { UINT64_C(1140309429676786649), UINT64_C(1381786968815111140) }, // 94
+   { UINT64_C(1425386787095983311), UINT64_C(1727233711018888925) }, // 95
+   { UINT64_C(6393419502297367043), UINT64_C(2159042138773611156) }, // 96
+   { UINT64_C(13219259225790630210), UINT64_C(1349401336733506972) }, // 97
+   { UINT64_C(16524074032238287762), UINT64_C(1686751670916883715) }, // 98
+   { UINT64_C(16043406521870471799), UINT64_C(2108439588646104644) }, // 99
+   { UINT64_C(803757039314269066), UINT64_C(1317774742903815403) }, // 100
+   { UINT64_C(14839754354425000045), UINT64_C(1647218428629769253) }, // 101
+   { UINT64_C(4714634887749086344), UINT64_C(2059023035787211567) }, // 102
+   { UINT64_C(9864175832484260821), UINT64_C(1286889397367007229) }, // 103
+   { UINT64_C(16941905809032713930), UINT64_C(1608611746708759036) }, // 104
+   { UINT64_C(2730638187581340797), UINT64_C(2010764683385948796) }, // 105
+   { UINT64_C(10930020904093113806), UINT64_C(1256727927116217997) }, // 106
+   { UINT64_C(18274212148543780162), UINT64_C(1570909908895272496) }, // 107
+   { UINT64_C(4396021111970173586), UINT64_C(1963637386119090621) }, // 108
+   { UINT64_C(5053356204195052443), UINT64_C(1227273366324431638) }, // 109
+   { UINT64_C(15540067292098591362), UINT64_C(1534091707905539547) }, // 110
+   { UINT64_C(14813398096695851299), UINT64_C(1917614634881924434) }, // 111
+   { UINT64_C(13870059828862294966), UINT64_C(1198509146801202771) }, // 112
+   { UINT64_C(12725888767650480803), UINT64_C(1498136433501503464) }, // 113
+   { UINT64_C(15907360959563101004), UINT64_C(1872670541876879330) }, // 114
+   { UINT64_C(14553786618154326031), UINT64_C(1170419088673049581) }, // 115
+   { UINT64_C(4357175217410743827), UINT64_C(1463023860841311977) }, // 116
+   { UINT64_C(10058155040190817688), UINT64_C(1828779826051639971) }, // 117
+   { UINT64_C(7961007781811134206), UINT64_C(2285974782564549964) }, // 118
+   { UINT64_C(14199001900486734687), UINT64_C(1428734239102843727) }, // 119
+   { UINT64_C(13137066357181030455), UINT64_C(1785917798878554659) }, // 120
+   { UINT64_C(11809646928048900164), UINT64_C(2232397248598193324) }, // 121
+   { UINT64_C(16604401366885338411), UINT64_C(1395248280373870827) }, // 122
+   { UINT64_C(16143815690179285109), UINT64_C(1744060350467338534) }, // 123
+   { UINT64_C(10956397575869330579), UINT64_C(2180075438084173168) }, // 124
+   { UINT64_C(6847748484918331612), UINT64_C(1362547148802608230) }, // 125
+   { UINT64_C(17783057643002690323), UINT64_C(1703183936003260287) }, // 126
+   { UINT64_C(17617136035325974999), UINT64_C(2128979920004075359) }, // 127
+   { UINT64_C(17928239049719816230), UINT64_C(1330612450002547099) }, // 128
+   { UINT64_C(17798612793722382384), UINT64_C(1663265562503183874) }, // 129
+   { UINT64_C(13024893955298202172), UINT64_C(2079081953128979843) }, // 130
+   { UINT64_C(5834715712847682405), UINT64_C(1299426220705612402) }, // 131
+   { UINT64_C(16516766677914378815), UINT64_C(1624282775882015502) }, // 132
+   { UINT64_C(11422586310538197711), UINT64_C(2030353469852519378) }, // 133
+   { UINT64_C(11750802462513761473), UINT64_C(1268970918657824611) }, // 134
+   { UINT64_C(10076817059714813937), UINT64_C(1586213648322280764) }, // 135
+   { UINT64_C(12596021324643517422), UINT64_C(1982767060402850955) }, // 136
+   { UINT64_C(5566670318688504437), UINT64_C(1239229412751781847) }, // 137
+   { UINT64_C(2346651879933242642), UINT64_C(1549036765939727309) }, // 138
+   { UINT64_C(7545000868343941206), UINT64_C(1936295957424659136) }, // 139
+   { UINT64_C(4715625542714963254), UINT64_C(1210184973390411960) }, // 140
+   { UINT64_C(5894531928393704067), UINT64_C(1512731216738014950) }, // 141
+   { UINT64_C(16591536947346905892), UINT64_C(1890914020922518687) }, // 142
+   { UINT64_C(17287239619732898039), UINT64_C(1181821263076574179) }, // 143
+   { UINT64_C(16997363506238734644), UINT64_C(1477276578845717724) }, // 144
+   { UINT64_C(2799960309088866689), UINT64_C(1846595723557147156) }, // 145
+   { UINT64_C(10973347230035317489), UINT64_C(1154122327223216972) }, // 146
+   { UINT64_C(13716684037544146861), UINT64_C(1442652909029021215) }, // 147
+   { UINT64_C(12534169028502795672), UINT64_C(1803316136286276519) }, // 148
+   { UINT64_C(11056025267201106687), UINT64_C(2254145170357845649) }, // 149
+   { UINT64_C(18439230838069161439), UINT64_C(1408840731473653530) }, // 150
+   { UINT64_C(13825666510731675991), UINT64_C(1761050914342066913) }, // 151
+   { UINT64_C(3447025083132431277), UINT64_C(2201313642927583642) }, // 152
+   { UINT64_C(6766076695385157452), UINT64_C(1375821026829739776) }, // 153
+   { UINT64_C(8457595869231446815), UINT64_C(1719776283537174720) }, // 154
+   { UINT64_C(10571994836539308519), UINT64_C(2149720354421468400) }, // 155
+   { UINT64_C(6607496772837067824), UINT64_C(1343575221513417750) }, // 156
+   { UINT64_C(17482743002901110588), UINT64_C(1679469026891772187) }, // 157
+   { UINT64_C(17241742735199000331), UINT64_C(2099336283614715234) }, // 158
+   { UINT64_C(15387775227926763111), UINT64_C(1312085177259197021) }, // 159
+   { UINT64_C(5399660979626290177), UINT64_C(1640106471573996277) }, // 160
+   { UINT64_C(11361262242960250625), UINT64_C(2050133089467495346) }, // 161
+   { UINT64_C(11712474920277544544), UINT64_C(1281333180917184591) }, // 162
+   { UINT64_C(10028907631919542777), UINT64_C(1601666476146480739) }, // 163
+   { UINT64_C(7924448521472040567), UINT64_C(2002083095183100924) }, // 164
+   { UINT64_C(14176152362774801162), UINT64_C(1251301934489438077) }, // 165
+   { UINT64_C(3885132398186337741), UINT64_C(1564127418111797597) }, // 166
+   { UINT64_C(9468101516160310080), UINT64_C(1955159272639746996) }, // 167
+   { UINT64_C(15140935484454969608), UINT64_C(1221974545399841872) }, // 168
+   { UINT64_C(479425281859160394), UINT64_C(1527468181749802341) }, // 169
+   { UINT64_C(5210967620751338397), UINT64_C(1909335227187252926) }, // 170
+   { UINT64_C(17091912818251750210), UINT64_C(1193334516992033078) }, // 171
+   { UINT64_C(12141518985959911954), UINT64_C(1491668146240041348) }, // 172
+   { UINT64_C(15176898732449889943), UINT64_C(1864585182800051685) }, // 173
+   { UINT64_C(11791404716994875166), UINT64_C(1165365739250032303) }, // 174
+   { UINT64_C(10127569877816206054), UINT64_C(1456707174062540379) }, // 175
+   { UINT64_C(8047776328842869663), UINT64_C(1820883967578175474) }, // 176
+   { UINT64_C(836348374198811271), UINT64_C(2276104959472719343) }, // 177
+   { UINT64_C(7440246761515338900), UINT64_C(1422565599670449589) }, // 178
+   { UINT64_C(13911994470321561530), UINT64_C(1778206999588061986) }, // 179
+   { UINT64_C(8166621051047176104), UINT64_C(2222758749485077483) }, // 180
+   { UINT64_C(2798295147690791113), UINT64_C(1389224218428173427) }, // 181
+   { UINT64_C(17332926989895652603), UINT64_C(1736530273035216783) }, // 182
+   { UINT64_C(17054472718942177850), UINT64_C(2170662841294020979) }, // 183
+   { UINT64_C(8353202440125167204), UINT64_C(1356664275808763112) }, // 184
+   { UINT64_C(10441503050156459005), UINT64_C(1695830344760953890) }, // 185
+   { UINT64_C(3828506775840797949), UINT64_C(2119787930951192363) }, // 186
+   { UINT64_C(86973725686804766), UINT64_C(1324867456844495227) }, // 187
+   { UINT64_C(13943775212390669669), UINT64_C(1656084321055619033) }, // 188
+   { UINT64_C(3594660960206173375), UINT64_C(2070105401319523792) }, // 189
+   { UINT64_C(2246663100128858359), UINT64_C(1293815875824702370) }, // 190
+   { UINT64_C(12031700912015848757), UINT64_C(1617269844780877962) }, // 191
+   { UINT64_C(5816254103165035138), UINT64_C(2021587305976097453) }, // 192
+   { UINT64_C(5941001823691840913), UINT64_C(1263492066235060908) }, // 193
+   { UINT64_C(7426252279614801142), UINT64_C(1579365082793826135) }, // 194
+   { UINT64_C(4671129331091113523), UINT64_C(1974206353492282669) }, // 195
+   { UINT64_C(5225298841145639904), UINT64_C(1233878970932676668) }, // 196
+   { UINT64_C(6531623551432049880), UINT64_C(1542348713665845835) }, // 197
+   { UINT64_C(3552843420862674446), UINT64_C(1927935892082307294) }, // 198
+   { UINT64_C(16055585193321335241), UINT64_C(1204959932551442058) }, // 199
+   { UINT64_C(10846109454796893243), UINT64_C(1506199915689302573) }, // 200
+   { UINT64_C(18169322836923504458), UINT64_C(1882749894611628216) }, // 201
+   { UINT64_C(11355826773077190286), UINT64_C(1176718684132267635) }, // 202
+   { UINT64_C(9583097447919099954), UINT64_C(1470898355165334544) }, // 203
+   { UINT64_C(11978871809898874942), UINT64_C(1838622943956668180) }, // 204
+   { UINT64_C(14973589762373593678), UINT64_C(2298278679945835225) }, // 205
+   { UINT64_C(2440964573842414192), UINT64_C(1436424174966147016) }, // 206
+   { UINT64_C(3051205717303017741), UINT64_C(1795530218707683770) }, // 207
+   { UINT64_C(13037379183483547984), UINT64_C(2244412773384604712) }, // 208
+   { UINT64_C(8148361989677217490), UINT64_C(1402757983365377945) }, // 209
+   { UINT64_C(14797138505523909766), UINT64_C(1753447479206722431) }, // 210
+   { UINT64_C(13884737113477499304), UINT64_C(2191809349008403039) }, // 211
+   { UINT64_C(15595489723564518921), UINT64_C(1369880843130251899) }, // 212
+   { UINT64_C(14882676136028260747), UINT64_C(1712351053912814874) }, // 213
+   { UINT64_C(9379973133180550126), UINT64_C(2140438817391018593) }, // 214
+   { UINT64_C(17391698254306313589), UINT64_C(1337774260869386620) }, // 215
+   { UINT64_C(3292878744173340370), UINT64_C(1672217826086733276) }, // 216
+   { UINT64_C(4116098430216675462), UINT64_C(2090272282608416595) }, // 217
+   { UINT64_C(266718509671728212), UINT64_C(1306420176630260372) }, // 218
+   { UINT64_C(333398137089660265), UINT64_C(1633025220787825465) }, // 219
+   { UINT64_C(5028433689789463235), UINT64_C(2041281525984781831) }, // 220
+   { UINT64_C(10060300083759496378), UINT64_C(1275800953740488644) }, // 221
+   { UINT64_C(12575375104699370472), UINT64_C(1594751192175610805) }, // 222
+   { UINT64_C(1884160825592049379), UINT64_C(1993438990219513507) }, // 223
+   { UINT64_C(17318501580490888525), UINT64_C(1245899368887195941) }, // 224
+   { UINT64_C(7813068920331446945), UINT64_C(1557374211108994927) }, // 225
+   { UINT64_C(5154650131986920777), UINT64_C(1946717763886243659) }, // 226
+   { UINT64_C(915813323278131534), UINT64_C(1216698602428902287) }, // 227
+   { UINT64_C(14979824709379828129), UINT64_C(1520873253036127858) }, // 228
+   { UINT64_C(9501408849870009354), UINT64_C(1901091566295159823) }, // 229
+   { UINT64_C(12855909558809837702), UINT64_C(1188182228934474889) }, // 230
+   { UINT64_C(2234828893230133415), UINT64_C(1485227786168093612) }, // 231
+   { UINT64_C(2793536116537666769), UINT64_C(1856534732710117015) }, // 232
+   { UINT64_C(8663489100477123587), UINT64_C(1160334207943823134) }, // 233
+   { UINT64_C(1605989338741628675), UINT64_C(1450417759929778918) }, // 234
+   { UINT64_C(11230858710281811652), UINT64_C(1813022199912223647) }, // 235
+   { UINT64_C(9426887369424876662), UINT64_C(2266277749890279559) }, // 236
+   { UINT64_C(12809333633531629769), UINT64_C(1416423593681424724) }, // 237
+   { UINT64_C(16011667041914537212), UINT64_C(1770529492101780905) }, // 238
+   { UINT64_C(6179525747111007803), UINT64_C(2213161865127226132) }, // 239
+   { UINT64_C(13085575628799155685), UINT64_C(1383226165704516332) }, // 240
+   { UINT64_C(16356969535998944606), UINT64_C(1729032707130645415) }, // 241
+   { UINT64_C(15834525901571292854), UINT64_C(2161290883913306769) }, // 242
+   { UINT64_C(2979049660840976177), UINT64_C(1350806802445816731) }, // 243
+   { UINT64_C(17558870131333383934), UINT64_C(1688508503057270913) }, // 244
+   { UINT64_C(8113529608884566205), UINT64_C(2110635628821588642) }, // 245
+   { UINT64_C(9682642023980241782), UINT64_C(1319147268013492901) }, // 246
+   { UINT64_C(16714988548402690132), UINT64_C(1648934085016866126) }, // 247
+   { UINT64_C(11670363648648586857), UINT64_C(2061167606271082658) }, // 248
+   { UINT64_C(11905663298832754689), UINT64_C(1288229753919426661) }, // 249
+   { UINT64_C(1047021068258779650), UINT64_C(1610287192399283327) }, // 250
+   { UINT64_C(15143834390605638274), UINT64_C(2012858990499104158) }, // 251
+   { UINT64_C(4853210475701136017), UINT64_C(1258036869061940099) }, // 252
+   { UINT64_C(1454827076199032118), UINT64_C(1572546086327425124) }, // 253
+   { UINT64_C(1818533845248790147), UINT64_C(1965682607909281405) }, // 254
+   { UINT64_C(3442426662494187794), UINT64_C(1228551629943300878) }, // 255
+   { UINT64_C(13526405364972510550), UINT64_C(1535689537429126097) }, // 256
+   { UINT64_C(3072948650933474476), UINT64_C(1919611921786407622) }, // 257
+   { UINT64_C(15755650962115585259), UINT64_C(1199757451116504763) }, // 258
+   { UINT64_C(15082877684217093670), UINT64_C(1499696813895630954) }, // 259
+   { UINT64_C(9630225068416591280), UINT64_C(1874621017369538693) }, // 260
+   { UINT64_C(8324733676974063502), UINT64_C(1171638135855961683) }, // 261
+   { UINT64_C(5794231077790191473), UINT64_C(1464547669819952104) }, // 262
+   { UINT64_C(7242788847237739342), UINT64_C(1830684587274940130) }, // 263
+   { UINT64_C(18276858095901949986), UINT64_C(2288355734093675162) }, // 264
+   { UINT64_C(16034722328366106645), UINT64_C(1430222333808546976) }, // 265
+   { UINT64_C(1596658836748081690), UINT64_C(1787777917260683721) }, // 266
+   { UINT64_C(6607509564362490017), UINT64_C(2234722396575854651) }, // 267
+   { UINT64_C(1823850468512862308), UINT64_C(1396701497859909157) }, // 268
+   { UINT64_C(6891499104068465790), UINT64_C(1745876872324886446) }, // 269
+   { UINT64_C(17837745916940358045), UINT64_C(2182346090406108057) }, // 270
+   { UINT64_C(4231062170446641922), UINT64_C(1363966306503817536) }, // 271
+   { UINT64_C(5288827713058302403), UINT64_C(1704957883129771920) }, // 272
+   { UINT64_C(6611034641322878003), UINT64_C(2131197353912214900) }, // 273
+   { UINT64_C(13355268687681574560), UINT64_C(1331998346195134312) }, // 274
+   { UINT64_C(16694085859601968200), UINT64_C(1664997932743917890) }, // 275
+   { UINT64_C(11644235287647684442), UINT64_C(2081247415929897363) }, // 276
+   { UINT64_C(4971804045566108824), UINT64_C(1300779634956185852) }, // 277
+   { UINT64_C(6214755056957636030), UINT64_C(1625974543695232315) }, // 278
+   { UINT64_C(3156757802769657134), UINT64_C(2032468179619040394) }, // 279
+   { UINT64_C(6584659645158423613), UINT64_C(1270292612261900246) }, // 280
+   { UINT64_C(17454196593302805324), UINT64_C(1587865765327375307) }, // 281
+   { UINT64_C(17206059723201118751), UINT64_C(1984832206659219134) }, // 282
+   { UINT64_C(6142101308573311315), UINT64_C(1240520129162011959) }, // 283
+   { UINT64_C(3065940617289251240), UINT64_C(1550650161452514949) }, // 284
+   { UINT64_C(8444111790038951954), UINT64_C(1938312701815643686) }, // 285
+   { UINT64_C(665883850346957067), UINT64_C(1211445438634777304) }, // 286
+   { UINT64_C(832354812933696334), UINT64_C(1514306798293471630) }, // 287
+   { UINT64_C(10263815553021896226), UINT64_C(1892883497866839537) }, // 288
+   { UINT64_C(17944099766707154901), UINT64_C(1183052186166774710) }, // 289
+   { UINT64_C(13206752671529167818), UINT64_C(1478815232708468388) }, // 290
+   { UINT64_C(16508440839411459773), UINT64_C(1848519040885585485) }, // 291
+   { UINT64_C(12623618533845856310), UINT64_C(1155324400553490928) }, // 292
+   { UINT64_C(15779523167307320387), UINT64_C(1444155500691863660) }, // 293
+   { UINT64_C(1277659885424598868), UINT64_C(1805194375864829576) }, // 294
+   { UINT64_C(1597074856780748586), UINT64_C(2256492969831036970) }, // 295
+   { UINT64_C(5609857803915355770), UINT64_C(1410308106144398106) }, // 296
+   { UINT64_C(16235694291748970521), UINT64_C(1762885132680497632) }, // 297
+   { UINT64_C(1847873790976661535), UINT64_C(2203606415850622041) }, // 298
+   { UINT64_C(12684136165428883219), UINT64_C(1377254009906638775) }, // 299
+   { UINT64_C(11243484188358716120), UINT64_C(1721567512383298469) }, // 300
+   { UINT64_C(219297180166231438), UINT64_C(2151959390479123087) }, // 301
+   { UINT64_C(7054589765244976505), UINT64_C(1344974619049451929) }, // 302
+   { UINT64_C(13429923224983608535), UINT64_C(1681218273811814911) }, // 303
+   { UINT64_C(12175718012802122765), UINT64_C(2101522842264768639) }, // 304
+   { UINT64_C(14527352785642408584), UINT64_C(1313451776415480399) }, // 305
+   { UINT64_C(13547504963625622826), UINT64_C(1641814720519350499) }, // 306
+   { UINT64_C(12322695186104640628), UINT64_C(2052268400649188124) }, // 307
+   { UINT64_C(16925056528170176201), UINT64_C(1282667750405742577) }, // 308
+   { UINT64_C(7321262604930556539), UINT64_C(1603334688007178222) }, // 309
+   { UINT64_C(18374950293017971482), UINT64_C(2004168360008972777) }, // 310
+   { UINT64_C(4566814905495150320), UINT64_C(1252605225005607986) }, // 311
+   { UINT64_C(14931890668723713708), UINT64_C(1565756531257009982) }, // 312
+   { UINT64_C(9441491299049866327), UINT64_C(1957195664071262478) }, // 313
+   { UINT64_C(1289246043478778550), UINT64_C(1223247290044539049) }, // 314
+   { UINT64_C(6223243572775861092), UINT64_C(1529059112555673811) }, // 315
+   { UINT64_C(3167368447542438461), UINT64_C(1911323890694592264) }, // 316
+   { UINT64_C(1979605279714024038), UINT64_C(1194577431684120165) }, // 317
+   { UINT64_C(7086192618069917952), UINT64_C(1493221789605150206) }, // 318
+   { UINT64_C(18081112809442173248), UINT64_C(1866527237006437757) }, // 319
+   { UINT64_C(13606538515115052232), UINT64_C(1166579523129023598) }, // 320
+   { UINT64_C(7784801107039039482), UINT64_C(1458224403911279498) }, // 321
+   { UINT64_C(507629346944023544), UINT64_C(1822780504889099373) }, // 322
+   { UINT64_C(5246222702107417334), UINT64_C(2278475631111374216) }, // 323
+   { UINT64_C(3278889188817135834), UINT64_C(1424047269444608885) }, // 324
+   { UINT64_C(8710297504448807696), UINT64_C(1780059086805761106) }, // 325
+   { UINT64_C(1664499843706233812), UINT64_C(2225073858507201383) }, // 326
+   { UINT64_C(7957841429957477989), UINT64_C(1390671161567000864) }, // 327
+   { UINT64_C(9947301787446847486), UINT64_C(1738338951958751080) }, // 328
+   { UINT64_C(12434127234308559357), UINT64_C(2172923689948438850) }, // 329
+   { UINT64_C(12383015539870237502), UINT64_C(1358077306217774281) }, // 330
+   { UINT64_C(1643711369555633166), UINT64_C(1697596632772217852) }, // 331
+   { UINT64_C(2054639211944541457), UINT64_C(2121995790965272315) }, // 332
+   { UINT64_C(17425050571961196075), UINT64_C(1326247369353295196) }, // 333
+   { UINT64_C(3334569141241943478), UINT64_C(1657809211691618996) }, // 334
+   { UINT64_C(4168211426552429347), UINT64_C(2072261514614523745) }, // 335
+   { UINT64_C(14134347187663738102), UINT64_C(1295163446634077340) }, // 336
+   { UINT64_C(17667933984579672627), UINT64_C(1618954308292596675) }, // 337
+   { UINT64_C(17473231462297202880), UINT64_C(2023692885365745844) }, // 338
+   { UINT64_C(1697397627080975992), UINT64_C(1264808053353591153) }, // 339
+   { UINT64_C(6733433052278607894), UINT64_C(1581010066691988941) }, // 340
+   { UINT64_C(13028477333775647772), UINT64_C(1976262583364986176) }, // 341
+   { UINT64_C(8142798333609779857), UINT64_C(1235164114603116360) }  // 342
+  };
+
+static const uint64_t ya_s__pow5_inv_split[342][2] = /* 2^k/5^i to 125 bits (rounded up) */
+  {
+   { UINT64_C(1), UINT64_C(2305843009213693952) }, // 0
+   { UINT64_C(11068046444225730970), UINT64_C(1844674407370955161) }, // 1
+   { UINT64_C(5165088340638674453), UINT64_C(1475739525896764129) }, // 2
+   { UINT64_C(7821419487252849886), UINT64_C(1180591620717411303) }, // 3
+   { UINT64_C(8824922364862649494), UINT64_C(1888946593147858085) }, // 4
+   { UINT64_C(7059937891890119595), UINT64_C(1511157274518286468) }, // 5
+   { UINT64_C(13026647942995916322), UINT64_C(1208925819614629174) }, // 6
+   { UINT64_C(9774590264567735146), UINT64_C(1934281311383406679) }, // 7
+   { UINT64_C(11509021026396098440), UINT64_C(1547425049106725343) }, // 8
+   { UINT64_C(16585914450600699399), UINT64_C(1237940039285380274) }, // 9
+   { UINT64_C(15469416676735388068), UINT64_C(1980704062856608439) }, // 10
+   { UINT64_C(16064882156130220778), UINT64_C(1584563250285286751) }, // 11
+   { UINT64_C(9162556910162266299), UINT64_C(1267650600228229401) }, // 12
+   { UINT64_C(7281393426775805432), UINT64_C(2028240960365167042) }, // 13
+   { UINT64_C(16893161185646375315), UINT64_C(1622592768292133633) }, // 14
+   { UINT64_C(2446482504291369283), UINT64_C(1298074214633706907) }, // 15
+   { UINT64_C(7603720821608101175), UINT64_C(2076918743413931051) }, // 16
+   { UINT64_C(2393627842544570617), UINT64_C(1661534994731144841) }, // 17
+   { UINT64_C(16672297533003297786), UINT64_C(1329227995784915872) }, // 18
+   { UINT64_C(11918280793837635165), UINT64_C(2126764793255865396) }, // 19
+   { UINT64_C(5845275820328197809), UINT64_C(1701411834604692317) }, // 20
+   { UINT64_C(15744267100488289217), UINT64_C(1361129467683753853) }, // 21
+   { UINT64_C(3054734472329800808), UINT64_C(2177807148294006166) }, // 22
+   { UINT64_C(17201182836831481939), UINT64_C(1742245718635204932) }, // 23
+   { UINT64_C(6382248639981364905), UINT64_C(1393796574908163946) }, // 24
+   { UINT64_C(2832900194486363201), UINT64_C(2230074519853062314) }, // 25
+   { UINT64_C(5955668970331000884), UINT64_C(1784059615882449851) }, // 26
+   { UINT64_C(1075186361522890384), UINT64_C(1427247692705959881) }, // 27
+   { UINT64_C(12788344622662355584), UINT64_C(2283596308329535809) }, // 28
+   { UINT64_C(13920024512871794791), UINT64_C(1826877046663628647) }, // 29
+   { UINT64_C(3757321980813615186), UINT64_C(1461501637330902918) }, // 30
+   { UINT64_C(10384555214134712795), UINT64_C(1169201309864722334) }, // 31
+   { UINT64_C(5547241898389809503), UINT64_C(1870722095783555735) }, // 32
+   { UINT64_C(4437793518711847602), UINT64_C(1496577676626844588) }, // 33
+   { UINT64_C(10928932444453298728), UINT64_C(1197262141301475670) }, // 34
+   { UINT64_C(17486291911125277965), UINT64_C(1915619426082361072) }, // 35
+   { UINT64_C(6610335899416401726), UINT64_C(1532495540865888858) }, // 36
+   { UINT64_C(12666966349016942027), UINT64_C(1225996432692711086) }, // 37
+   { UINT64_C(12888448528943286597), UINT64_C(1961594292308337738) }, // 38
+   { UINT64_C(17689456452638449924), UINT64_C(1569275433846670190) }, // 39
+   { UINT64_C(14151565162110759939), UINT64_C(1255420347077336152) }, // 40
+   { UINT64_C(7885109000409574610), UINT64_C(2008672555323737844) }, // 41
+   { UINT64_C(9997436015069570011), UINT64_C(1606938044258990275) }, // 42
+   { UINT64_C(7997948812055656009), UINT64_C(1285550435407192220) }, // 43
+   { UINT64_C(12796718099289049614), UINT64_C(2056880696651507552) }, // 44
+   { UINT64_C(2858676849947419045), UINT64_C(1645504557321206042) }, // 45
+   { UINT64_C(13354987924183666206), UINT64_C(1316403645856964833) }, // 46
+   { UINT64_C(17678631863951955605), UINT64_C(2106245833371143733) }, // 47
+   { UINT64_C(3074859046935833515), UINT64_C(1684996666696914987) }, // 48
+   { UINT64_C(13527933681774397782), UINT64_C(1347997333357531989) }, // 49
+   { UINT64_C(10576647446613305481), UINT64_C(2156795733372051183) }, // 50
+   { UINT64_C(15840015586774465031), UINT64_C(1725436586697640946) }, // 51
+   { UINT64_C(8982663654677661702), UINT64_C(1380349269358112757) }, // 52
+   { UINT64_C(18061610662226169046), UINT64_C(2208558830972980411) }, // 53
+   { UINT64_C(10759939715039024913), UINT64_C(1766847064778384329) }, // 54
+   { UINT64_C(12297300586773130254), UINT64_C(1413477651822707463) }, // 55
+   { UINT64_C(15986332124095098083), UINT64_C(2261564242916331941) }, // 56
+   { UINT64_C(9099716884534168143), UINT64_C(1809251394333065553) }, // 57
+   { UINT64_C(14658471137111155161), UINT64_C(1447401115466452442) }, // 58
+   { UINT64_C(4348079280205103483), UINT64_C(1157920892373161954) }, // 59
+   { UINT64_C(14335624477811986218), UINT64_C(1852673427797059126) }, // 60
+   { UINT64_C(7779150767507678651), UINT64_C(1482138742237647301) }, // 61
+   { UINT64_C(2533971799264232598), UINT64_C(1185710993790117841) }, // 62
+   { UINT64_C(15122401323048503126), UINT64_C(1897137590064188545) }, // 63
+   { UINT64_C(12097921058438802501), UINT64_C(1517710072051350836) }, // 64
+   { UINT64_C(5988988032009131678), UINT64_C(1214168057641080669) }, // 65
+   { UINT64_C(16961078480698431330), UINT64_C(1942668892225729070) }, // 66
+   { UINT64_C(13568862784558745064), UINT64_C(1554135113780583256) }, // 67
+   { UINT64_C(7165741412905085728), UINT64_C(1243308091024466605) }, // 68
+   { UINT64_C(11465186260648137165), UINT64_C(1989292945639146568) }, // 69
+   { UINT64_C(16550846638002330379), UINT64_C(1591434356511317254) }, // 70
+   { UINT64_C(16930026125143774626), UINT64_C(1273147485209053803) }, // 71
+   { UINT64_C(4951948911778577463), UINT64_C(2037035976334486086) }, // 72
+   { UINT64_C(272210314680951647), UINT64_C(1629628781067588869) }, // 73
+   { UINT64_C(3907117066486671641), UINT64_C(1303703024854071095) }, // 74
+   { UINT64_C(6251387306378674625), UINT64_C(2085924839766513752) }, // 75
+   { UINT64_C(16069156289328670670), UINT64_C(1668739871813211001) }, // 76
+   { UINT64_C(9165976216721026213), UINT64_C(1334991897450568801) }, // 77
+   { UINT64_C(7286864317269821294), UINT64_C(2135987035920910082) }, // 78
+   { UINT64_C(16897537898041588005), UINT64_C(1708789628736728065) }, // 79
+   { UINT64_C(13518030318433270404), UINT64_C(1367031702989382452) }, // 80
+   { UINT64_C(6871453250525591353), UINT64_C(2187250724783011924) }, // 81
+   { UINT64_C(9186511415162383406), UINT64_C(1749800579826409539) }, // 82
+   { UINT64_C(11038557946871817048), UINT64_C(1399840463861127631) }, // 83
+   { UINT64_C(10282995085511086630), UINT64_C(2239744742177804210) }, // 84
+   { UINT64_C(8226396068408869304), UINT64_C(1791795793742243368) }, // 85
+   { UINT64_C(13959814484210916090), UINT64_C(1433436634993794694) }, // 86
+   { UINT64_C(11267656730511734774), UINT64_C(2293498615990071511) }, // 87
+   { UINT64_C(5324776569667477496), UINT64_C(1834798892792057209) }, // 88
+   { UINT64_C(7949170070475892320), UINT64_C(1467839114233645767) }, // 89
+   { UINT64_C(17427382500606444826), UINT64_C(1174271291386916613) }, // 90
+   { UINT64_C(5747719112518849781), UINT64_C(1878834066219066582) }, // 91
+   { UINT64_C(15666221734240810795), UINT64_C(1503067252975253265) }, // 92
+   { UINT64_C(12532977387392648636), UINT64_C(1202453802380202612) }, // 93
+   { UINT64_C(5295368560860596524), UINT64_C(1923926083808324180) }, // 94
+   { UINT64_C(4236294848688477220), UINT64_C(1539140867046659344) }, // 95
+   { UINT64_C(7078384693692692099), UINT64_C(1231312693637327475) }, // 96
+   { UINT64_C(11325415509908307358), UINT64_C(1970100309819723960) }, // 97
+   { UINT64_C(9060332407926645887), UINT64_C(1576080247855779168) }, // 98
+   { UINT64_C(14626963555825137356), UINT64_C(1260864198284623334) }, // 99
+   { UINT64_C(12335095245094488799), UINT64_C(2017382717255397335) }, // 100
+   { UINT64_C(9868076196075591040), UINT64_C(1613906173804317868) }, // 101
+   { UINT64_C(15273158586344293478), UINT64_C(1291124939043454294) }, // 102
+   { UINT64_C(13369007293925138595), UINT64_C(2065799902469526871) }, // 103
+   { UINT64_C(7005857020398200553), UINT64_C(1652639921975621497) }, // 104
+   { UINT64_C(16672732060544291412), UINT64_C(1322111937580497197) }, // 105
+   { UINT64_C(11918976037903224966), UINT64_C(2115379100128795516) }, // 106
+   { UINT64_C(5845832015580669650), UINT64_C(1692303280103036413) }, // 107
+   { UINT64_C(12055363241948356366), UINT64_C(1353842624082429130) }, // 108
+   { UINT64_C(841837113407818570), UINT64_C(2166148198531886609) }, // 109
+   { UINT64_C(4362818505468165179), UINT64_C(1732918558825509287) }, // 110
+   { UINT64_C(14558301248600263113), UINT64_C(1386334847060407429) }, // 111
+   { UINT64_C(12225235553534690011), UINT64_C(2218135755296651887) }, // 112
+   { UINT64_C(2401490813343931363), UINT64_C(1774508604237321510) }, // 113
+   { UINT64_C(1921192650675145090), UINT64_C(1419606883389857208) }, // 114
+   { UINT64_C(17831303500047873437), UINT64_C(2271371013423771532) }, // 115
+   { UINT64_C(6886345170554478103), UINT64_C(1817096810739017226) }, // 116
+   { UINT64_C(1819727321701672159), UINT64_C(1453677448591213781) }, // 117
+   { UINT64_C(16213177116328979020), UINT64_C(1162941958872971024) }, // 118
+   { UINT64_C(14873036941900635463), UINT64_C(1860707134196753639) }, // 119
+   { UINT64_C(15587778368262418694), UINT64_C(1488565707357402911) }, // 120
+   { UINT64_C(8780873879868024632), UINT64_C(1190852565885922329) }, // 121
+   { UINT64_C(2981351763563108441), UINT64_C(1905364105417475727) }, // 122
+   { UINT64_C(13453127855076217722), UINT64_C(1524291284333980581) }, // 123
+   { UINT64_C(7073153469319063855), UINT64_C(1219433027467184465) }, // 124
+   { UINT64_C(11317045550910502167), UINT64_C(1951092843947495144) }, // 125
+   { UINT64_C(12742985255470312057), UINT64_C(1560874275157996115) }, // 126
+   { UINT64_C(10194388204376249646), UINT64_C(1248699420126396892) }, // 127
+   { UINT64_C(1553625868034358140), UINT64_C(1997919072202235028) }, // 128
+   { UINT64_C(8621598323911307159), UINT64_C(1598335257761788022) }, // 129
+   { UINT64_C(17965325103354776697), UINT64_C(1278668206209430417) }, // 130
+   { UINT64_C(13987124906400001422), UINT64_C(2045869129935088668) }, // 131
+   { UINT64_C(121653480894270168), UINT64_C(1636695303948070935) }, // 132
+   { UINT64_C(97322784715416134), UINT64_C(1309356243158456748) }, // 133
+   { UINT64_C(14913111714512307107), UINT64_C(2094969989053530796) }, // 134
+   { UINT64_C(8241140556867935363), UINT64_C(1675975991242824637) }, // 135
+   { UINT64_C(17660958889720079260), UINT64_C(1340780792994259709) }, // 136
+   { UINT64_C(17189487779326395846), UINT64_C(2145249268790815535) }, // 137
+   { UINT64_C(13751590223461116677), UINT64_C(1716199415032652428) }, // 138
+   { UINT64_C(18379969808252713988), UINT64_C(1372959532026121942) }, // 139
+   { UINT64_C(14650556434236701088), UINT64_C(2196735251241795108) }, // 140
+   { UINT64_C(652398703163629901), UINT64_C(1757388200993436087) }, // 141
+   { UINT64_C(11589965406756634890), UINT64_C(1405910560794748869) }, // 142
+   { UINT64_C(7475898206584884855), UINT64_C(2249456897271598191) }, // 143
+   { UINT64_C(2291369750525997561), UINT64_C(1799565517817278553) }, // 144
+   { UINT64_C(9211793429904618695), UINT64_C(1439652414253822842) }, // 145
+   { UINT64_C(18428218302589300235), UINT64_C(2303443862806116547) }, // 146
+   { UINT64_C(7363877012587619542), UINT64_C(1842755090244893238) }, // 147
+   { UINT64_C(13269799239553916280), UINT64_C(1474204072195914590) }, // 148
+   { UINT64_C(10615839391643133024), UINT64_C(1179363257756731672) }, // 149
+   { UINT64_C(2227947767661371545), UINT64_C(1886981212410770676) }, // 150
+   { UINT64_C(16539753473096738529), UINT64_C(1509584969928616540) }, // 151
+   { UINT64_C(13231802778477390823), UINT64_C(1207667975942893232) }, // 152
+   { UINT64_C(6413489186596184024), UINT64_C(1932268761508629172) }, // 153
+   { UINT64_C(16198837793502678189), UINT64_C(1545815009206903337) }, // 154
+   { UINT64_C(5580372605318321905), UINT64_C(1236652007365522670) }, // 155
+   { UINT64_C(8928596168509315048), UINT64_C(1978643211784836272) }, // 156
+   { UINT64_C(18210923379033183008), UINT64_C(1582914569427869017) }, // 157
+   { UINT64_C(7190041073742725760), UINT64_C(1266331655542295214) }, // 158
+   { UINT64_C(436019273762630246), UINT64_C(2026130648867672343) }, // 159
+   { UINT64_C(7727513048493924843), UINT64_C(1620904519094137874) }, // 160
+   { UINT64_C(9871359253537050198), UINT64_C(1296723615275310299) }, // 161
+   { UINT64_C(4726128361433549347), UINT64_C(2074757784440496479) }, // 162
+   { UINT64_C(7470251503888749801), UINT64_C(1659806227552397183) }, // 163
+   { UINT64_C(13354898832594820487), UINT64_C(1327844982041917746) }, // 164
+   { UINT64_C(13989140502667892133), UINT64_C(2124551971267068394) }, // 165
+   { UINT64_C(14880661216876224029), UINT64_C(1699641577013654715) }, // 166
+   { UINT64_C(11904528973500979224), UINT64_C(1359713261610923772) }, // 167
+   { UINT64_C(4289851098633925465), UINT64_C(2175541218577478036) }, // 168
+   { UINT64_C(18189276137874781665), UINT64_C(1740432974861982428) }, // 169
+   { UINT64_C(3483374466074094362), UINT64_C(1392346379889585943) }, // 170
+   { UINT64_C(1884050330976640656), UINT64_C(2227754207823337509) }, // 171
+   { UINT64_C(5196589079523222848), UINT64_C(1782203366258670007) }, // 172
+   { UINT64_C(15225317707844309248), UINT64_C(1425762693006936005) }, // 173
+   { UINT64_C(5913764258841343181), UINT64_C(2281220308811097609) }, // 174
+   { UINT64_C(8420360221814984868), UINT64_C(1824976247048878087) }, // 175
+   { UINT64_C(17804334621677718864), UINT64_C(1459980997639102469) }, // 176
+   { UINT64_C(17932816512084085415), UINT64_C(1167984798111281975) }, // 177
+   { UINT64_C(10245762345624985047), UINT64_C(1868775676978051161) }, // 178
+   { UINT64_C(4507261061758077715), UINT64_C(1495020541582440929) }, // 179
+   { UINT64_C(7295157664148372495), UINT64_C(1196016433265952743) }, // 180
+   { UINT64_C(7982903447895485668), UINT64_C(1913626293225524389) }, // 181
+   { UINT64_C(10075671573058298858), UINT64_C(1530901034580419511) }, // 182
+   { UINT64_C(4371188443704728763), UINT64_C(1224720827664335609) }, // 183
+   { UINT64_C(14372599139411386667), UINT64_C(1959553324262936974) }, // 184
+   { UINT64_C(15187428126271019657), UINT64_C(1567642659410349579) }, // 185
+   { UINT64_C(15839291315758726049), UINT64_C(1254114127528279663) }, // 186
+   { UINT64_C(3206773216762499739), UINT64_C(2006582604045247462) }, // 187
+   { UINT64_C(13633465017635730761), UINT64_C(1605266083236197969) }, // 188
+   { UINT64_C(14596120828850494932), UINT64_C(1284212866588958375) }, // 189
+   { UINT64_C(4907049252451240275), UINT64_C(2054740586542333401) }, // 190
+   { UINT64_C(236290587219081897), UINT64_C(1643792469233866721) }, // 191
+   { UINT64_C(14946427728742906810), UINT64_C(1315033975387093376) }, // 192
+   { UINT64_C(16535586736504830250), UINT64_C(2104054360619349402) }, // 193
+   { UINT64_C(5849771759720043554), UINT64_C(1683243488495479522) }, // 194
+   { UINT64_C(15747863852001765813), UINT64_C(1346594790796383617) }, // 195
+   { UINT64_C(10439186904235184007), UINT64_C(2154551665274213788) }, // 196
+   { UINT64_C(15730047152871967852), UINT64_C(1723641332219371030) }, // 197
+   { UINT64_C(12584037722297574282), UINT64_C(1378913065775496824) }, // 198
+   { UINT64_C(9066413911450387881), UINT64_C(2206260905240794919) }, // 199
+   { UINT64_C(10942479943902220628), UINT64_C(1765008724192635935) }, // 200
+   { UINT64_C(8753983955121776503), UINT64_C(1412006979354108748) }, // 201
+   { UINT64_C(10317025513452932081), UINT64_C(2259211166966573997) }, // 202
+   { UINT64_C(874922781278525018), UINT64_C(1807368933573259198) }, // 203
+   { UINT64_C(8078635854506640661), UINT64_C(1445895146858607358) }, // 204
+   { UINT64_C(13841606313089133175), UINT64_C(1156716117486885886) }, // 205
+   { UINT64_C(14767872471458792434), UINT64_C(1850745787979017418) }, // 206
+   { UINT64_C(746251532941302978), UINT64_C(1480596630383213935) }, // 207
+   { UINT64_C(597001226353042382), UINT64_C(1184477304306571148) }, // 208
+   { UINT64_C(15712597221132509104), UINT64_C(1895163686890513836) }, // 209
+   { UINT64_C(8880728962164096960), UINT64_C(1516130949512411069) }, // 210
+   { UINT64_C(10793931984473187891), UINT64_C(1212904759609928855) }, // 211
+   { UINT64_C(17270291175157100626), UINT64_C(1940647615375886168) }, // 212
+   { UINT64_C(2748186495899949531), UINT64_C(1552518092300708935) }, // 213
+   { UINT64_C(2198549196719959625), UINT64_C(1242014473840567148) }, // 214
+   { UINT64_C(18275073973719576693), UINT64_C(1987223158144907436) }, // 215
+   { UINT64_C(10930710364233751031), UINT64_C(1589778526515925949) }, // 216
+   { UINT64_C(12433917106128911148), UINT64_C(1271822821212740759) }, // 217
+   { UINT64_C(8826220925580526867), UINT64_C(2034916513940385215) }, // 218
+   { UINT64_C(7060976740464421494), UINT64_C(1627933211152308172) }, // 219
+   { UINT64_C(16716827836597268165), UINT64_C(1302346568921846537) }, // 220
+   { UINT64_C(11989529279587987770), UINT64_C(2083754510274954460) }, // 221
+   { UINT64_C(9591623423670390216), UINT64_C(1667003608219963568) }, // 222
+   { UINT64_C(15051996368420132820), UINT64_C(1333602886575970854) }, // 223
+   { UINT64_C(13015147745246481542), UINT64_C(2133764618521553367) }, // 224
+   { UINT64_C(3033420566713364587), UINT64_C(1707011694817242694) }, // 225
+   { UINT64_C(6116085268112601993), UINT64_C(1365609355853794155) }, // 226
+   { UINT64_C(9785736428980163188), UINT64_C(2184974969366070648) }, // 227
+   { UINT64_C(15207286772667951197), UINT64_C(1747979975492856518) }, // 228
+   { UINT64_C(1097782973908629988), UINT64_C(1398383980394285215) }, // 229
+   { UINT64_C(1756452758253807981), UINT64_C(2237414368630856344) }, // 230
+   { UINT64_C(5094511021344956708), UINT64_C(1789931494904685075) }, // 231
+   { UINT64_C(4075608817075965366), UINT64_C(1431945195923748060) }, // 232
+   { UINT64_C(6520974107321544586), UINT64_C(2291112313477996896) }, // 233
+   { UINT64_C(1527430471115325346), UINT64_C(1832889850782397517) }, // 234
+   { UINT64_C(12289990821117991246), UINT64_C(1466311880625918013) }, // 235
+   { UINT64_C(17210690286378213644), UINT64_C(1173049504500734410) }, // 236
+   { UINT64_C(9090360384495590213), UINT64_C(1876879207201175057) }, // 237
+   { UINT64_C(18340334751822203140), UINT64_C(1501503365760940045) }, // 238
+   { UINT64_C(14672267801457762512), UINT64_C(1201202692608752036) }, // 239
+   { UINT64_C(16096930852848599373), UINT64_C(1921924308174003258) }, // 240
+   { UINT64_C(1809498238053148529), UINT64_C(1537539446539202607) }, // 241
+   { UINT64_C(12515645034668249793), UINT64_C(1230031557231362085) }, // 242
+   { UINT64_C(1578287981759648052), UINT64_C(1968050491570179337) }, // 243
+   { UINT64_C(12330676829633449412), UINT64_C(1574440393256143469) }, // 244
+   { UINT64_C(13553890278448669853), UINT64_C(1259552314604914775) }, // 245
+   { UINT64_C(3239480371808320148), UINT64_C(2015283703367863641) }, // 246
+   { UINT64_C(17348979556414297411), UINT64_C(1612226962694290912) }, // 247
+   { UINT64_C(6500486015647617283), UINT64_C(1289781570155432730) }, // 248
+   { UINT64_C(10400777625036187652), UINT64_C(2063650512248692368) }, // 249
+   { UINT64_C(15699319729512770768), UINT64_C(1650920409798953894) }, // 250
+   { UINT64_C(16248804598352126938), UINT64_C(1320736327839163115) }, // 251
+   { UINT64_C(7551343283653851484), UINT64_C(2113178124542660985) }, // 252
+   { UINT64_C(6041074626923081187), UINT64_C(1690542499634128788) }, // 253
+   { UINT64_C(12211557331022285596), UINT64_C(1352433999707303030) }, // 254
+   { UINT64_C(1091747655926105338), UINT64_C(2163894399531684849) }, // 255
+   { UINT64_C(4562746939482794594), UINT64_C(1731115519625347879) }, // 256
+   { UINT64_C(7339546366328145998), UINT64_C(1384892415700278303) }, // 257
+   { UINT64_C(8053925371383123274), UINT64_C(2215827865120445285) }, // 258
+   { UINT64_C(6443140297106498619), UINT64_C(1772662292096356228) }, // 259
+   { UINT64_C(12533209867169019542), UINT64_C(1418129833677084982) }, // 260
+   { UINT64_C(5295740528502789974), UINT64_C(2269007733883335972) }, // 261
+   { UINT64_C(15304638867027962949), UINT64_C(1815206187106668777) }, // 262
+   { UINT64_C(4865013464138549713), UINT64_C(1452164949685335022) }, // 263
+   { UINT64_C(14960057215536570740), UINT64_C(1161731959748268017) }, // 264
+   { UINT64_C(9178696285890871890), UINT64_C(1858771135597228828) }, // 265
+   { UINT64_C(14721654658196518159), UINT64_C(1487016908477783062) }, // 266
+   { UINT64_C(4398626097073393881), UINT64_C(1189613526782226450) }, // 267
+   { UINT64_C(7037801755317430209), UINT64_C(1903381642851562320) }, // 268
+   { UINT64_C(5630241404253944167), UINT64_C(1522705314281249856) }, // 269
+   { UINT64_C(814844308661245011), UINT64_C(1218164251424999885) }, // 270
+   { UINT64_C(1303750893857992017), UINT64_C(1949062802279999816) }, // 271
+   { UINT64_C(15800395974054034906), UINT64_C(1559250241823999852) }, // 272
+   { UINT64_C(5261619149759407279), UINT64_C(1247400193459199882) }, // 273
+   { UINT64_C(12107939454356961969), UINT64_C(1995840309534719811) }, // 274
+   { UINT64_C(5997002748743659252), UINT64_C(1596672247627775849) }, // 275
+   { UINT64_C(8486951013736837725), UINT64_C(1277337798102220679) }, // 276
+   { UINT64_C(2511075177753209390), UINT64_C(2043740476963553087) }, // 277
+   { UINT64_C(13076906586428298482), UINT64_C(1634992381570842469) }, // 278
+   { UINT64_C(14150874083884549109), UINT64_C(1307993905256673975) }, // 279
+   { UINT64_C(4194654460505726958), UINT64_C(2092790248410678361) }, // 280
+   { UINT64_C(18113118827372222859), UINT64_C(1674232198728542688) }, // 281
+   { UINT64_C(3422448617672047318), UINT64_C(1339385758982834151) }, // 282
+   { UINT64_C(16543964232501006678), UINT64_C(2143017214372534641) }, // 283
+   { UINT64_C(9545822571258895019), UINT64_C(1714413771498027713) }, // 284
+   { UINT64_C(15015355686490936662), UINT64_C(1371531017198422170) }, // 285
+   { UINT64_C(5577825024675947042), UINT64_C(2194449627517475473) }, // 286
+   { UINT64_C(11840957649224578280), UINT64_C(1755559702013980378) }, // 287
+   { UINT64_C(16851463748863483271), UINT64_C(1404447761611184302) }, // 288
+   { UINT64_C(12204946739213931940), UINT64_C(2247116418577894884) }, // 289
+   { UINT64_C(13453306206113055875), UINT64_C(1797693134862315907) }, // 290
+   { UINT64_C(3383947335406624054), UINT64_C(1438154507889852726) }, // 291
+   { UINT64_C(16482362180876329456), UINT64_C(2301047212623764361) }, // 292
+   { UINT64_C(9496540929959153242), UINT64_C(1840837770099011489) }, // 293
+   { UINT64_C(11286581558709232917), UINT64_C(1472670216079209191) }, // 294
+   { UINT64_C(5339916432225476010), UINT64_C(1178136172863367353) }, // 295
+   { UINT64_C(4854517476818851293), UINT64_C(1885017876581387765) }, // 296
+   { UINT64_C(3883613981455081034), UINT64_C(1508014301265110212) }, // 297
+   { UINT64_C(14174937629389795797), UINT64_C(1206411441012088169) }, // 298
+   { UINT64_C(11611853762797942306), UINT64_C(1930258305619341071) }, // 299
+   { UINT64_C(5600134195496443521), UINT64_C(1544206644495472857) }, // 300
+   { UINT64_C(15548153800622885787), UINT64_C(1235365315596378285) }, // 301
+   { UINT64_C(6430302007287065643), UINT64_C(1976584504954205257) }, // 302
+   { UINT64_C(16212288050055383484), UINT64_C(1581267603963364205) }, // 303
+   { UINT64_C(12969830440044306787), UINT64_C(1265014083170691364) }, // 304
+   { UINT64_C(9683682259845159889), UINT64_C(2024022533073106183) }, // 305
+   { UINT64_C(15125643437359948558), UINT64_C(1619218026458484946) }, // 306
+   { UINT64_C(8411165935146048523), UINT64_C(1295374421166787957) }, // 307
+   { UINT64_C(17147214310975587960), UINT64_C(2072599073866860731) }, // 308
+   { UINT64_C(10028422634038560045), UINT64_C(1658079259093488585) }, // 309
+   { UINT64_C(8022738107230848036), UINT64_C(1326463407274790868) }, // 310
+   { UINT64_C(9147032156827446534), UINT64_C(2122341451639665389) }, // 311
+   { UINT64_C(11006974540203867551), UINT64_C(1697873161311732311) }, // 312
+   { UINT64_C(5116230817421183718), UINT64_C(1358298529049385849) }, // 313
+   { UINT64_C(15564666937357714594), UINT64_C(2173277646479017358) }, // 314
+   { UINT64_C(1383687105660440706), UINT64_C(1738622117183213887) }, // 315
+   { UINT64_C(12174996128754083534), UINT64_C(1390897693746571109) }, // 316
+   { UINT64_C(8411947361780802685), UINT64_C(2225436309994513775) }, // 317
+   { UINT64_C(6729557889424642148), UINT64_C(1780349047995611020) }, // 318
+   { UINT64_C(5383646311539713719), UINT64_C(1424279238396488816) }, // 319
+   { UINT64_C(1235136468979721303), UINT64_C(2278846781434382106) }, // 320
+   { UINT64_C(15745504434151418335), UINT64_C(1823077425147505684) }, // 321
+   { UINT64_C(16285752362063044992), UINT64_C(1458461940118004547) }, // 322
+   { UINT64_C(5649904260166615347), UINT64_C(1166769552094403638) }, // 323
+   { UINT64_C(5350498001524674232), UINT64_C(1866831283351045821) }, // 324
+   { UINT64_C(591049586477829062), UINT64_C(1493465026680836657) }, // 325
+   { UINT64_C(11540886113407994219), UINT64_C(1194772021344669325) }, // 326
+   { UINT64_C(18673707743239135), UINT64_C(1911635234151470921) }, // 327
+   { UINT64_C(14772334225162232601), UINT64_C(1529308187321176736) }, // 328
+   { UINT64_C(8128518565387875758), UINT64_C(1223446549856941389) }, // 329
+   { UINT64_C(1937583260394870242), UINT64_C(1957514479771106223) }, // 330
+   { UINT64_C(8928764237799716840), UINT64_C(1566011583816884978) }, // 331
+   { UINT64_C(14521709019723594119), UINT64_C(1252809267053507982) }, // 332
+   { UINT64_C(8477339172590109297), UINT64_C(2004494827285612772) }, // 333
+   { UINT64_C(17849917782297818407), UINT64_C(1603595861828490217) }, // 334
+   { UINT64_C(6901236596354434079), UINT64_C(1282876689462792174) }, // 335
+   { UINT64_C(18420676183650915173), UINT64_C(2052602703140467478) }, // 336
+   { UINT64_C(3668494502695001169), UINT64_C(1642082162512373983) }, // 337
+   { UINT64_C(10313493231639821582), UINT64_C(1313665730009899186) }, // 338
+   { UINT64_C(9122891541139893884), UINT64_C(2101865168015838698) }, // 339
+   { UINT64_C(14677010862395735754), UINT64_C(1681492134412670958) }, // 340
+   { UINT64_C(673562245690857633), UINT64_C(1345193707530136767) }  // 341
+  };
+
+#ifdef YA_S__EXACT
+/* tables for the exact long double and __float128 conversions (%Le, %Lf, %Lg, %Qe, %Qf, %Qg) in ya_sprintf.h
+   ya_s__pow5_u64[i] is 5^i exactly, i=0..27
+   ya_s__pow5x27_pos[q] is 5^(27q) and ya_s__pow5x27_neg[q] is 5^(-27q), q=0..186,
+   each as a 192 bit value rounded down { { low 64 bits, middle 64 bits, high 64 bits }, e } with 5^(+/-27q) ~= value*2^e (the top bit of value is always set)
+*/
+static const uint64_t ya_s__pow5_u64[28] = /* 5^i */
+  {
+   UINT64_C(1), // 0
+   UINT64_C(5), // 1
+   UINT64_C(25), // 2
+   UINT64_C(125), // 3
+   UINT64_C(625), // 4
+   UINT64_C(3125), // 5
+   UINT64_C(15625), // 6
+   UINT64_C(78125), // 7
+   UINT64_C(390625), // 8
+   UINT64_C(1953125), // 9
+   UINT64_C(9765625), // 10
+   UINT64_C(48828125), // 11
+   UINT64_C(244140625), // 12
+   UINT64_C(1220703125), // 13
+   UINT64_C(6103515625), // 14
+   UINT64_C(30517578125), // 15
+   UINT64_C(152587890625), // 16
+   UINT64_C(762939453125), // 17
+   UINT64_C(3814697265625), // 18
+   UINT64_C(19073486328125), // 19
+   UINT64_C(95367431640625), // 20
+   UINT64_C(476837158203125), // 21
+   UINT64_C(2384185791015625), // 22
+   UINT64_C(11920928955078125), // 23
+   UINT64_C(59604644775390625), // 24
+   UINT64_C(298023223876953125), // 25
+   UINT64_C(1490116119384765625), // 26
+   UINT64_C(7450580596923828125)  // 27
+  };
+
+static const struct ya_s__pow5_192 { uint64_t w[3]; int32_t e; } ya_s__pow5x27_pos[187] = /* 5^(27q) rounded down to 192 bits */
+  {
+   { { UINT64_C(0), UINT64_C(0), UINT64_C(9223372036854775808) }, -191 }, // 0
+   { { UINT64_C(0), UINT64_C(0), UINT64_C(14901161193847656250) }, -129 }, // 1
+   { { UINT64_C(0), UINT64_C(11065503397408397604), UINT64_C(12037062152420224081) }, -66 }, // 2
+   { { UINT64_C(16113757790975053352), UINT64_C(7611128154919104931), UINT64_C(9723461371658033917) }, -3 }, // 3
+   { { UINT64_C(15513681152740284627), UINT64_C(16721424822051837077), UINT64_C(15709099088952724969) }, 59 }, // 4
+   { { UINT64_C(13856584293446594591), UINT64_C(6827560182880305039), UINT64_C(12689709186578246116) }, 122 }, // 5
+   { { UINT64_C(2575331249103045365), UINT64_C(1466078993672598279), UINT64_C(10250665447337476733) }, 185 }, // 6
+   { { UINT64_C(17344994892919524476), UINT64_C(10310543607939835386), UINT64_C(16560843210556190337) }, 247 }, // 7
+   { { UINT64_C(9867298837582875614), UINT64_C(7896285879677171346), UINT64_C(13377742608693866209) }, 310 }, // 8
+   { { UINT64_C(962163898128633415), UINT64_C(5385653213018257806), UINT64_C(10806454419566533849) }, 373 }, // 9
+   { { UINT64_C(4439498980731556220), UINT64_C(13574758819556003052), UINT64_C(17458768723248864463) }, 435 }, // 10
+   { { UINT64_C(171258419585080375), UINT64_C(758345818024902856), UINT64_C(14103081061443981063) }, 498 }, // 11
+   { { UINT64_C(5279584310227164866), UINT64_C(7784369436827535057), UINT64_C(11392378155556871081) }, 561 }, // 12
+   { { UINT64_C(7142654015362676900), UINT64_C(10923524373777805311), UINT64_C(18405379572557156688) }, 623 }, // 13
+   { { UINT64_C(14873018272843067653), UINT64_C(3793240829646578320), UINT64_C(14867747215916808149) }, 686 }, // 14
+   { { UINT64_C(526047921704928306), UINT64_C(17525025361526871985), UINT64_C(12010070556001598807) }, 749 }, // 15
+   { { UINT64_C(15298154279644435418), UINT64_C(15523187401453909594), UINT64_C(9701657733709457196) }, 812 }, // 16
+   { { UINT64_C(10908970745096770962), UINT64_C(12348118289513378005), UINT64_C(15673873412010951275) }, 874 }, // 17
+   { { UINT64_C(16485225839482291392), UINT64_C(13107252037068009072), UINT64_C(12661254111353352144) }, 937 }, // 18
+   { { UINT64_C(7043473957444128756), UINT64_C(4593488778692278171), UINT64_C(10227679620623833884) }, 1000 }, // 19
+   { { UINT64_C(16787918992662579860), UINT64_C(16239128954786563294), UINT64_C(16523707604655743386) }, 1062 }, // 20
+   { { UINT64_C(17420547361161046495), UINT64_C(15067237983548391765), UINT64_C(13347744705142831504) }, 1125 }, // 21
+   { { UINT64_C(16745537219963311797), UINT64_C(9323090133766172226), UINT64_C(10782222306056131963) }, 1188 }, // 22
+   { { UINT64_C(7935524000440143592), UINT64_C(2811117583511059211), UINT64_C(17419619632434433351) }, 1250 }, // 23
+   { { UINT64_C(8472396087270610874), UINT64_C(15654571355171274947), UINT64_C(14071456677732286495) }, 1313 }, // 24
+   { { UINT64_C(6027087201372990386), UINT64_C(18148675164122410464), UINT64_C(11366832181835922347) }, 1376 }, // 25
+   { { UINT64_C(5479479335042648166), UINT64_C(2737203335106638129), UINT64_C(18364107826090832624) }, 1438 }, // 26
+   { { UINT64_C(16694892527708672299), UINT64_C(10799257046627542702), UINT64_C(14834408164624672216) }, 1501 }, // 27
+   { { UINT64_C(8795069615373605376), UINT64_C(10346667081194947139), UINT64_C(11983139484839718134) }, 1564 }, // 28
+   { { UINT64_C(14156435191348488714), UINT64_C(9047877459460907506), UINT64_C(9679902987673916538) }, 1627 }, // 29
+   { { UINT64_C(12479086016210313183), UINT64_C(273474731613426586), UINT64_C(15638726724214830041) }, 1689 }, // 30
+   { { UINT64_C(5915712882784509318), UINT64_C(8728290561563351544), UINT64_C(12632862843052174815) }, 1752 }, // 31
+   { { UINT64_C(9543614690517835645), UINT64_C(9090689702417625446), UINT64_C(10204745336732695973) }, 1815 }, // 32
+   { { UINT64_C(12915640485514954825), UINT64_C(14117866137672210507), UINT64_C(16486655270676179925) }, 1877 }, // 33
+   { { UINT64_C(16553525378065945779), UINT64_C(12343177800916185059), UINT64_C(13317814068113793745) }, 1940 }, // 34
+   { { UINT64_C(15784705492624743704), UINT64_C(2361093809909555377), UINT64_C(10758044530009470063) }, 2003 }, // 35
+   { { UINT64_C(18378960482063896941), UINT64_C(7786097005904093114), UINT64_C(17380558328527308916) }, 2065 }, // 36
+   { { UINT64_C(10124530601051380512), UINT64_C(10654298092600752296), UINT64_C(14039903207719576375) }, 2128 }, // 37
+   { { UINT64_C(3486928667031148836), UINT64_C(5112245043468752673), UINT64_C(11341343491744821618) }, 2191 }, // 38
+   { { UINT64_C(6324607239064132103), UINT64_C(9040828949012184139), UINT64_C(18322928626319873662) }, 2253 }, // 39
+   { { UINT64_C(7001259716063046621), UINT64_C(8173134685163977729), UINT64_C(14801143871957694354) }, 2316 }, // 40
+   { { UINT64_C(14440972525648786279), UINT64_C(9711988101433264196), UINT64_C(11956268803214313901) }, 2379 }, // 41
+   { { UINT64_C(10933813403281536530), UINT64_C(10303521143446480552), UINT64_C(9658197023917452418) }, 2442 }, // 42
+   { { UINT64_C(17018286589529962973), UINT64_C(10778864852799648032), UINT64_C(15603658848441146821) }, 2504 }, // 43
+   { { UINT64_C(11716928864439775921), UINT64_C(12034795795272893358), UINT64_C(12604535238595720943) }, 2567 }, // 44
+   { { UINT64_C(1775398774941947298), UINT64_C(14896901816248113265), UINT64_C(10181862480085772740) }, 2630 }, // 45
+   { { UINT64_C(11204560560736235739), UINT64_C(15578374302743662800), UINT64_C(16449686021890701252) }, 2692 }, // 46
+   { { UINT64_C(13454844439690594643), UINT64_C(9944158106317957172), UINT64_C(13287950546770046164) }, 2755 }, // 47
+   { { UINT64_C(7255762395963348804), UINT64_C(904075803797884167), UINT64_C(10733920969581626762) }, 2818 }, // 48
+   { { UINT64_C(15109526425239076819), UINT64_C(18175171228020675754), UINT64_C(17341584614676403837) }, 2880 }, // 49
+   { { UINT64_C(7832951760126732107), UINT64_C(8936881007405672316), UINT64_C(14008420492390808717) }, 2943 }, // 50
+   { { UINT64_C(10873321999402820750), UINT64_C(6046018209793254715), UINT64_C(11315911956832240929) }, 3006 }, // 51
+   { { UINT64_C(7541644990102495752), UINT64_C(3937516181007913568), UINT64_C(18281841765719967015) }, 3068 }, // 52
+   { { UINT64_C(7617891277708138347), UINT64_C(6470765233245316125), UINT64_C(14767954170279069707) }, 3131 }, // 53
+   { { UINT64_C(8015907901222539919), UINT64_C(3639580639856055854), UINT64_C(11929458375709453563) }, 3194 }, // 54
+   { { UINT64_C(2160590367529008977), UINT64_C(11690910853184404527), UINT64_C(9636539733051945664) }, 3257 }, // 55
+   { { UINT64_C(16926430122638224437), UINT64_C(13192587437933200745), UINT64_C(15568669607963863681) }, 3319 }, // 56
+   { { UINT64_C(18175015911355031341), UINT64_C(16774112224306579142), UINT64_C(12576271155225833972) }, 3382 }, // 57
+   { { UINT64_C(7229749613445422689), UINT64_C(16004639706486037675), UINT64_C(10159030935363943690) }, 3445 }, // 58
+   { { UINT64_C(10172679228723710487), UINT64_C(1024843735689394039), UINT64_C(16412799671991220004) }, 3507 }, // 59
+   { { UINT64_C(2164694651191186373), UINT64_C(12264953221201110307), UINT64_C(13258153990613114318) }, 3570 }, // 60
+   { { UINT64_C(581514032082976169), UINT64_C(3153262167398888639), UINT64_C(10709851503200902570) }, 3633 }, // 61
+   { { UINT64_C(7008650694058692916), UINT64_C(3301188949337433254), UINT64_C(17302698294472044574) }, 3695 }, // 62
+   { { UINT64_C(10636052390527818816), UINT64_C(10844546828214733492), UINT64_C(13977008373087512748) }, 3758 }, // 63
+   { { UINT64_C(6631067511924481962), UINT64_C(3342139893219452736), UINT64_C(11290537448934888249) }, 3821 }, // 64
+   { { UINT64_C(9260620563203093421), UINT64_C(3110100187824942488), UINT64_C(18240847037232147038) }, 3883 }, // 65
+   { { UINT64_C(16030340290719469112), UINT64_C(7490518498322331437), UINT64_C(14734838892327897849) }, 3946 }, // 66
+   { { UINT64_C(11237373644712282882), UINT64_C(16250618370484286699), UINT64_C(11902708067212857753) }, 4009 }, // 67
+   { { UINT64_C(607201891970409203), UINT64_C(12106998435604327542), UINT64_C(9614931005934566189) }, 4072 }, // 68
+   { { UINT64_C(7108023908481448360), UINT64_C(2285380166391460716), UINT64_C(15533758826453228576) }, 4134 }, // 69
+   { { UINT64_C(7102638546658546015), UINT64_C(15216755828184418400), UINT64_C(12548070450504474539) }, 4197 }, // 70
+   { { UINT64_C(17462076550376482551), UINT64_C(8428939558311174061), UINT64_C(10136250587506676937) }, 4260 }, // 71
+   { { UINT64_C(7638071855233972694), UINT64_C(3411207898861509276), UINT64_C(16375996035087421245) }, 4322 }, // 72
+   { { UINT64_C(5012035058664316490), UINT64_C(10406378245296322149), UINT64_C(13228424249481997646) }, 4385 }, // 73
+   { { UINT64_C(12904750339944500414), UINT64_C(13025603175736920622), UINT64_C(10685836009568207227) }, 4448 }, // 74
+   { { UINT64_C(15977905236897371183), UINT64_C(7546193313961435208), UINT64_C(17263899171944981548) }, 4510 }, // 75
+   { { UINT64_C(11142338380307799434), UINT64_C(11401337788046899419), UINT64_C(13945666691506989341) }, 4573 }, // 76
+   { { UINT64_C(7595064957974018884), UINT64_C(10896394481936325017), UINT64_C(11265219840176861592) }, 4636 }, // 77
+   { { UINT64_C(10392095758424693633), UINT64_C(1395666713028723572), UINT64_C(18199944234261751749) }, 4698 }, // 78
+   { { UINT64_C(3125144188274255984), UINT64_C(16132822070326022550), UINT64_C(14701797871218339865) }, 4761 }, // 79
+   { { UINT64_C(6511898172507102432), UINT64_C(15049636308088142942), UINT64_C(11876017742915219383) }, 4824 }, // 80
+   { { UINT64_C(14291922776660354191), UINT64_C(487294358756995755), UINT64_C(9593370733667222962) }, 4887 }, // 81
+   { { UINT64_C(5494732935785667535), UINT64_C(12713417726922535393), UINT64_C(15498926327974886728) }, 4949 }, // 82
+   { { UINT64_C(18315464182824178092), UINT64_C(7332198163911196792), UINT64_C(12519932982313002651) }, 5012 }, // 83
+   { { UINT64_C(1666541533456348353), UINT64_C(1279219909065572787), UINT64_C(10113521321711449351) }, 5075 }, // 84
+   { { UINT64_C(132749206218203098), UINT64_C(14593245809319598697), UINT64_C(16339274925705825669) }, 5137 }, // 85
+   { { UINT64_C(8570560463969385638), UINT64_C(6321522157650225611), UINT64_C(13198761173552412725) }, 5200 }, // 86
+   { { UINT64_C(9417316590463573746), UINT64_C(5517285952919443892), UINT64_C(10661874367656448413) }, 5263 }, // 87
+   { { UINT64_C(3827464697105061872), UINT64_C(15827050947087207164), UINT64_C(17225187051565401553) }, 5325 }, // 88
+   { { UINT64_C(13238760551035311252), UINT64_C(16470740107151854130), UINT64_C(13914395289701513241) }, 5388 }, // 89
+   { { UINT64_C(11875467332747755545), UINT64_C(366882041395191598), UINT64_C(11239959002969004585) }, 5451 }, // 90
+   { { UINT64_C(6062604312781024577), UINT64_C(340949627001595170), UINT64_C(18159133150677381685) }, 5513 }, // 91
+   { { UINT64_C(14945949433681505449), UINT64_C(17917306587962060233), UINT64_C(14668830940438777324) }, 5576 }, // 92
+   { { UINT64_C(1492194198040869655), UINT64_C(18196676291223720024), UINT64_C(11849387268309524261) }, 5639 }, // 93
+   { { UINT64_C(847205911508407481), UINT64_C(1565164671511824344), UINT64_C(9571858807596015209) }, 5702 }, // 94
+   { { UINT64_C(8267345555404534750), UINT64_C(15793263025682645068), UINT64_C(15464171936988994003) }, 5764 }, // 95
+   { { UINT64_C(1578139726777846985), UINT64_C(3076426952673682337), UINT64_C(12491858608851461472) }, 5827 }, // 96
+   { { UINT64_C(10680309714244711409), UINT64_C(13922361971268261714), UINT64_C(10090843023433168006) }, 5890 }, // 97
+   { { UINT64_C(8726875789326185699), UINT64_C(14549173749393079047), UINT64_C(16302636158788854897) }, 5952 }, // 98
+   { { UINT64_C(7857039236004385700), UINT64_C(16674458939052129122), UINT64_C(13169164613336038224) }, 6015 }, // 99
+   { { UINT64_C(14448982931326483727), UINT64_C(16491907968055540456), UINT64_C(10637966456709921822) }, 6078 }, // 100
+   { { UINT64_C(13250226672874886653), UINT64_C(13833760592359815759), UINT64_C(17186561738241942372) }, 6140 }, // 101
+   { { UINT64_C(18365598678639497503), UINT64_C(1835243291406767015), UINT64_C(13883194010077537083) }, 6203 }, // 102
+   { { UINT64_C(14676161374485097983), UINT64_C(13128511334389669351), UINT64_C(11214754810008263471) }, 6266 }, // 103
+   { { UINT64_C(7651745118166055035), UINT64_C(10503970580700001468), UINT64_C(18118413580809861094) }, 6328 }, // 104
+   { { UINT64_C(10348495573300643601), UINT64_C(9993585876331922658), UINT64_C(14635937933850973135) }, 6391 }, // 105
+   { { UINT64_C(18243932996883220008), UINT64_C(6572365531587074580), UINT64_C(11822816509190373242) }, 6454 }, // 106
+   { { UINT64_C(16910458955429040965), UINT64_C(3702967255356037142), UINT64_C(9550395119310684851) }, 6517 }, // 107
+   { { UINT64_C(4867246366101681621), UINT64_C(3566615012578622310), UINT64_C(15429495478349332266) }, 6579 }, // 108
+   { { UINT64_C(2318888260516520519), UINT64_C(6550114508903227168), UINT64_C(12463847188637862717) }, 6642 }, // 109
+   { { UINT64_C(17032255138333158541), UINT64_C(5452982215102663351), UINT64_C(10068215578383592929) }, 6705 }, // 110
+   { { UINT64_C(15538255705560708530), UINT64_C(18129199704670998769), UINT64_C(16266079549693898869) }, 6767 }, // 111
+   { { UINT64_C(11296067275902363044), UINT64_C(4666750046649144679), UINT64_C(13139634419679761555) }, 6830 }, // 112
+   { { UINT64_C(16117685072134295152), UINT64_C(5045220012828840876), UINT64_C(10614112156243702616) }, 6893 }, // 113
+   { { UINT64_C(16878436092411009585), UINT64_C(3852397432076924297), UINT64_C(17148023037320709605) }, 6955 }, // 114
+   { { UINT64_C(2325155437222416687), UINT64_C(17901795670875824193), UINT64_C(13852062695394897187) }, 7018 }, // 115
+   { { UINT64_C(16031312981311742512), UINT64_C(10767225150908832490), UINT64_C(11189607134277045568) }, 7081 }, // 116
+   { { UINT64_C(3841282985134420919), UINT64_C(5718050748658456916), UINT64_C(18077785319451201459) }, 7143 }, // 117
+   { { UINT64_C(1802626118945886186), UINT64_C(7636363544535430622), UINT64_C(14603118685689234286) }, 7206 }, // 118
+   { { UINT64_C(4495518202084410009), UINT64_C(1895624428389458257), UINT64_C(11796305331653305890) }, 7269 }, // 119
+   { { UINT64_C(4124658862275762174), UINT64_C(13039483675445571109), UINT64_C(9528979560644070163) }, 7332 }, // 120
+   { { UINT64_C(6789602552493208076), UINT64_C(11895199393837578564), UINT64_C(15394896777302426723) }, 7394 }, // 121
+   { { UINT64_C(9112468714532267826), UINT64_C(7829013907787868160), UINT64_C(12435898580507473648) }, 7457 }, // 122
+   { { UINT64_C(15214549042879249010), UINT64_C(14848867136761189700), UINT64_C(10045638872530761132) }, 7520 }, // 123
+   { { UINT64_C(16063543574006313951), UINT64_C(15742615975701407851), UINT64_C(16229604914192385333) }, 7582 }, // 124
+   { { UINT64_C(10515752325465546113), UINT64_C(1839096270992671578), UINT64_C(13110170443764927203) }, 7645 }, // 125
+   { { UINT64_C(5626683679088993032), UINT64_C(3722461765893631226), UINT64_C(10590311346043038228) }, 7708 }, // 126
+   { { UINT64_C(10202363853224332897), UINT64_C(13901220919715293575), UINT64_C(17109570754584295702) }, 7770 }, // 127
+   { { UINT64_C(11269663690239600300), UINT64_C(15713752492130876427), UINT64_C(13821001188766021149) }, 7833 }, // 128
+   { { UINT64_C(17933782674758020455), UINT64_C(13216090434912037639), UINT64_C(11164515849042579151) }, 7896 }, // 129
+   { { UINT64_C(12570531809066599436), UINT64_C(9665057412182787256), UINT64_C(18037248161853567339) }, 7958 }, // 130
+   { { UINT64_C(12063953564883975361), UINT64_C(3730715905830069431), UINT64_C(14570373030559576463) }, 8021 }, // 131
+   { { UINT64_C(8016817416513654575), UINT64_C(8212217333050399186), UINT64_C(11769853602094125664) }, 8084 }, // 132
+   { { UINT64_C(771223596489753271), UINT64_C(17143645670704463595), UINT64_C(9507612023671560663) }, 8147 }, // 133
+   { { UINT64_C(15830487639310976345), UINT64_C(531255669507899694), UINT64_C(15360375659486665250) }, 8209 }, // 134
+   { { UINT64_C(17899172023487361674), UINT64_C(8417168408869944174), UINT64_C(12408012643612105667) }, 8272 }, // 135
+   { { UINT64_C(5191768201253056452), UINT64_C(15546622514016106056), UINT64_C(10023112792098411951) }, 8335 }, // 136
+   { { UINT64_C(8993318496775584539), UINT64_C(16626807943632499466), UINT64_C(16193212068468851415) }, 8397 }, // 137
+   { { UINT64_C(60830925525551437), UINT64_C(17929752859128990501), UINT64_C(13080772537106586753) }, 8460 }, // 138
+   { { UINT64_C(9965423588199967545), UINT64_C(2080014700930876482), UINT64_C(10566563906162742541) }, 8523 }, // 139
+   { { UINT64_C(5410919246703557050), UINT64_C(8986215472706226903), UINT64_C(17071204696250801201) }, 8585 }, // 140
+   { { UINT64_C(6219292162858793718), UINT64_C(3133138325004944573), UINT64_C(13790009333655137191) }, 8648 }, // 141
+   { { UINT64_C(13530360490399291232), UINT64_C(3857965557542396387), UINT64_C(11139480827856274782) }, 8711 }, // 142
+   { { UINT64_C(5390648170020119962), UINT64_C(15705464600344712494), UINT64_C(17996801903728244538) }, 8773 }, // 143
+   { { UINT64_C(8800856327649310916), UINT64_C(6501887475740607059), UINT64_C(14537700803438890538) }, 8836 }, // 144
+   { { UINT64_C(1119500562378156062), UINT64_C(12275437223055738469), UINT64_C(11743461187208226614) }, 8899 }, // 145
+   { { UINT64_C(3711327865259654609), UINT64_C(10413325417506210115), UINT64_C(9486292400710553220) }, 8962 }, // 146
+   { { UINT64_C(18140953976843546648), UINT64_C(6355160914804099239), UINT64_C(15325931950931419682) }, 9024 }, // 147
+   { { UINT64_C(13006186880138078158), UINT64_C(14188430869717747340), UINT64_C(12380189237419404506) }, 9087 }, // 148
+   { { UINT64_C(15627752008081497738), UINT64_C(2863577142538557267), UINT64_C(10000637223565413661) }, 9150 }, // 149
+   { { UINT64_C(8354747773559227917), UINT64_C(16154904691134217278), UINT64_C(16156900829120017275) }, 9212 }, // 150
+   { { UINT64_C(5311058177266302471), UINT64_C(1110798799754039795), UINT64_C(13051440551552750596) }, 9275 }, // 151
+   { { UINT64_C(12980072265928568692), UINT64_C(5333850539409099248), UINT64_C(10542869716926591416) }, 9338 }, // 152
+   { { UINT64_C(12698333673164547406), UINT64_C(868449381041846390), UINT64_C(17032924668972858150) }, 9400 }, // 153
+   { { UINT64_C(12838681677536507817), UINT64_C(14970843126061115908), UINT64_C(13759086973877485294) }, 9463 }, // 154
+   { { UINT64_C(797544863097811118), UINT64_C(3390097022844873758), UINT64_C(11114501944553088063) }, 9526 }, // 155
+   { { UINT64_C(16332878867159636811), UINT64_C(12977451181811781773), UINT64_C(17956446341244610582) }, 9588 }, // 156
+   { { UINT64_C(2730284483139516064), UINT64_C(4216916630931099004), UINT64_C(14505101839674110930) }, 9651 }, // 157
+   { { UINT64_C(10919257976780215818), UINT64_C(17119957496472855557), UINT64_C(11717127953989921585) }, 9714 }, // 158
+   { { UINT64_C(10236206895709372405), UINT64_C(12210663056608626568), UINT64_C(9465020584319909382) }, 9777 }, // 159
+   { { UINT64_C(12796852629962272567), UINT64_C(8477879217567207245), UINT64_C(15291565478056169088) }, 9839 }, // 160
+   { { UINT64_C(12026319849471429189), UINT64_C(3617064475781669527), UINT64_C(12352428221712142010) }, 9902 }, // 161
+   { { UINT64_C(11500334569480759160), UINT64_C(2708292140092722576), UINT64_C(9978212053665191381) }, 9965 }, // 162
+   { { UINT64_C(56895651595090767), UINT64_C(3980240667664277024), UINT64_C(16120671013153861838) }, 10027 }, // 163
+   { { UINT64_C(16706704986146512301), UINT64_C(399225724656056476), UINT64_C(13022174339283641302) }, 10090 }, // 164
+   { { UINT64_C(4770032631957183512), UINT64_C(8987268286967239931), UINT64_C(10519228658926719580) }, 10153 }, // 165
+   { { UINT64_C(1598033848952526228), UINT64_C(7303626623105794454), UINT64_C(16994730479836655727) }, 10215 }, // 166
+   { { UINT64_C(17270404750624314352), UINT64_C(8196485476094702762), UINT64_C(13728233953598530104) }, 10278 }, // 167
+   { { UINT64_C(13791946671490269591), UINT64_C(13402860128169952575), UINT64_C(11089579073250883825) }, 10341 }, // 168
+   { { UINT64_C(5709402097373640952), UINT64_C(4610728736793764859), UINT64_C(17916181271029107505) }, 10403 }, // 169
+   { { UINT64_C(13250945655055360775), UINT64_C(907066131584327324), UINT64_C(14472575974981385827) }, 10466 }, // 170
+   { { UINT64_C(3990532042496542704), UINT64_C(9483263503622178527), UINT64_C(11690853769731771931) }, 10529 }, // 171
+   { { UINT64_C(8162727151770603222), UINT64_C(8838783404432844286), UINT64_C(9443796467299413925) }, 10592 }, // 172
+   { { UINT64_C(6834743043476489957), UINT64_C(14000254694327983368), UINT64_C(15257276067669625000) }, 10654 }, // 173
+   { { UINT64_C(8255475711995142212), UINT64_C(8373370385534902690), UINT64_C(12324729456587509502) }, 10717 }, // 174
+   { { UINT64_C(11138533729325264904), UINT64_C(3736201945445750618), UINT64_C(9955837169385156266) }, 10780 }, // 175
+   { { UINT64_C(431788946631100536), UINT64_C(881693395257938591), UINT64_C(16084522437988700596) }, 10842 }, // 176
+   { { UINT64_C(9622129311807470982), UINT64_C(18113013657061270005), UINT64_C(12992973752810948684) }, 10905 }, // 177
+   { { UINT64_C(9642740525552332843), UINT64_C(17838044890457051393), UINT64_C(10495640613023018864) }, 10968 }, // 178
+   { { UINT64_C(1976656953483359664), UINT64_C(9979870670042508853), UINT64_C(16956621936360968045) }, 11030 }, // 179
+   { { UINT64_C(12169997991987944736), UINT64_C(14885051484024389202), UINT64_C(13697450117333175589) }, 11093 }, // 180
+   { { UINT64_C(1251866897072747731), UINT64_C(10373042511926286496), UINT64_C(11064712088349801740) }, 11156 }, // 181
+   { { UINT64_C(1211363584850067562), UINT64_C(14795868142491145608), UINT64_C(17876006490164216939) }, 11218 }, // 182
+   { { UINT64_C(5597045605829648836), UINT64_C(9078978501828633518), UINT64_C(14440123045445249271) }, 11281 }, // 183
+   { { UINT64_C(5111188248940053572), UINT64_C(1676790360487102118), UINT64_C(11664638502023918728) }, 11344 }, // 184
+   { { UINT64_C(13004650309445852976), UINT64_C(8832294996271695652), UINT64_C(9422619942689234610) }, 11407 }, // 185
+   { { UINT64_C(5503790067293662023), UINT64_C(6406956536375884807), UINT64_C(15223063546968858611) }, 11469 }  // 186
+  };
+
+static const struct ya_s__pow5_192 ya_s__pow5x27_neg[187] = /* 5^(-27q) rounded down to 192 bits */
+  {
+   { { UINT64_C(0), UINT64_C(0), UINT64_C(9223372036854775808) }, -191 }, // 0
+   { { UINT64_C(14576447477258439111), UINT64_C(8601490892183123069), UINT64_C(11417981541647679048) }, -254 }, // 1
+   { { UINT64_C(10845844145321538984), UINT64_C(12292541425473992838), UINT64_C(14134776518227074636) }, -317 }, // 2
+   { { UINT64_C(3933290470431885569), UINT64_C(18078137856785627587), UINT64_C(17498005798264095394) }, -380 }, // 3
+   { { UINT64_C(16791723050533251564), UINT64_C(4209185567039092847), UINT64_C(10830740992659433045) }, -442 }, // 4
+   { { UINT64_C(2422963254366584019), UINT64_C(10588892233814828051), UINT64_C(13407807929942597099) }, -505 }, // 5
+   { { UINT64_C(11796442215211893654), UINT64_C(915538744049291538), UINT64_C(16598062275523971834) }, -568 }, // 6
+   { { UINT64_C(4733321751740631165), UINT64_C(6088502188546649756), UINT64_C(10273702932711667006) }, -630 }, // 7
+   { { UINT64_C(18308159190397764632), UINT64_C(13658706619031801779), UINT64_C(12718228212127407596) }, -693 }, // 8
+   { { UINT64_C(11746114382721246818), UINT64_C(12626303854077184414), UINT64_C(15744403932561434696) }, -756 }, // 9
+   { { UINT64_C(14714928903009965783), UINT64_C(6518754469289960081), UINT64_C(9745314011399999080) }, -818 }, // 10
+   { { UINT64_C(7312877456945461814), UINT64_C(12622167777931096654), UINT64_C(12064114410120881697) }, -881 }, // 11
+   { { UINT64_C(5142877117464292730), UINT64_C(5910495864778290617), UINT64_C(14934650266808366570) }, -944 }, // 12
+   { { UINT64_C(12404635893250474763), UINT64_C(2331608335343510136), UINT64_C(9244100769003082158) }, -1006 }, // 13
+   { { UINT64_C(2198262806935169530), UINT64_C(11151074727959316332), UINT64_C(11443642469137689536) }, -1069 }, // 14
+   { { UINT64_C(7385447137030853759), UINT64_C(71470059335127820), UINT64_C(14166543207812157515) }, -1132 }, // 15
+   { { UINT64_C(7316337736195435801), UINT64_C(15011849280375967137), UINT64_C(17537331055217019373) }, -1195 }, // 16
+   { { UINT64_C(14103202838831886526), UINT64_C(5696216154156964046), UINT64_C(10855082147728038237) }, -1257 }, // 17
+   { { UINT64_C(17633310346684344172), UINT64_C(4772932334207156064), UINT64_C(13437940820404477744) }, -1320 }, // 18
+   { { UINT64_C(829333268050625567), UINT64_C(16740251359777916859), UINT64_C(16635364987126134419) }, -1383 }, // 19
+   { { UINT64_C(7100913079481586692), UINT64_C(7128227193264459789), UINT64_C(10296792192844783187) }, -1445 }, // 20
+   { { UINT64_C(14216267174562974780), UINT64_C(9461185205994795831), UINT64_C(12746811331723667806) }, -1508 }, // 21
+   { { UINT64_C(11416396944037428566), UINT64_C(10186031667391952129), UINT64_C(15779788120757327783) }, -1571 }, // 22
+   { { UINT64_C(7498820640776497804), UINT64_C(15292697544097298495), UINT64_C(9767215763062651668) }, -1633 }, // 23
+   { { UINT64_C(1924294362753552641), UINT64_C(15043126423462947183), UINT64_C(12091227465434564485) }, -1696 }, // 24
+   { { UINT64_C(6673104665909284083), UINT64_C(8706846492868475972), UINT64_C(14968214603568533729) }, -1759 }, // 25
+   { { UINT64_C(16552699568753912265), UINT64_C(5080748734853135729), UINT64_C(9264876087186816691) }, -1821 }, // 26
+   { { UINT64_C(4070572328529657527), UINT64_C(13854434214183956051), UINT64_C(11469361067346228139) }, -1884 }, // 27
+   { { UINT64_C(1864399069437327620), UINT64_C(2635895310500267756), UINT64_C(14198381290288800704) }, -1947 }, // 28
+   { { UINT64_C(14463596326899403882), UINT64_C(12821952533872881141), UINT64_C(17576744692288926220) }, -2010 }, // 29
+   { { UINT64_C(16602806357410238094), UINT64_C(9523368046504436294), UINT64_C(10879478007440626278) }, -2072 }, // 30
+   { { UINT64_C(10734262056672038510), UINT64_C(17215044641125702628), UINT64_C(13468141431935479609) }, -2135 }, // 31
+   { { UINT64_C(3292262988170964992), UINT64_C(562230480583377812), UINT64_C(16672751533351265378) }, -2198 }, // 32
+   { { UINT64_C(12374123499892168148), UINT64_C(6373160325474103154), UINT64_C(10319933344096124839) }, -2260 }, // 33
+   { { UINT64_C(1217578562457789387), UINT64_C(867268492163900636), UINT64_C(12775458689412862618) }, -2323 }, // 34
+   { { UINT64_C(14191993945999457265), UINT64_C(4313061247012631967), UINT64_C(15815251831860511949) }, -2386 }, // 35
+   { { UINT64_C(18197198419859366280), UINT64_C(3409894588884337146), UINT64_C(9789166737020792260) }, -2448 }, // 36
+   { { UINT64_C(4075876665827664702), UINT64_C(15282922283890973782), UINT64_C(12118401454998657408) }, -2511 }, // 37
+   { { UINT64_C(483715900293920914), UINT64_C(3656924790900430798), UINT64_C(15001854373277047436) }, -2574 }, // 38
+   { { UINT64_C(16250685864053289777), UINT64_C(134060048485734356), UINT64_C(9285698096104070993) }, -2636 }, // 39
+   { { UINT64_C(15060109261071124561), UINT64_C(8091471556669831570), UINT64_C(11495137465883254468) }, -2699 }, // 40
+   { { UINT64_C(3430231584453107977), UINT64_C(2265981110330937542), UINT64_C(14230290926106362696) }, -2762 }, // 41
+   { { UINT64_C(7990534383021921075), UINT64_C(10573662408427148730), UINT64_C(17616246908106501090) }, -2825 }, // 42
+   { { UINT64_C(6322944364126764309), UINT64_C(14240973270682584218), UINT64_C(10903928694741160380) }, -2887 }, // 43
+   { { UINT64_C(11521725381256129649), UINT64_C(1177483214894572133), UINT64_C(13498409916732857345) }, -2950 }, // 44
+   { { UINT64_C(17886349222831502918), UINT64_C(1255178659345470874), UINT64_C(16710222102610440107) }, -3013 }, // 45
+   { { UINT64_C(6585390787804390662), UINT64_C(11246673468877686437), UINT64_C(10343126503086499002) }, -3075 }, // 46
+   { { UINT64_C(3468171582131940315), UINT64_C(7956727830557014005), UINT64_C(12804170429564558480) }, -3138 }, // 47
+   { { UINT64_C(18302497400484111149), UINT64_C(6037967739409703245), UINT64_C(15850795244591853955) }, -3201 }, // 48
+   { { UINT64_C(8210662958382000244), UINT64_C(7485316810631166299), UINT64_C(9811167043897279264) }, -3263 }, // 49
+   { { UINT64_C(15814877415603027497), UINT64_C(11824657046487968333), UINT64_C(12145636515757626152) }, -3326 }, // 50
+   { { UINT64_C(18401618019672728176), UINT64_C(11798388195019393290), UINT64_C(15035569745462944921) }, -3389 }, // 51
+   { { UINT64_C(10768541614183880754), UINT64_C(5299185157236711194), UINT64_C(9306566900688236568) }, -3451 }, // 52
+   { { UINT64_C(2257773200172980410), UINT64_C(12401154473334364346), UINT64_C(11520971794650015324) }, -3514 }, // 53
+   { { UINT64_C(5541894242886307361), UINT64_C(4384107740847865629), UINT64_C(14262272276074798060) }, -3577 }, // 54
+   { { UINT64_C(14202402536110834370), UINT64_C(8118796454592531234), UINT64_C(17655837901742825460) }, -3640 }, // 55
+   { { UINT64_C(11196268262888481084), UINT64_C(4069170105856000539), UINT64_C(10928434332849909696) }, -3702 }, // 56
+   { { UINT64_C(3973297103941439736), UINT64_C(11280737333392521777), UINT64_C(13528746427335915784) }, -3765 }, // 57
+   { { UINT64_C(2127960866879831670), UINT64_C(18011058047191616547), UINT64_C(16747776883738171626) }, -3828 }, // 58
+   { { UINT64_C(10286994762809083069), UINT64_C(6624525705770228090), UINT64_C(10366371786698807910) }, -3890 }, // 59
+   { { UINT64_C(4119205967422820609), UINT64_C(18411773287728017898), UINT64_C(12832946696872779975) }, -3953 }, // 60
+   { { UINT64_C(16080546089097604793), UINT64_C(11895832046765409608), UINT64_C(15886418538073880277) }, -4016 }, // 61
+   { { UINT64_C(16186183790403832803), UINT64_C(12424746399312161894), UINT64_C(9833216794563586412) }, -4078 }, // 62
+   { { UINT64_C(18087999461684279465), UINT64_C(12178579265293720400), UINT64_C(12172932784963707263) }, -4141 }, // 63
+   { { UINT64_C(8121196776067530753), UINT64_C(1136291386356209958), UINT64_C(15069360890036265288) }, -4204 }, // 64
+   { { UINT64_C(7053350996251002979), UINT64_C(13558192075905833765), UINT64_C(9327482606108533657) }, -4266 }, // 65
+   { { UINT64_C(13412034000258627962), UINT64_C(13601161825405124873), UINT64_C(11546864183839699344) }, -4329 }, // 66
+   { { UINT64_C(6118077492096984505), UINT64_C(10688375649560031514), UINT64_C(14294325501365467851) }, -4392 }, // 67
+   { { UINT64_C(16637841247520237838), UINT64_C(9494720881115478087), UINT64_C(17695517872718380366) }, -4455 }, // 68
+   { { UINT64_C(15166704136689620248), UINT64_C(17882195265809660075), UINT64_C(10952995045264070290) }, -4517 }, // 69
+   { { UINT64_C(2087412363441864533), UINT64_C(5305303377500307144), UINT64_C(13559151116626778678) }, -4580 }, // 70
+   { { UINT64_C(14034596255276753677), UINT64_C(9323696601372564276), UINT64_C(16785416065993362218) }, -4643 }, // 71
+   { { UINT64_C(16438406460083135948), UINT64_C(15929788925315652652), UINT64_C(10389669312078638024) }, -4705 }, // 72
+   { { UINT64_C(6608749407583123326), UINT64_C(17680642698136387536), UINT64_C(12861787636356739011) }, -4768 }, // 73
+   { { UINT64_C(6034846907076697733), UINT64_C(13546046344402836538), UINT64_C(15922121891831679801) }, -4831 }, // 74
+   { { UINT64_C(13457225460618519565), UINT64_C(15336629062165755289), UINT64_C(9855316100140361498) }, -4893 }, // 75
+   { { UINT64_C(14780405376470282844), UINT64_C(3934015720225459728), UINT64_C(12200290400177599837) }, -4956 }, // 76
+   { { UINT64_C(964217415915307637), UINT64_C(12138154938644879928), UINT64_C(15103227977288905777) }, -5019 }, // 77
+   { { UINT64_C(5306460786722117296), UINT64_C(6310031026736521938), UINT64_C(9348445317770541242) }, -5081 }, // 78
+   { { UINT64_C(7339782568707762056), UINT64_C(4811560599038746928), UINT64_C(11572814763938093113) }, -5144 }, // 79
+   { { UINT64_C(9818472978594775086), UINT64_C(16695155600747225049), UINT64_C(14326450763511951840) }, -5207 }, // 80
+   { { UINT64_C(3772655222899712939), UINT64_C(2138413543196051340), UINT64_C(17735287021002051896) }, -5270 }, // 81
+   { { UINT64_C(1568068567187194846), UINT64_C(7620404878644432529), UINT64_C(10977610955758387514) }, -5332 }, // 82
+   { { UINT64_C(15495100852620412999), UINT64_C(8478791332539749396), UINT64_C(13589624137831159146) }, -5395 }, // 83
+   { { UINT64_C(13778026044077627061), UINT64_C(7627340714031136329), UINT64_C(16823139839060257201) }, -5458 }, // 84
+   { { UINT64_C(769518487465143372), UINT64_C(11116539846686981182), UINT64_C(10413019196634850397) }, -5520 }, // 85
+   { { UINT64_C(14224540356641108257), UINT64_C(15363834417133394870), UINT64_C(12890693393361565650) }, -5583 }, // 86
+   { { UINT64_C(17421653272993481967), UINT64_C(2415746954497228950), UINT64_C(15957905485793808547) }, -5646 }, // 87
+   { { UINT64_C(1855247153508000421), UINT64_C(10550716214038628466), UINT64_C(9877465071997986376) }, -5708 }, // 88
+   { { UINT64_C(7677453318925407034), UINT64_C(9006409566025500886), UINT64_C(12227709499269158760) }, -5771 }, // 89
+   { { UINT64_C(13938829679769375740), UINT64_C(13725607918587039346), UINT64_C(15137171177895479965) }, -5834 }, // 90
+   { { UINT64_C(12697801930442806287), UINT64_C(6085956213007426161), UINT64_C(9369455141316728239) }, -5896 }, // 91
+   { { UINT64_C(6450345750385150053), UINT64_C(15356243674901349961), UINT64_C(11598823665724238751) }, -5959 }, // 92
+   { { UINT64_C(17775976042709230508), UINT64_C(16964407038227912811), UINT64_C(14358648224410862569) }, -6022 }, // 93
+   { { UINT64_C(3984269545770220241), UINT64_C(5389330037575523155), UINT64_C(17775145547012138939) }, -6085 }, // 94
+   { { UINT64_C(9713383505606523505), UINT64_C(5156035377087190501), UINT64_C(11002282188385779767) }, -6147 }, // 95
+   { { UINT64_C(8206666193678461558), UINT64_C(10896094609689272506), UINT64_C(13620165644519131867) }, -6210 }, // 96
+   { { UINT64_C(1468730342167221722), UINT64_C(3981262279235505857), UINT64_C(16860948393049400856) }, -6273 }, // 97
+   { { UINT64_C(3624182730308095582), UINT64_C(3125212557861572089), UINT64_C(10436421558040172356) }, -6335 }, // 98
+   { { UINT64_C(18283542913566016411), UINT64_C(6636069956660791067), UINT64_C(12919664113559040583) }, -6398 }, // 99
+   { { UINT64_C(5628942544823763970), UINT64_C(16579397518706434686), UINT64_C(15993769500293196424) }, -6461 }, // 100
+   { { UINT64_C(4470578926005707294), UINT64_C(3142828381413259639), UINT64_C(9899663821757138215) }, -6523 }, // 101
+   { { UINT64_C(1580010590088291835), UINT64_C(8824347643166715544), UINT64_C(12255190220418089513) }, -6586 }, // 102
+   { { UINT64_C(665071790155122356), UINT64_C(12264799802642991927), UINT64_C(15171190662914177882) }, -6649 }, // 103
+   { { UINT64_C(12808038214147670821), UINT64_C(15205364609832414416), UINT64_C(9390512182626985891) }, -6711 }, // 104
+   { { UINT64_C(14803687219629774489), UINT64_C(9206193454903414073), UINT64_C(11624891020271092985) }, -6774 }, // 105
+   { { UINT64_C(4970756794028474893), UINT64_C(1451182990475842713), UINT64_C(14390918046322661236) }, -6837 }, // 106
+   { { UINT64_C(614408048572137607), UINT64_C(5263671853361631601), UINT64_C(17815093651617363205) }, -6900 }, // 107
+   { { UINT64_C(13966620475566483393), UINT64_C(9964100520749725874), UINT64_C(11027008867477963671) }, -6962 }, // 108
+   { { UINT64_C(4407862303430973029), UINT64_C(1898988781724981360), UINT64_C(13650775790605907001) }, -7025 }, // 109
+   { { UINT64_C(7773088689751815390), UINT64_C(5260560840363767043), UINT64_C(16898841918498594494) }, -7088 }, // 110
+   { { UINT64_C(518852066882725100), UINT64_C(17326549120211663680), UINT64_C(10459876514231790520) }, -7150 }, // 111
+   { { UINT64_C(5172860720107216756), UINT64_C(10583947443768127885), UINT64_C(12948699942948329247) }, -7213 }, // 112
+   { { UINT64_C(2169193538845506295), UINT64_C(574905303479902499), UINT64_C(16029714116068056033) }, -7276 }, // 113
+   { { UINT64_C(6938721711768621740), UINT64_C(10908117118132349901), UINT64_C(9921912461289352016) }, -7338 }, // 114
+   { { UINT64_C(8655082164604471237), UINT64_C(7961642156621620011), UINT64_C(12282732702114644531) }, -7401 }, // 115
+   { { UINT64_C(4836028758545968141), UINT64_C(13899872807589227367), UINT64_C(15205286603787628068) }, -7464 }, // 116
+   { { UINT64_C(15799922666811083935), UINT64_C(545134307473184939), UINT64_C(9411616547819161355) }, -7526 }, // 117
+   { { UINT64_C(15231457708732556312), UINT64_C(8381370111884744495), UINT64_C(11651016958946187690) }, -7589 }, // 118
+   { { UINT64_C(8415149727714679886), UINT64_C(383793977748632340), UINT64_C(14423260391872475411) }, -7652 }, // 119
+   { { UINT64_C(11323187617721696330), UINT64_C(16968315383278172421), UINT64_C(17855131536137881508) }, -7715 }, // 120
+   { { UINT64_C(3897155534985269583), UINT64_C(6204322513059621486), UINT64_C(11051791117646080645) }, -7777 }, // 121
+   { { UINT64_C(11808791666659979359), UINT64_C(10447277215881985674), UINT64_C(13681454730352605849) }, -7840 }, // 122
+   { { UINT64_C(10500865786705387299), UINT64_C(2430232324105083873), UINT64_C(16936820606373856681) }, -7903 }, // 123
+   { { UINT64_C(14829911096359338403), UINT64_C(9082842345379565503), UINT64_C(10483384183411945154) }, -7965 }, // 124
+   { { UINT64_C(18290417099211114545), UINT64_C(13897630691663681310), UINT64_C(12977801027856717597) }, -8028 }, // 125
+   { { UINT64_C(8993247298180817806), UINT64_C(5362606299030004832), UINT64_C(16065739514262793494) }, -8091 }, // 126
+   { { UINT64_C(2393444510762316152), UINT64_C(14842464004557889836), UINT64_C(9944211102717584396) }, -8153 }, // 127
+   { { UINT64_C(7697974614691938479), UINT64_C(5802604364043796934), UINT64_C(12310337083160321132) }, -8216 }, // 128
+   { { UINT64_C(9643570477961228115), UINT64_C(12602554396277103749), UINT64_C(15239459172343761566) }, -8279 }, // 129
+   { { UINT64_C(12466405780633155524), UINT64_C(10919799032751035110), UINT64_C(9432768343249592481) }, -8341 }, // 130
+   { { UINT64_C(7868092145021155610), UINT64_C(4655724605860267284), UINT64_C(11677201613412291926) }, -8404 }, // 131
+   { { UINT64_C(15244326965843502014), UINT64_C(13878634565582959249), UINT64_C(14455675424050918596) }, -8467 }, // 132
+   { { UINT64_C(2942359666994140657), UINT64_C(324845880927613754), UINT64_C(17895259402346300332) }, -8530 }, // 133
+   { { UINT64_C(9655565189715994620), UINT64_C(1441775759695716659), UINT64_C(11076629063781324886) }, -8592 }, // 134
+   { { UINT64_C(10793936639952835026), UINT64_C(2228550615368938372), UINT64_C(13712202618367038264) }, -8655 }, // 135
+   { { UINT64_C(8048056760836070420), UINT64_C(12954855928258814770), UINT64_C(16974884648070385617) }, -8718 }, // 136
+   { { UINT64_C(7318618680694670439), UINT64_C(14486734788396040799), UINT64_C(10506944684048525846) }, -8780 }, // 137
+   { { UINT64_C(14799974832391284300), UINT64_C(17443177178558898341), UINT64_C(13006967514940349526) }, -8843 }, // 138
+   { { UINT64_C(7189469638560176615), UINT64_C(1444729328919698897), UINT64_C(16101845876428921341) }, -8906 }, // 139
+   { { UINT64_C(14152576227627075146), UINT64_C(2776620847308710176), UINT64_C(9966559858416778634) }, -8968 }, // 140
+   { { UINT64_C(15406819860571482201), UINT64_C(14909018054918394915), UINT64_C(12338003502668561012) }, -9031 }, // 141
+   { { UINT64_C(11080404109297040235), UINT64_C(10470339301318470791), UINT64_C(15273708540796677855) }, -9094 }, // 142
+   { { UINT64_C(11766456851156044934), UINT64_C(15619285849791957542), UINT64_C(9453967675513643808) }, -9156 }, // 143
+   { { UINT64_C(9085046372221047073), UINT64_C(16257837788372969107), UINT64_C(11703445115628075455) }, -9219 }, // 144
+   { { UINT64_C(2558011948599105149), UINT64_C(13160656772983531531), UINT64_C(14488163306214911623) }, -9282 }, // 145
+   { { UINT64_C(1448259947631960211), UINT64_C(17568420695723064401), UINT64_C(17935477452468692664) }, -9345 }, // 146
+   { { UINT64_C(2803246354952570121), UINT64_C(16258318155898658972), UINT64_C(11101522831055572764) }, -9407 }, // 147
+   { { UINT64_C(3343633935489868607), UINT64_C(924518038668406591), UINT64_C(13743019609604481797) }, -9470 }, // 148
+   { { UINT64_C(13911044166084627418), UINT64_C(10108729552248825575), UINT64_C(17013034235413523684) }, -9533 }, // 149
+   { { UINT64_C(3521368151327392071), UINT64_C(1358530111077081553), UINT64_C(10530558134875668539) }, -9595 }, // 150
+   { { UINT64_C(17970602393396106332), UINT64_C(14460948488361938579), UINT64_C(13036199551184965946) }, -9658 }, // 151
+   { { UINT64_C(14661999041875289008), UINT64_C(17199285424738116883), UINT64_C(16138033384525973451) }, -9721 }, // 152
+   { { UINT64_C(6252206812701714313), UINT64_C(11117811173664323930), UINT64_C(9988958841014430987) }, -9783 }, // 153
+   { { UINT64_C(4405503737593257457), UINT64_C(6648719209334150558), UINT64_C(12365732100065451316) }, -9846 }, // 154
+   { { UINT64_C(8373289347452424319), UINT64_C(3199265132494311544), UINT64_C(15308034881747512731) }, -9909 }, // 155
+   { { UINT64_C(2136469316814956647), UINT64_C(11993365782536469128), UINT64_C(9475214651446243750) }, -9971 }, // 156
+   { { UINT64_C(10203877501098149125), UINT64_C(761960501676962349), UINT64_C(11729747597848773757) }, -10034 }, // 157
+   { { UINT64_C(13615974533435230142), UINT64_C(15962260925284990243), UINT64_C(14520724202088505894) }, -10097 }, // 158
+   { { UINT64_C(9694757616484405293), UINT64_C(8627230969229576941), UINT64_C(17975785889185617133) }, -10160 }, // 159
+   { { UINT64_C(13519524031497520241), UINT64_C(9478319409133610298), UINT64_C(11126472544922013635) }, -10222 }, // 160
+   { { UINT64_C(17656409267035444189), UINT64_C(8004292497952097378), UINT64_C(13773905859368462605) }, -10285 }, // 161
+   { { UINT64_C(16946166654917306273), UINT64_C(13320953091861069094), UINT64_C(17051269560659724153) }, -10348 }, // 162
+   { { UINT64_C(3573065383403620367), UINT64_C(10958815966572163882), UINT64_C(10554224654894353889) }, -10410 }, // 163
+   { { UINT64_C(3490475301857017858), UINT64_C(5990775082225749817), UINT64_C(13065497283906645528) }, -10473 }, // 164
+   { { UINT64_C(2807415962133728490), UINT64_C(4954225454099104338), UINT64_C(16174302220922422044) }, -10536 }, // 165
+   { { UINT64_C(17089194624215362424), UINT64_C(14431334549222215400), UINT64_C(10011408163391158287) }, -10598 }, // 166
+   { { UINT64_C(2581233427408145789), UINT64_C(15279968972596770743), UINT64_C(12393523015090427276) }, -10661 }, // 167
+   { { UINT64_C(4980564874725619765), UINT64_C(11412154924191724680), UINT64_C(15342438368185308136) }, -10724 }, // 168
+   { { UINT64_C(18214923501711788721), UINT64_C(9300001356126634857), UINT64_C(9496509378122422996) }, -10786 }, // 169
+   { { UINT64_C(1328036883611221892), UINT64_C(18032387325374307821), UINT64_C(11756109192626854527) }, -10849 }, // 170
+   { { UINT64_C(18348727233240809697), UINT64_C(17484057594061456915), UINT64_C(14553358275763708479) }, -10912 }, // 171
+   { { UINT64_C(1905137633164097419), UINT64_C(16493558087629774277), UINT64_C(18016184915633139415) }, -10975 }, // 172
+   { { UINT64_C(2818523183949288611), UINT64_C(564854273262554708), UINT64_C(11151478331115782061) }, -11037 }, // 173
+   { { UINT64_C(6442763538271333561), UINT64_C(15000818840820487323), UINT64_C(13804861523311538109) }, -11100 }, // 174
+   { { UINT64_C(4442066359940212892), UINT64_C(5148923458070234381), UINT64_C(17089590816497520073) }, -11163 }, // 175
+   { { UINT64_C(18163584677086009099), UINT64_C(406311039823462149), UINT64_C(10577944363373006984) }, -11225 }, // 176
+   { { UINT64_C(11455444856813250559), UINT64_C(11705008142334401831), UINT64_C(13094860860752547107) }, -11288 }, // 177
+   { { UINT64_C(12942813976404050609), UINT64_C(18110484314891213569), UINT64_C(16210652568396596727) }, -11351 }, // 178
+   { { UINT64_C(13802550874672961129), UINT64_C(10775124208577869576), UINT64_C(10033907938681266803) }, -11413 }, // 179
+   { { UINT64_C(15686052117192157266), UINT64_C(4642980367416716900), UINT64_C(12421376387796976441) }, -11476 }, // 180
+   { { UINT64_C(2668167699394487986), UINT64_C(17343594390154444977), UINT64_C(15376919173487883947) }, -11539 }, // 181
+   { { UINT64_C(1222434333939841689), UINT64_C(12655842801924098272), UINT64_C(9517851962857854120) }, -11601 }, // 182
+   { { UINT64_C(397853538311423932), UINT64_C(4205367066294547496), UINT64_C(11782530032812685691) }, -11664 }, // 183
+   { { UINT64_C(10112615546468910936), UINT64_C(1194809655406139434), UINT64_C(14586065691701309064) }, -11727 }, // 184
+   { { UINT64_C(4413319348207835763), UINT64_C(16856633217818443100), UINT64_C(18056674735403855955) }, -11790 }, // 185
+   { { UINT64_C(15954044698711198936), UINT64_C(5238278783331643235), UINT64_C(11176540315654591461) }, -11852 }  // 186
+  };
+
+#endif // YA_S__EXACT
+
+#endif // TABLE5_H_INCLUDE
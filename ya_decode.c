@@ -0,0 +1,328 @@
+/* ya_decode.c
+   ===========
+
+   Formats a binary log captured by ya_s_log_capture() (see ya_sprintf.h) into text, using all the cores of the machine.
+
+   The logging program only copies the arguments of each ya_s_log() call, and ya_s_log_capture() writes them out unformatted, so formatting
+   (the expensive part) can be done here, later and on another machine if need be. The file is memory mapped and split into chunks
+   at record boundaries, the chunks are formatted in parallel and the text is written out in the original order.
+
+   compile with:
+
+	gcc -Wall -O2 ya_decode.c double-double.c -lquadmath -lm -pthread -o ya_decode
+
+   then:
+
+	./ya_decode [-j threads] [-o output_file] log_file
+
+   The text goes to stdout unless -o is given, and the number of records per second (in total and per core used) is reported on stderr.
+   By default one thread per online cpu is used.
+
+   The log must have been captured by a program built with the same YA_SP_SPRINTF_LD and YA_SP_SPRINTF_Q options as used below
+   (those of ya-sprintf.c and main.c) on a machine with the same byte order and type sizes, as that decides how the arguments were packed.
+   This is checked, and ya_decode refuses to decode a log that does not match.
+
+   This needs POSIX (mmap() and pthreads), so it does not build with MinGW.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define YA_SP_SPRINTF_LD /* the same options as ya-sprintf.c and main.c, these must match the program that captured the log */
+#if defined(__SIZEOF_INT128__) && defined(YA_SP_SPRINTF_LD)
+#define YA_SP_SPRINTF_Q
+#endif
+#define YA_SP_LINUX_STYLE
+#define YA_SP_SIGNED_NANS
+#define YA_SP_LOG /* for ya_s_log_replay() */
+#define YA_SP_FORMAT_CACHE /* each format string is used many times */
+
+#define YA_SP_SPRINTF_IMPLEMENTATION
+#include "ya_sprintf.h"
+
+#define CHUNK_BYTES (8u << 20) /* binary log bytes formatted by one thread at a time */
+#define LOG_DEF 0x80000000u /* id bit of a record that defines a format string */
+#define LOG_IDS 4096 /* ids are below this (YA_S__LOG_IDS in ya_sprintf.h) */
+
+typedef struct {
+	char *buf; /* formatted text */
+	size_t len, size;
+	int failed; /* out of memory */
+} outbuf;
+
+typedef struct {
+	unsigned char const *start, *end; /* whole records */
+	char const **fmts; /* format strings by id (in the file) as defined before start, updated by the definitions in the chunk */
+	outbuf out;
+	unsigned long long records;
+	unsigned long long bad; /* records with short arguments or an unknown format string id */
+	pthread_t thread;
+} chunk;
+
+/* sink callbacks that grow an outbuf */
+static char *out_reserve(void *user, int want, int *avail)
+{
+	outbuf *o = (outbuf *)user;
+	if (o->size - o->len < (size_t)want) {
+		size_t size = o->size ? o->size * 2 : 1u << 20;
+		char *p;
+		while (size - o->len < (size_t)want)
+			size *= 2;
+		p = (char *)realloc(o->buf, size);
+		if (p == NULL) {
+			o->failed = 1;
+			return 0;
+		}
+		o->buf = p;
+		o->size = size;
+	}
+	*avail = (o->size - o->len > 0x40000000) ? 0x40000000 : (int)(o->size - o->len);
+	return o->buf + o->len;
+}
+
+static void out_commit(void *user, int len)
+{
+	((outbuf *)user)->len += (size_t)len;
+}
+
+static void *format_chunk(void *arg)
+{
+	chunk *c = (chunk *)arg;
+	unsigned char const *p = c->start;
+	ya_s_sink sink = { out_reserve, out_commit, NULL, NULL };
+	sink.user = &c->out;
+	while (p < c->end) {
+		uint32_t len, id;
+		memcpy(&len, p, 4);
+		memcpy(&id, p + 4, 4);
+		if (id & LOG_DEF)
+			c->fmts[id & ~LOG_DEF] = (char const *)p + 8;
+		else {
+			++c->records;
+			if ((id >= LOG_IDS) || (c->fmts[id] == NULL) || (ya_s_log_replay(&sink, c->fmts[id], p + 8, (int)(len - 8)) < 0))
+				++c->bad;
+			if (c->out.failed)
+				break;
+		}
+		p += len;
+	}
+	return NULL;
+}
+
+/* a copy of the format strings defined so far, for a chunk starting here */
+static char const **copy_fmts(char const *const *fmts)
+{
+	char const **f = (char const **)malloc(LOG_IDS * sizeof(char *));
+	if (f)
+		memcpy(f, fmts, LOG_IDS * sizeof(char *));
+	return f;
+}
+
+static int write_all(int fd, char const *p, size_t n)
+{
+	while (n) {
+		ssize_t w = write(fd, p, n);
+		if (w < 0 && errno == EINTR)
+			continue;
+		if (w <= 0)
+			return -1;
+		p += w;
+		n -= (size_t)w;
+	}
+	return 0;
+}
+
+static double now(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+	char const *in_name = NULL, *out_name = NULL;
+	int ncpus = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	int nthreads = ncpus, cores, fd, out_fd = 1, hdr, i;
+	struct stat st;
+	unsigned char const *map, *p, *e, *chunk_start;
+	static char const *fmts[LOG_IDS]; /* format strings by id, pointing into the file */
+	char const **chunk_fmts;
+	chunk *chunks = NULL;
+	size_t nchunks = 0, maxchunks = 0, next;
+	unsigned long long records = 0, bad = 0;
+	double t0, secs;
+
+	for (i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+			nthreads = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+			out_name = argv[++i];
+		else if (argv[i][0] != '-' && in_name == NULL)
+			in_name = argv[i];
+		else {
+			in_name = NULL;
+			break;
+		}
+	}
+	if (in_name == NULL) {
+		fprintf(stderr, "usage: %s [-j threads] [-o output_file] log_file\n", argv[0]);
+		return 2;
+	}
+	if (nthreads < 1)
+		nthreads = 1;
+
+	fd = open(in_name, O_RDONLY);
+	if (fd < 0 || fstat(fd, &st) < 0) {
+		fprintf(stderr, "ya_decode: cannot open %s: %s\n", in_name, strerror(errno));
+		return 1;
+	}
+	if (st.st_size == 0) {
+		fprintf(stderr, "ya_decode: %s is empty\n", in_name);
+		return 1;
+	}
+	map = (unsigned char const *)mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (map == MAP_FAILED) {
+		fprintf(stderr, "ya_decode: cannot map %s: %s\n", in_name, strerror(errno));
+		return 1;
+	}
+	madvise((void *)map, (size_t)st.st_size, MADV_SEQUENTIAL);
+	hdr = ya_s_log_capture_check(map, (size_t)st.st_size);
+	if (hdr < 0) {
+		fprintf(stderr, "ya_decode: %s is not a log captured by a program built with the same options as ya_decode\n", in_name);
+		return 1;
+	}
+	t0 = now();
+
+	/* one pass over the record headers to follow the format string definitions (ids are reused, so each chunk gets the ones in force
+	   at its start) and split the file into chunks at record boundaries */
+	p = chunk_start = map + hdr;
+	e = map + st.st_size;
+	chunk_fmts = copy_fmts(fmts);
+	if (chunk_fmts == NULL) {
+		fprintf(stderr, "ya_decode: out of memory\n");
+		return 1;
+	}
+	while (p < e) {
+		uint32_t len, id;
+		if ((size_t)(e - p) < 8)
+			break;
+		memcpy(&len, p, 4);
+		memcpy(&id, p + 4, 4);
+		if ((len < 8) || (len > (size_t)(e - p)))
+			break;
+		if (id & LOG_DEF) {
+			if (((id & ~LOG_DEF) >= LOG_IDS) || (len == 8) || (p[len - 1] != 0))
+				break;
+			fmts[id & ~LOG_DEF] = (char const *)p + 8;
+		}
+		p += len;
+		if ((size_t)(p - chunk_start) >= CHUNK_BYTES || p >= e) {
+			if (nchunks == maxchunks) {
+				maxchunks = maxchunks ? maxchunks * 2 : 64;
+				chunks = (chunk *)realloc(chunks, maxchunks * sizeof(chunk));
+				if (chunks == NULL) {
+					fprintf(stderr, "ya_decode: out of memory\n");
+					return 1;
+				}
+			}
+			memset(&chunks[nchunks], 0, sizeof(chunk));
+			chunks[nchunks].start = chunk_start;
+			chunks[nchunks].end = p;
+			chunks[nchunks].fmts = chunk_fmts;
+			++nchunks;
+			chunk_start = p;
+			chunk_fmts = copy_fmts(fmts);
+			if (chunk_fmts == NULL) {
+				fprintf(stderr, "ya_decode: out of memory\n");
+				return 1;
+			}
+		}
+	}
+	if (p < e)
+		fprintf(stderr, "ya_decode: %s is truncated or corrupt after %llu bytes, the rest is ignored\n", in_name,
+				(unsigned long long)(p - map));
+	if (p > chunk_start) { /* the records before the bad one */
+		if (nchunks == maxchunks) {
+			chunks = (chunk *)realloc(chunks, (maxchunks + 1) * sizeof(chunk));
+			if (chunks == NULL) {
+				fprintf(stderr, "ya_decode: out of memory\n");
+				return 1;
+			}
+		}
+		memset(&chunks[nchunks], 0, sizeof(chunk));
+		chunks[nchunks].start = chunk_start;
+		chunks[nchunks].end = p;
+		chunks[nchunks].fmts = chunk_fmts;
+		++nchunks;
+	} else
+		free(chunk_fmts);
+
+	if (out_name) {
+		out_fd = open(out_name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (out_fd < 0) {
+			fprintf(stderr, "ya_decode: cannot create %s: %s\n", out_name, strerror(errno));
+			return 1;
+		}
+	}
+
+	/* format nthreads chunks at once, then write their text out in order (so at most nthreads chunks of text are held in memory) */
+	for (next = 0; next < nchunks;) {
+		size_t n = nchunks - next, j;
+		if (n > (size_t)nthreads)
+			n = (size_t)nthreads;
+		for (j = 1; j < n; ++j)
+			if (pthread_create(&chunks[next + j].thread, NULL, format_chunk, &chunks[next + j])) {
+				fprintf(stderr, "ya_decode: cannot create a thread\n");
+				return 1;
+			}
+		format_chunk(&chunks[next]); /* this thread does one chunk too */
+		for (j = 0; j < n; ++j) {
+			chunk *c = &chunks[next + j];
+			if (j)
+				pthread_join(c->thread, NULL);
+			if (c->out.failed) {
+				fprintf(stderr, "ya_decode: out of memory\n");
+				return 1;
+			}
+			if (write_all(out_fd, c->out.buf, c->out.len)) {
+				fprintf(stderr, "ya_decode: write failed: %s\n", strerror(errno));
+				return 1;
+			}
+			records += c->records;
+			bad += c->bad;
+			free(c->out.buf);
+			c->out.buf = NULL;
+			free(c->fmts);
+			c->fmts = NULL;
+		}
+		next += n;
+	}
+	secs = now() - t0;
+	if (out_name && close(out_fd)) {
+		fprintf(stderr, "ya_decode: write failed: %s\n", strerror(errno));
+		return 1;
+	}
+
+	if (bad)
+		fprintf(stderr, "ya_decode: %llu records could not be formatted\n", bad);
+	if (secs <= 0)
+		secs = 1e-9;
+	cores = nthreads; /* the cores actually kept busy */
+	if (ncpus > 0 && cores > ncpus)
+		cores = ncpus;
+	if (nchunks < (size_t)cores)
+		cores = nchunks ? (int)nchunks : 1;
+	fprintf(stderr, "ya_decode: %llu records (%llu MB) in %.3f secs with %d threads: %.0f records/sec, %.0f records/sec per core\n",
+			records, (unsigned long long)(st.st_size >> 20), secs, nthreads, (double)records / secs, (double)records / secs / cores);
+	return 0;
+}
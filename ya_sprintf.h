@@ -38,9 +38,10 @@ This library can also be used standalone where extra precision is required in ca
 Also supplied are:
 atof.c - a MIT licensed implementation of strtod() for floats, doubles, long doubles and __float128's . This is used in the test program, but can be used standalone
 main.c	- a test program that checks all functions of ya_sprintf.h
+ya_decode.c - formats a binary log captured by ya_s_log_capture() using all the cores of the machine (Linux etc only)
 
 To compile the test program under Linux try:
- gcc -Wall -Ofast -fsanitize=address -fsanitize=undefined -fsanitize-address-use-after-scope -fstack-protector-all -g3  main.c atof.c double-double.c -lasan -lquadmath -lm  -o test
+ gcc -Wall -Ofast -fsanitize=address -fsanitize=undefined -fsanitize-address-use-after-scope -fstack-protector-all -g3  main.c atof.c double-double.c hr_timer.c -lasan -lquadmath -lm -pthread -o test
  
  then ./test to run
  
@@ -219,6 +220,13 @@ The conversion specifiers and their meanings are:
  p  The argument is a pointer to void. The value of the pointer is converted to a hex number.
 	If YA_SP_LINUX_STYLE is defined before including ya_sprintf the hex number will be preceded with 0x
  n  The argument is a pointer to an integer into which is written the number of bytes written to the output so far by this call to one of the fprintf() functions. No argument is converted.
+ r, R
+    The double argument is converted to the shortest string of decimal digits that converts back to exactly the same double (e.g. with fast_strtod()),
+	if there is more than one such string the one closest to the exact value is used. 
+	The result is in style f if the decimal exponent X is -4 <= X < 17 (the same rule as %.17g) , and otherwise in style e (E for R). Any precision is ignored.
+	This is useful for JSON, CSV files etc, e.g. 0.1 gives "0.1" not "0.10000000000000001" as it would with %.17g.
+	For long double (%Lr) and __float128 (%Qr) arguments this is the same as %.21Lg and %.36Qg respectively.
+	Note the r and R conversion specifiers are not defined by C99 or or POSIX.1-2017.
  %  Print a '%' character; no argument is converted. The complete conversion specification is %%.
 
 If a conversion specification does not match one of the above forms, the format is just treated as a string and "printed" as is. 
@@ -231,8 +239,11 @@ For the a and A conversion specifiers, the value is rounded to a hexadecimal flo
 If YA_SP_LINUX_STYLE is defined before including ya_sprintf the rounding is towards even.
 
 For the e, E, f, F, g, and G conversion specifiers, if the number of significant decimal digits is at most 19, then the result will be correctly rounded (towards even).
-This means that float and doubles can be printed exactly (the value output from va_sprintf if fed to fast_strtod() will give a bitwise identical value to the original double),
- but long doubles or __float128's cannot always be printed exactly if this would need more than 20 digits.
+This means that float and doubles can be printed exactly (the value output from va_sprintf if fed to fast_strtod() will give a bitwise identical value to the original double).
+Where long doubles are x87 80 bit extended precision (e.g. gcc on x86 and x86-64) long doubles are converted exactly using 128 bit integers and are correctly rounded for up to 32 significant digits
+ (which is more than the 21 digits needed to uniquely identify a long double), any further digits are output as zeros. 
+ Otherwise (or if YA_SP_LD_APPROX is defined) long doubles cannot always be printed exactly if this would need more than 20 digits.
+__float128's are converted exactly from their 113 bit mantissa and are correctly rounded for up to 36 significant digits (enough to uniquely identify a __float128), any further digits are output as zeros.
 %a/%A will always print an exact representation of float, double, long double and __float128.
 
 */
@@ -258,13 +269,67 @@ API:
   Convert a va_list arg list into a buffer.  ya_s_vsnprintf always returns
   a zero-terminated string (unlike regular snprintf).
 
+ int ya_s_vsprintfsink( ya_s_sink const * sink, char const * fmt, va_list va )
+    typedef struct ya_s_sink { char *(*reserve)(void *user, int want, int *avail); void (*commit)(void *user, int len); void (*flush)(void *user); void *user; } ya_s_sink;
+  Convert directly into storage owned by the sink (eg a socket send buffer, a slot in a ring buffer or an mmap'd file page), so there is no copy.
+  reserve() returns a pointer to at least want characters (want is never more than YA_SP_SPRINTF_MIN) and sets *avail to how many
+  characters can actually be written there (as many as is convenient, the more the fewer calls), or returns 0 to stop converting.
+  commit() is then called with the number of characters written at that pointer (which may be 0) before the next reserve().
+  flush() (which may be NULL) is called once at the end of the conversion, but not if reserve() stopped it.
+  No terminating zero is written. Returns the number of characters converted.
+  This function is actually the workhorse for everything else (except the plain buffer and snprintf() versions which have their own inlined sinks).
+  Long numbers (eg %'Lf of 1e4932 or %.5000x) are streamed through the sink, so the stack used is bounded (measured with gcc -O2 on x86-64, and checked by main.c):
+  under 1.2KB for any conversion, except that the exact long double and __float128 conversions need up to 2.8KB in the rare cases that use the big number
+  comparison ya_s__exact_cmp() (a 1.5KB array). ya_s_vsnprintf() adds about 0.7KB for its YA_SP_SPRINTF_MIN byte buffer on the stack (so 3.5KB at worst),
+  ya_s_vfprintf() uses a thread local buffer of YA_SP_IO_BUF chars (see ya_s_vdprintf() below).
+
  int ya_s_vsprintfcb( YA_S_SPRINTFCB * callback, void * user, char * buf, char const * fmt, va_list va )
     typedef char * YA_S_SPRINTFCB( char const * buf, void * user, int len );
   Convert into a buffer, calling back every YA_SP_SPRINTF_MIN chars.
   Your callback can then copy the chars out, print them or whatever.
-  This function is actually the workhorse for everything else.
+  This is a thin adapter over ya_s_vsprintfsink() (callback can be NULL to write into an unbounded buffer like ya_s_vsprintf()).
   The buffer you pass in must hold at least YA_SP_SPRINTF_MIN characters.
   you return the next buffer to use or 0 to stop converting
+
+ int ya_s_vsprintfcb_ex( YA_S_SPRINTFCB * callback, void * user, char * buf, int buflen, char const * fmt, va_list va )
+  As ya_s_vsprintfcb() but calling back every buflen chars (at least 2), so buf (and the buffers the callback returns) need only hold buflen characters.
+  A large buflen (eg 64KB) means far fewer callbacks for bulk output, a small one suits threads with little stack.
+
+ int ya_s_vformat_length( char const * fmt, va_list va )
+ int ya_s_format_length( char const * fmt, ... )
+  Returns the number of characters ya_s_sprintf() would write for these arguments (not counting the trailing 0), without writing them.
+  Integers, strings and chars (with their padding) are measured without being converted, only floats (and %'x, %$d and 128 bit integers)
+  are converted, one at a time into nothing, so this is much faster than ya_s_vsnprintf(NULL, 0, ...) for most format strings.
+  %n is handled as for ya_s_sprintf(), so size a buffer with this and then fill it with ya_s_sprintf().
+
+ int ya_s_compile_format( ya_s_format_program *prog, char const *fmt )
+  Parse a format string once into a compact program (literal runs plus the flags, width, precision and conversion of each specifier).
+  Returns 1 on success, or 0 if fmt is NULL or has more than YA_SP_FORMAT_MAXOPS conversions (prog is then not usable).
+  The program points into fmt for its literal text, so fmt must remain valid (and unchanged) while the program is in use.
+
+ int ya_s_exec( YA_S_SPRINTFCB * callback, void * user, char * buf, ya_s_format_program const *prog, va_list va )
+  Runs a program created by ya_s_compile_format() against a va_list, without re-parsing the format string.
+  Arguments and results are the same as ya_s_vsprintfcb() (callback can be NULL to write into an unbounded buffer like ya_s_vsprintf()),
+  and the output is identical to that of ya_s_vsprintfcb() with the original format string.
+
+ int ya_s_execsink( ya_s_sink const * sink, ya_s_format_program const *prog, va_list va )
+  As ya_s_exec() but the output goes to a sink, as for ya_s_vsprintfsink().
+
+ void ya_s_format_cache_stats( unsigned long long *hits, unsigned long long *misses )
+  Only present when YA_SP_FORMAT_CACHE and YA_SP_FORMAT_CACHE_STATS are defined.
+  With YA_SP_FORMAT_CACHE ya_s_vsprintfcb() (and so every other function here) looks up the format string's address in a small lock-free
+  cache of compiled programs, so a format string is normally only parsed the 1st time its used.
+  A cached program is only used if the format string's contents are unchanged, so format strings built in buffers are still handled correctly.
+  That check is a strcmp() of the format string on every hit, which costs a good part of what parsing it would have cost: for a typical
+  log line the cache saves about 10%. If every format string is a string literal (or is otherwise never changed, or freed and its memory
+  reused, while the program runs) define YA_SP_FORMAT_CACHE_BY_ADDRESS to skip it. A format string is then known only by its address,
+  so a buffer reused for a different format string would be formatted with the program of the old one.
+  Nothing is ever removed from the cache (so lookups never need to lock or pin a slot), the 1st format strings seen keep their slots for
+  good. Once the 4 slots a format string's address can go in are taken it is parsed every time, as without the cache. Each slot is about
+  1.2KB (for the default YA_SP_FORMAT_CACHE_MAXLEN and YA_SP_FORMAT_MAXOPS) so the default 256 slots are about 300KB.
+  So the cache suits programs with a fixed set of format strings, for ones that build many format strings at run time leave it out.
+  Returns the total number of cache hits and misses so far (either pointer may be NULL). These are only counted with YA_SP_FORMAT_CACHE_STATS
+  as every thread writing to the same counters would slow down lookups on every core.
     
 The following 2 functions write to streams (files):    
  int ya_s_vfprintfFILE *stream, const char *format, va_list va)
@@ -274,14 +339,132 @@ The next 2 functions write to stdout:
  int ya_s_vprintf(const char *format, va_list va) 
  int ya_s_printf(const char *format, ...)    
 
+The next 2 functions write directly to a file descriptor with write(), bypassing stdio (and the FILE lock it takes for every fwrite()):
+ int ya_s_vdprintf(int fd, const char *format, va_list va)
+ int ya_s_dprintf(int fd, const char *format, ...)
+  The output is formatted into a thread local buffer of YA_SP_IO_BUF chars, so there is one write() per call unless the output is longer than that.
+  That buffer is shared with ya_s_vfprintf() and ya_s_vmpsc_printf() and costs YA_SP_IO_BUF bytes of thread local storage in every thread (define
+  YA_SP_IO_BUF smaller if you have many threads). A call made while it is in use (from a stream's write hook, or a signal handler that interrupted
+  one of these functions) does not touch it but uses a YA_SP_SPRINTF_MIN char buffer on its stack instead, so these functions can be nested.
+  Returns the number of characters written, or -1 if a write() failed.
+
+To batch the output of several calls into one write() use a ya_s_dbuf:
+    typedef struct ya_s_dbuf { int fd; char *buf; int size; int len; int err; } ya_s_dbuf;
+ void ya_s_dbuf_init(ya_s_dbuf *b, int fd, char *buf, int size)
+  Set up b to collect output in buf (size chars, supplied by the caller) for the file descriptor fd.
+ int ya_s_vbprintf(ya_s_dbuf *b, const char *format, va_list va)
+ int ya_s_bprintf(ya_s_dbuf *b, const char *format, ...)
+  Append to b's buffer, which is only written to fd when it fills up. If the output of a call does not fit it is completed in a YA_SP_SPRINTF_MIN
+  char buffer on the stack and both are written with a single writev(), so a line is not split between two writes.
+  Returns the number of characters converted, or -1 if a write() failed (since the last ya_s_dbuf_flush()).
+ int ya_s_dbuf_flush(ya_s_dbuf *b)
+  Write out anything left in b's buffer. Returns 0, or -1 if a write() failed since the last ya_s_dbuf_flush().
+
+When YA_SP_MPSC is defined many threads can share one file descriptor through a lock-free ring, instead of taking the stdio lock of a
+shared FILE (which ya_s_fprintf() does for every call) or making a write() call each:
+    typedef struct ya_s_mpsc { ... } ya_s_mpsc;
+ void ya_s_mpsc_init(ya_s_mpsc *r, int fd, void *mem, unsigned int size)
+  Set up r as a ring in mem (size bytes, rounded down to a power of 2) whose output goes to fd. mem must remain valid while r is in use.
+ int ya_s_vmpsc_printf(ya_s_mpsc *r, const char *format, va_list va)
+ int ya_s_mpsc_printf(ya_s_mpsc *r, const char *format, ...)
+  Format in the calling thread (into the thread local YA_SP_IO_BUF buffer, or straight into the ring if the output is longer than that),
+  then take space in the ring with one atomic fetch-add and mark it ready with one atomic store. Any number of threads can call this at once.
+  If the ring is full the caller writes it out itself (or waits for the thread that is doing so), so nothing is lost.
+  Returns the number of characters, or -1 if the output is longer than half the ring or a write() has failed.
+ int ya_s_mpsc_write(ya_s_mpsc *r)
+  Write out everything that is ready, in the order the space was taken, with one writev() per batch of up to 128 lines.
+  This is meant to be called in a loop by one writer thread (it returns 0 straight away if another thread is already writing):
+      while (running) if (ya_s_mpsc_write(&r) == 0) sleep_a_little();
+      ya_s_mpsc_write(&r); // once all the other threads have stopped
+  Returns the number of characters written, or -1 if a write() failed (the output is then discarded, and r->err set).
+
+The next functions return the output in a string they allocate, formatting it only once:
+ int ya_s_vasprintf(char **strp, const char *format, va_list va)
+ int ya_s_asprintf(char **strp, const char *format, ...)
+  *strp is set to a 0 terminated string allocated with realloc() (free() it when done). Short strings are formatted into a YA_SP_SPRINTF_MIN
+  char buffer on the stack and then allocated at their exact size, longer ones are moved to the heap and grown by doubling as they are formatted.
+  Returns the number of characters in the string, or -1 (with *strp set to NULL) if out of memory. Not present if YA_SP_NO_MALLOC is defined.
+    typedef struct ya_s_arena { void *(*grow)(void *user, void *ptr, size_t oldsize, size_t newsize); void *user; } ya_s_arena;
+ int ya_s_vasprintf_arena(ya_s_arena const *arena, char **strp, const char *format, va_list va)
+ int ya_s_asprintf_arena(ya_s_arena const *arena, char **strp, const char *format, ...)
+  As ya_s_asprintf() but the string comes from arena->grow(arena->user, ptr, oldsize, newsize), which returns a block of newsize bytes
+  holding the first oldsize bytes of ptr (a new block when ptr is NULL), or NULL if out of memory. Nothing is freed, but if a call runs out
+  of memory the block it had so far is resized to 0 bytes.
+    typedef struct ya_s_bump { char *mem; size_t size; size_t used; } ya_s_bump;
+ void ya_s_bump_init(ya_s_bump *b, void *mem, size_t size)
+ void *ya_s_bump_grow(void *user, void *ptr, size_t oldsize, size_t newsize)
+ void ya_s_bump_reset(ya_s_bump *b)
+  A bump allocator to use as an arena, eg ya_s_arena a = { ya_s_bump_grow, &b }; . Strings are carved off the front of mem (size bytes),
+  a string that is still the last one is grown where it is, and ya_s_bump_reset() frees them all at once (eg at the end of a request).
+
+When YA_SP_LOG is defined there is also a logger that defers formatting, so a latency critical thread only copies its arguments:
+    typedef struct ya_s_log_ring { ... } ya_s_log_ring;
+ void ya_s_log_ring_init(ya_s_log_ring *r, void *mem, unsigned int size)
+  Set up r as a ring buffer in mem (size bytes, rounded down to a power of 2) and register it with ya_s_log_drain().
+  r and mem must remain valid from then on, as rings are never unregistered.
+ void ya_s_log_attach(ya_s_log_ring *r)
+  Make r the calling thread's ring (NULL to stop logging). Only one thread at a time may log into a ring.
+ int ya_s_vlog(char const *fmt, va_list va)
+ int ya_s_log(char const *fmt, ...)
+  Walk fmt (or use its compiled program from the format cache) only to find the types of the arguments, then copy them (and the bytes of
+  any strings) and the fmt pointer into the thread's ring. Nothing is converted and there are no locks or system calls.
+  fmt must remain valid (and unchanged) until it has been drained, which is normally the case for a string literal.
+  Returns 0, or -1 if the thread has no ring or the ring is full (the record is then dropped and counted in r->dropped).
+  %n is ignored, as the length of the output is not known.
+ int ya_s_log_drain(ya_s_sink const *sink)
+  Format every record waiting in every ring to sink, with the same output as ya_s_sprintf() would have given, then call sink->flush once.
+  Records from one thread are in order. This is meant to be called in a loop by one background thread (only one thread may drain at once):
+      while (running) if (ya_s_log_drain(&sink) == 0) sleep_a_little();
+  Returns the number of records formatted.
+ int ya_s_log_replay(ya_s_sink const *sink, char const *fmt, void const *args, int len)
+  Format one record's arguments (len bytes at args, packed by ya_s_log()) for fmt to sink, without calling sink->flush.
+  Returns the number of chars, or -1 if the arguments are short (eg a corrupt file).
+
+ To format the log somewhere else, or later, capture it to a file and format that with ya_decode (see ya_decode.c):
+ int ya_s_log_capture_start(ya_s_dbuf *b)
+  Write the file header to b (see ya_s_dbuf_init() above). Returns 0, or -1 if a write() failed.
+ int ya_s_log_capture(ya_s_dbuf *b)
+  As ya_s_log_drain(), but the records are copied to b's file without being formatted, then b is flushed (only one thread may drain or capture
+  at once). Returns the number of records, or -1 if a write() failed.
+  The file is the 16 byte header then records, each a uint32 length (including the 8 byte record header) and a uint32 id, in the byte order
+  of the writer. If the top bit of the id is set the rest is the nul terminated text of format string (id & 0x7fffffff), otherwise the rest is
+  the arguments of one ya_s_log() call with the format string most recently defined with that id, as taken by ya_s_log_replay().
+  Ids are below 4096 and are reused, so a reader must take the definitions in file order. Each call writes out the text of every format
+  string it uses (once), as the text at a pointer may have changed since the last call, so capturing a few records at a time makes the file larger.
+ int ya_s_log_capture_check(void const *p, size_t len)
+  Check the file header at p (len bytes) was written by a program with the same type sizes, byte order and YA_SP_SPRINTF_LD/Q/NOFLOAT options,
+  so its arguments can be replayed here. Returns the length of the header, or -1 if not.
+
  void ya_s_set_separators( char comma, char period )
-  Set the comma and period (decimal point) characters to use.
+  Set the comma and period (decimal point) characters used by threads that have not set a locale of their own.
+  This changes a global, so call it before starting threads that format numbers.
+
+To format for several locales at once (eg a server formatting for many clients) use a ya_s_locale:
+    typedef struct ya_s_locale { char comma; char period; unsigned char grouping; char const *inf; char const *nan; } ya_s_locale;
+  comma and period are as above, grouping is the number of digits between commas for %'d, %'f etc (1 to 9, 0 means 3),
+  and inf and nan (if not NULL) replace inf/INF and nan/NAN in the output of floating point conversions (at most 31 chars, the sign is still added).
+ ya_s_locale const *ya_s_set_locale(ya_s_locale const *loc)
+  Make loc the calling thread's locale (NULL to go back to the default) and return the previous one. loc must remain valid while in use.
+  Every function here reads it with a single thread local load per call (no locks or atomics), so threads with different locales do not interact.
+  Records from ya_s_log() are formatted with the locale of the thread that drains them.
+ int ya_s_vsprintfcb_locale( YA_S_SPRINTFCB * callback, void * user, char * buf, int buflen, ya_s_locale const * loc, char const * fmt, va_list va )
+  As ya_s_vsprintfcb_ex() but with the locale loc (NULL for the default) for this call only, including anything formatted by the callback.
 
 */
 
 /* compile time options are done by defining (#define) specific names before # including ya_sprintf.h
 #define YA_SP_SPRINTF_STATIC // make the definitions of the exported functions static
-#define YA_SP_SPRINTF_MIN XXX // XXX is the number of characters per callback , default 512 (see ya_s_vsprintfcb() above)
+#define YA_SP_SPRINTF_MIN XXX // XXX is the number of characters per callback and the most a sink is asked to reserve, default 512 (see ya_s_vsprintfcb() and ya_s_vsprintfsink() above)
+#define YA_SP_LOG // add ya_s_log() and the other deferred formatting functions above. Needs gcc or clang for atomics.
+#define YA_SP_MPSC // add ya_s_mpsc_printf() and the other shared ring functions above. Needs gcc or clang for atomics.
+#define YA_SP_NO_MALLOC // leave out ya_s_asprintf() and ya_s_vasprintf() so nothing here calls realloc() or free()
+#define YA_SP_IO_BUF XXX // XXX is the size of the thread local buffer used by ya_s_vfprintf(), ya_s_vdprintf() and ya_s_vmpsc_printf(), default 16384
+#define YA_SP_FORMAT_MAXOPS XXX // XXX is the maximum number of conversions in a program created by ya_s_compile_format(), default 32
+#define YA_SP_FORMAT_CACHE // cache compiled format strings inside ya_s_vsprintfcb() (see ya_s_format_cache_stats() above). Needs gcc or clang for atomics.
+#define YA_SP_FORMAT_CACHE_SLOTS XXX // XXX is the number of format strings that can be cached (must be a power of 2), default 256
+#define YA_SP_FORMAT_CACHE_MAXLEN XXX // XXX is the maximum length of a format string that will be cached, default 128
+#define YA_SP_FORMAT_CACHE_BY_ADDRESS // with YA_SP_FORMAT_CACHE, trust that a format string at a cached address is unchanged (see ya_s_format_cache_stats() above)
+#define YA_SP_FORMAT_CACHE_STATS // with YA_SP_FORMAT_CACHE, count cache hits and misses for ya_s_format_cache_stats() (all threads add to the same 2 counters)
 #define STB_SPRINTF_IMPLEMENTATION // for backwards compatibility with stb_sprintf()
 #define YA_SP_SPRINTF_DECORATE PREFIX // define the names of the exported functions as PREFIXname , default ya_s_. If this is not defined then vsprintf, vsnprintf, sprintf, snprintf, vfprintf, vprintf, fprintf & printf are defined via macros to equal the ya_s_ versions.
 #define YA_SP_SPRINTF_IMPLEMENTATION // actually include code from header file (see "use" at the start of this file for examples)
@@ -291,6 +474,9 @@ The next 2 functions write to stdout:
 #define YA_SP_NO_DIGITPAIR // selects an alternative way to convert numbers to ascii characters. This may or may not be faster. Its likley this option will be removed in future releases.
 #define YA_SP_LINUX_STYLE // make subtle changes to the output to match gcc 9.3.0 under Ubuntu . By default matches TDM-GCC 9.2.0 under windows 10 with #define __USE_MINGW_ANSI_STDIO 1
 #define YA_SP_SIGNED_NANS // if defined print NAN's as signed numbers. Default is that a NAN is considered unsigned.
+#define YA_SP_NO_SIMD // do not use the SSE2 integer to decimal conversion (used by default for %d, %u etc when the compiler targets SSE2, which includes all x86-64 targets) or the SSE2/AVX2 scan for the next % in the format string.
+#define YA_SP_DD_SCALING // without YA_SP_SPRINTF_LD use the original double-double scaling for %e, %f and %g rather than the exact integer scaling with the powers of 5 in table5.h.
+#define YA_SP_LD_APPROX // use the original long double conversion (correctly rounded to 19 digits) for %Le, %Lf and %Lg rather than the exact integer conversion used by default for x87 long doubles.
 */
 
 
@@ -321,6 +507,30 @@ The next 2 functions write to stdout:
 #endif
 typedef char *YA_S_SPRINTFCB(const char *buf, void *user, int len);
 
+typedef struct ya_s_sink {
+   char *(*reserve)(void *user, int want, int *avail); // space for at least want chars (*avail set to the actual space), or 0 to stop
+   void (*commit)(void *user, int len); // len chars were written into the space from the last reserve()
+   void (*flush)(void *user); // end of the conversion, may be NULL
+   void *user;
+} ya_s_sink;
+
+#ifndef YA_SP_FORMAT_MAXOPS
+#define YA_SP_FORMAT_MAXOPS 32 // max number of conversions in a compiled format string
+#endif
+typedef struct ya_s_format_op {
+   char const *lit;  // literal text before this conversion (points into the original format string)
+   int litlen;       // number of characters of literal text
+   unsigned int fl;  // flags and length modifiers
+   int fw;           // field width, -1 if given by an int argument (*)
+   int pr;           // precision, -1 if none, -2 if given by an int argument (.*)
+   char conv;        // conversion character, 0 for the last op which only holds the trailing literal text
+} ya_s_format_op;
+
+typedef struct ya_s_format_program {
+   int nops;
+   ya_s_format_op op[YA_SP_FORMAT_MAXOPS + 1]; // +1 for the trailing literal text
+} ya_s_format_program;
+
 #ifdef STB_SPRINTF_IMPLEMENTATION  /* provide some backwards compatability with stb_sprintf for common situation where header file is just included into program */
  #define YA_SP_SPRINTF_DECORATE(name) stbsp_##name  /* make function names the same as they were */
  #define YA_SP_SPRINTF_IMPLEMENTATION /* this is the implementation */
@@ -347,9 +557,30 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsnprintf)(char *buf, int count, char
 YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(sprintf)(char *buf, char const *fmt, ...);
 YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(snprintf)(char *buf, int count, char const *fmt, ...);
 
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfsink)(ya_s_sink const *sink, char const *fmt, va_list va);
 YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback, void *user, char *buf, char const *fmt, va_list va);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb_ex)(YA_S_SPRINTFCB *callback, void *user, char *buf, int buflen, char const *fmt, va_list va);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vformat_length)(char const *fmt, va_list va);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(format_length)(char const *fmt, ...);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(compile_format)(ya_s_format_program *prog, char const *fmt);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(exec)(YA_S_SPRINTFCB *callback, void *user, char *buf, ya_s_format_program const *prog, va_list va);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(execsink)(ya_s_sink const *sink, ya_s_format_program const *prog, va_list va);
 YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(set_separators)(char comma, char period);
 
+// locale: the separators and spellings used by the conversions, for one call or for a thread
+typedef struct ya_s_locale {
+   char comma; // added between groups of digits by the ' flag
+   char period; // the decimal point
+   unsigned char grouping; // digits per group for decimal conversions with the ' flag, 1 to 9 (anything else means 3)
+   char const *inf; // spelling of an infinity (the sign is still added), or NULL for inf (INF for upper case conversions)
+   char const *nan; // spelling of a NaN, or NULL for nan (NAN)
+} ya_s_locale;
+YA_S__PUBLICDEF ya_s_locale const *YA_SP_SPRINTF_DECORATE(set_locale)(ya_s_locale const *loc);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb_locale)(YA_S_SPRINTFCB *callback, void *user, char *buf, int buflen, ya_s_locale const *loc, char const *fmt, va_list va);
+#if defined(YA_SP_FORMAT_CACHE) && defined(YA_SP_FORMAT_CACHE_STATS)
+YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(format_cache_stats)(unsigned long long *hits, unsigned long long *misses);
+#endif
+
 YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vfprintf)(FILE *stream, const char *format, va_list va);
 
 // as above but to stdout
@@ -361,6 +592,89 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(fprintf)(FILE *stream, const char *fo
 // printf(): like fprintf() but to stdout
 YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(printf) (const char *format, ...);
 
+// dprintf(): write() directly to a file descriptor
+#ifndef YA_SP_IO_BUF
+#define YA_SP_IO_BUF 16384 // size of the thread local buffer used by vfprintf(), vdprintf() and vmpsc_printf()
+#endif
+typedef struct ya_s_dbuf {
+   int fd;
+   char *buf;
+   int size;
+   int len; // chars waiting to be written
+   int err; // a write() failed
+} ya_s_dbuf;
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vdprintf)(int fd, const char *format, va_list va);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(dprintf)(int fd, const char *format, ...);
+YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(dbuf_init)(ya_s_dbuf *b, int fd, char *buf, int size);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vbprintf)(ya_s_dbuf *b, const char *format, va_list va);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(bprintf)(ya_s_dbuf *b, const char *format, ...);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(dbuf_flush)(ya_s_dbuf *b);
+
+#ifdef YA_SP_MPSC
+// mpsc_printf(): many threads format into a shared lock-free ring, which one thread writes out to a file descriptor
+typedef struct ya_s_mpsc {
+   char *mem;
+   unsigned int size; // bytes in mem, a power of 2
+   int fd;
+   int err; // a write() failed
+   int writing; // a thread is in ya_s_mpsc_write()
+   char pad0[64]; // head and tail are on their own cache lines
+   unsigned int head; // bytes taken, by an atomic fetch-add from any thread
+   char pad1[64];
+   unsigned int tail; // bytes written out, only changed by the writing thread
+   char pad2[64];
+} ya_s_mpsc;
+YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(mpsc_init)(ya_s_mpsc *r, int fd, void *mem, unsigned int size);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vmpsc_printf)(ya_s_mpsc *r, const char *format, va_list va);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(mpsc_printf)(ya_s_mpsc *r, const char *format, ...);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(mpsc_write)(ya_s_mpsc *r);
+#endif
+
+// asprintf(): into a string that is allocated (and grown) while it is being formatted
+typedef struct ya_s_arena {
+   void *(*grow)(void *user, void *ptr, size_t oldsize, size_t newsize); // resize ptr (NULL for a new block) keeping its first oldsize bytes, NULL if out of memory
+   void *user;
+} ya_s_arena;
+typedef struct ya_s_bump { // a bump allocator for ya_s_arena: strings are carved off the front of mem and all freed at once by ya_s_bump_reset()
+   char *mem;
+   size_t size;
+   size_t used;
+} ya_s_bump;
+#ifndef YA_SP_NO_MALLOC
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vasprintf)(char **strp, const char *format, va_list va);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(asprintf)(char **strp, const char *format, ...);
+#endif
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vasprintf_arena)(ya_s_arena const *arena, char **strp, const char *format, va_list va);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(asprintf_arena)(ya_s_arena const *arena, char **strp, const char *format, ...);
+YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(bump_init)(ya_s_bump *b, void *mem, size_t size);
+YA_S__PUBLICDEF void *YA_SP_SPRINTF_DECORATE(bump_grow)(void *user, void *ptr, size_t oldsize, size_t newsize);
+YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(bump_reset)(ya_s_bump *b);
+
+#ifdef YA_SP_LOG
+// log(): deferred formatting, the arguments are copied to a per thread ring and formatted later by ya_s_log_drain()
+typedef struct ya_s_log_ring {
+   char *mem;
+   unsigned int size; // bytes in mem, a power of 2
+   unsigned int dropped; // records that did not fit
+   struct ya_s_log_ring *next;
+   char pad0[64]; // head and tail are on their own cache lines
+   unsigned int head; // bytes written, only changed by the producer
+   unsigned int tail_seen; // the producer's copy of tail
+   char pad1[64];
+   unsigned int tail; // bytes read, only changed by the consumer
+   char pad2[64];
+} ya_s_log_ring;
+YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(log_ring_init)(ya_s_log_ring *r, void *mem, unsigned int size);
+YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(log_attach)(ya_s_log_ring *r);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vlog)(char const *fmt, va_list va);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(log)(char const *fmt, ...);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(log_drain)(ya_s_sink const *sink);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(log_replay)(ya_s_sink const *sink, char const *fmt, void const *args, int len);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(log_capture_start)(ya_s_dbuf *b);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(log_capture)(ya_s_dbuf *b);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(log_capture_check)(void const *p, size_t len);
+#endif
+
 #endif // YA_SP_SPRINTF_H_INCLUDE
 
 #ifdef YA_SP_SPRINTF_IMPLEMENTATION
@@ -368,8 +682,40 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(printf) (const char *format, ...);
 #include <stdlib.h> // for va_arg()
 #include <string.h> // strlen() , memcpy(), memset() 
 #include <stdint.h>  /* for int64_t etc */
+#include <float.h> // LDBL_MANT_DIG
+#include <errno.h> // EINTR
+#include <limits.h> // INT_MAX
+#ifdef _WIN32
+#include <io.h> // _write()
+#else
+#include <unistd.h> // write()
+#include <sys/uio.h> // writev()
+#include <sched.h> // sched_yield()
+#endif
+#if !defined(YA_SP_SPRINTF_NOFLOAT) && (defined(YA_SP_SPRINTF_LD) || defined(YA_SP_SPRINTF_Q)) && !defined(YA_SP_LD_APPROX) && defined(__SIZEOF_INT128__) && LDBL_MANT_DIG == 64 && (defined(__x86_64__) || defined(__i386__))
+#define YA_S__LD_EXACT /* long doubles are x87 80 bit extended precision and 128 bit integers are available so use the exact integer conversion for long doubles */
+#endif
+#if !defined(YA_SP_SPRINTF_NOFLOAT) && defined(YA_SP_SPRINTF_Q) && defined(__SIZEOF_INT128__)
+#define YA_S__Q_EXACT /* use the exact integer conversion for __float128's */
+#endif
+#if !defined(YA_SP_SPRINTF_NOFLOAT) && !defined(YA_SP_SPRINTF_LD) && !defined(YA_SP_DD_SCALING)
+#define YA_S__DBL_EXACT /* use the exact integer scaling with the powers of 5 in table5.h for %e, %f and %g of doubles */
+#endif
+#if defined(YA_S__LD_EXACT) || defined(YA_S__Q_EXACT)
+#define YA_S__EXACT /* include the exact conversion code (and the tables it needs from table5.h) */
+#endif
+#if !defined(YA_SP_NO_SIMD) && defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#define YA_S__SIMD_DEC /* convert integers to decimal 8 or 16 digits at a time using SSE2 */
+#include <emmintrin.h>
+#if !defined(__SANITIZE_ADDRESS__)
+#define YA_S__SIMD_SCAN /* find the next % in the format string 16 (or 32 with AVX2) bytes at a time, the aligned loads may read past the end of the string (but not the page) so not with -fsanitize=address */
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#endif
+#endif
 #include "double-double.h"
-#include "table10.h"
+#include "table5.h"
 
 /* the line below defines GCC_OPTIMIZE_AWARE to 1 when we can use # pragma GCC optimize ("-O2") */
 #define YA_SP_GCC_OPTIMIZE_AWARE (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7)) || defined(__clang__)
@@ -391,6 +737,10 @@ static int32_t ya_s__real_to_str(char const **start, uint32_t *len, char *out, i
 #else 
 static int32_t ya_s__real_to_str(char const **start, uint32_t *len, char *out, int32_t *decimal_pos, double value, uint32_t frac_digits);
 #endif
+#ifdef YA_S__Q_EXACT
+static int32_t ya_s__real_to_str_q(char const **start, uint32_t *len, char *out, int32_t *decimal_pos, __float128 value, uint32_t frac_digits);
+#endif
+static int32_t ya_s__shortest_to_str(char const **start, uint32_t *len, char *out, int32_t *decimal_pos, double value);
 #define YA_S__SPECIAL 0x7000
 
 #define YA_SP_STATIC_ASSERT(condition) extern int static_assert_##__FILE__##__LINE__[!!(condition)-1]  /* check at compile time and works in a global or function context see https://scaryreasoner.wordpress.com/2009/02/28/checking-sizeof-at-compile-time/ */
@@ -409,8 +759,14 @@ typedef __float128 ya_s__f128_t;
 #endif
 
 
-static char ya_s__period = '.';
-static char ya_s__comma = ',';
+#if defined(_MSC_VER)
+#define YA_S__THREAD __declspec(thread)
+#else
+#define YA_S__THREAD __thread
+#endif
+
+static ya_s_locale ya_s__default_locale = { ',', '.', 3, NULL, NULL }; // for threads that have not set their own, changed by set_separators()
+static YA_S__THREAD ya_s_locale const *ya_s__locale; // this thread's locale, NULL for the default
 #ifndef YA_SP_NO_DIGITPAIR
 static struct
 {
@@ -425,11 +781,209 @@ static struct
    "75767778798081828384858687888990919293949596979899"
 };
 #endif
+#ifdef YA_S__SIMD_DEC
+/* integer to decimal conversion 8 digits per SSE2 register half, based on the algorithm by Wojciech Mula (see http://0x80.pl/articles/sse-itoa.html).
+   abcdefgh is split into abcd and efgh (divide by 10000 via a multiply), each of which is broadcast to 4 16 bit lanes and divided by 1000,100,10,1 using
+   mulhi's to give a,ab,abc,abcd ; subtracting 10* the lane to the left then gives the individual digits a,b,c,d */
+static __m128i ya_s__dec8_sse2(uint32_t v) // v < 100000000, returns the 8 digits (as 0..9) in the 8 16 bit lanes, most significant first
+{
+   const __m128i abcdefgh = _mm_cvtsi32_si128((int)v);
+   const __m128i abcd = _mm_srli_epi64(_mm_mul_epu32(abcdefgh, _mm_set1_epi32((int)0xd1b71759)), 45); // v/10000
+   const __m128i efgh = _mm_sub_epi32(abcdefgh, _mm_mul_epu32(abcd, _mm_set1_epi32(10000)));
+   const __m128i v1 = _mm_slli_epi64(_mm_unpacklo_epi16(abcd, efgh), 2); // [abcd*4,efgh*4,0...]
+   const __m128i v2a = _mm_unpacklo_epi16(v1, v1);
+   const __m128i v2 = _mm_unpacklo_epi32(v2a, v2a); // [abcd*4 x4,efgh*4 x4]
+   const __m128i v3 = _mm_mulhi_epu16(v2, _mm_setr_epi16(8389, 5243, 13108, (short)32768, 8389, 5243, 13108, (short)32768));
+   const __m128i v4 = _mm_mulhi_epu16(v3, _mm_setr_epi16(1 << 7, 1 << 11, 1 << 13, (short)(1 << 15), 1 << 7, 1 << 11, 1 << 13, (short)(1 << 15))); // [a,ab,abc,abcd,e,ef,efg,efgh]
+   const __m128i v5 = _mm_slli_epi64(_mm_mullo_epi16(v4, _mm_set1_epi16(10)), 16); // [0,a0,ab0,abc0,0,e0,ef0,efg0]
+   return _mm_sub_epi16(v4, v5);
+}
+
+// write the decimal digits of v (without leading zeros) so they end just before end, returns a pointer to the 1st digit. Writes up to 16 bytes below end.
+static char *ya_s__u64_to_dec(char *end, uint64_t v)
+{
+   __m128i d;
+   uint32_t z;
+   if (v < 100000000) {
+      d = _mm_add_epi8(_mm_packus_epi16(ya_s__dec8_sse2((uint32_t)v), _mm_setzero_si128()), _mm_set1_epi8('0'));
+      _mm_storel_epi64((__m128i *)(void *)(end - 8), d);
+      z = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(d, _mm_set1_epi8('0'))) & 0x7f; // 1 bits for the leading '0's (always keep the last digit so 0 gives "0")
+      return end - 8 + __builtin_ctz(~z);
+   }
+   if (v >= 10000000000000000ULL) { // > 16 digits, top 4 digits one at a time
+      uint32_t t = (uint32_t)(v / 10000000000000000ULL);
+      char *s = end - 16;
+      v -= t * 10000000000000000ULL;
+      do {
+         *--s = (char)(t % 10) + '0';
+         t /= 10;
+      } while (t);
+      d = _mm_add_epi8(_mm_packus_epi16(ya_s__dec8_sse2((uint32_t)(v / 100000000)), ya_s__dec8_sse2((uint32_t)(v % 100000000))), _mm_set1_epi8('0'));
+      _mm_storeu_si128((__m128i *)(void *)(end - 16), d);
+      return s;
+   }
+   d = _mm_add_epi8(_mm_packus_epi16(ya_s__dec8_sse2((uint32_t)(v / 100000000)), ya_s__dec8_sse2((uint32_t)(v % 100000000))), _mm_set1_epi8('0'));
+   _mm_storeu_si128((__m128i *)(void *)(end - 16), d);
+   z = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(d, _mm_set1_epi8('0')));
+   return end - 16 + __builtin_ctz(~z);
+}
+
+// write exactly 16 decimal digits (with leading zeros) of v < 10^16 into out[0..15]
+static void ya_s__u64_to_dec16(char *out, uint64_t v)
+{
+   _mm_storeu_si128((__m128i *)(void *)out, _mm_add_epi8(_mm_packus_epi16(ya_s__dec8_sse2((uint32_t)(v / 100000000)), ya_s__dec8_sse2((uint32_t)(v % 100000000))), _mm_set1_epi8('0')));
+}
+
+// write exactly 8 decimal digits (with leading zeros) of v < 10^8 into out[0..7]
+static void ya_s__u32_to_dec8(char *out, uint32_t v)
+{
+   _mm_storel_epi64((__m128i *)(void *)out, _mm_add_epi8(_mm_packus_epi16(ya_s__dec8_sse2(v), _mm_setzero_si128()), _mm_set1_epi8('0')));
+}
+#endif
+
+static const uint64_t ya_s__pow10_u64[20] = {
+   1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL,
+   1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+   1000000000000000000ULL, 10000000000000000000ULL
+};
+
+// number of decimal digits in v (1 for v==0)
+static uint32_t ya_s__u64_digits(uint64_t v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+   // floor(log10(v)) is (bits*1233)>>12 or one less, so one compare with a power of 10 corrects it
+   uint32_t t = ((64 - (uint32_t)__builtin_clzll(v | 1)) * 1233) >> 12;
+   return t + (v >= ya_s__pow10_u64[t]) + (v == 0);
+#else
+   uint32_t t = 1;
+   while (t < 20 && v >= ya_s__pow10_u64[t])
+      ++t;
+   return t;
+#endif
+}
+
+// write exactly nd decimal digits of v to out[0..nd-1] (nd is normally ya_s__u64_digits(v)). Nothing is written outside this range.
+static void ya_s__u64_to_dec_n(char *out, uint64_t v, uint32_t nd)
+{
+   char *s = out + nd;
+#ifdef YA_S__SIMD_DEC
+   if (nd >= 16) {
+      uint64_t q = v / 10000000000000000ULL;
+      s -= 16;
+      ya_s__u64_to_dec16(s, v - q * 10000000000000000ULL);
+      v = q;
+   } else if (nd >= 8) {
+      uint64_t q = v / 100000000;
+      s -= 8;
+      ya_s__u32_to_dec8(s, (uint32_t)(v - q * 100000000));
+      v = q;
+   }
+#endif
+#ifndef YA_SP_NO_DIGITPAIR
+   while (s - out >= 2) {
+      s -= 2;
+      memcpy(s, &ya_s__digitpair.pair[(v % 100) * 2], 2);
+      v /= 100;
+   }
+#endif
+   while (s != out) {
+      *--s = (char)(v % 10) + '0';
+      v /= 10;
+   }
+}
+
+// returns a pointer to the first % or terminating 0 in f, so the literal text before it can be copied with memcpy()
+static char const *ya_s__scan_literal(char const *f)
+{
+#ifdef YA_S__SIMD_SCAN
+   // the loads are aligned so they never cross into the next page, bytes before f in the first block are masked off
+#ifdef __AVX2__
+   const __m256i pct = _mm256_set1_epi8('%'), zero = _mm256_setzero_si256();
+   char const *p = (char const *)((uintptr_t)f & ~(uintptr_t)31);
+   __m256i v = _mm256_load_si256((__m256i const *)p);
+   uint32_t m = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, pct), _mm256_cmpeq_epi8(v, zero))) >> (f - p);
+   if (m)
+      return f + __builtin_ctz(m);
+   for (;;) {
+      p += 32;
+      v = _mm256_load_si256((__m256i const *)p);
+      m = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(_mm256_cmpeq_epi8(v, pct), _mm256_cmpeq_epi8(v, zero)));
+      if (m)
+         return p + __builtin_ctz(m);
+   }
+#else
+   const __m128i pct = _mm_set1_epi8('%'), zero = _mm_setzero_si128();
+   char const *p = (char const *)((uintptr_t)f & ~(uintptr_t)15);
+   __m128i v = _mm_load_si128((__m128i const *)p);
+   uint32_t m = (uint32_t)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, pct), _mm_cmpeq_epi8(v, zero))) >> (f - p);
+   if (m)
+      return f + __builtin_ctz(m);
+   for (;;) {
+      p += 16;
+      v = _mm_load_si128((__m128i const *)p);
+      m = (uint32_t)_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, pct), _mm_cmpeq_epi8(v, zero)));
+      if (m)
+         return p + __builtin_ctz(m);
+   }
+#endif
+#else
+   while (*f != '%' && *f != 0)
+      ++f;
+   return f;
+#endif
+}
+
+#ifdef YA_SP_SPRINTF_Q
+// x / 10^16 without a call to a 128 bit divide: x / 10^16 = (x >> 16) / 5^16 and (x >> 16) < 2^112 so a multiply by m = ceil(2^150 / 5^16) (113 bits)
+// keeping the top bits of the 241 bit product gives the exact quotient (m*5^16 - 2^150 <= 2^38, see Granlund & Montgomery, "Division by invariant integers using multiplication").
+static ya_s__uint128_t ya_s__u128_div1e16(ya_s__uint128_t x)
+{
+   const uint64_t m_hi = 0x1cd2b297d889bULL, m_lo = 0xc2b6985d7cd0f314ULL;
+   ya_s__uint128_t y = x >> 16;
+   uint64_t y_lo = (uint64_t)y, y_hi = (uint64_t)(y >> 64);
+   ya_s__uint128_t ll = (ya_s__uint128_t)y_lo * m_lo, lh = (ya_s__uint128_t)y_lo * m_hi, hl = (ya_s__uint128_t)y_hi * m_lo;
+   ya_s__uint128_t mid = (ll >> 64) + (uint64_t)lh + (uint64_t)hl;
+   return ((ya_s__uint128_t)y_hi * m_hi + (lh >> 64) + (hl >> 64) + (mid >> 64)) >> 22;
+}
+#endif
+
+
 YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(set_separators)(char pcomma, char pperiod)
 {
-   ya_s__period = pperiod;
-   ya_s__comma = pcomma;
+   ya_s__default_locale.period = pperiod;
+   ya_s__default_locale.comma = pcomma;
+}
+
+YA_S__PUBLICDEF ya_s_locale const *YA_SP_SPRINTF_DECORATE(set_locale)(ya_s_locale const *loc)
+{
+   ya_s_locale const *old = ya_s__locale;
+   ya_s__locale = loc;
+   return old;
+}
+
+// the locale in use, a plain thread local read
+#define ya_s__cur_locale() (ya_s__locale ? ya_s__locale : &ya_s__default_locale)
+// digits per group for the ' flag with decimal conversions
+#define ya_s__grouping(loc) (((loc)->grouping - 1u < 9u) ? (uint32_t)(loc)->grouping : 3u)
+
+#ifndef YA_SP_SPRINTF_NOFLOAT
+// the spelling of an infinity or NaN: sn is a built in one ([-]inf or [-]nan, in either case), replaced by loc's (keeping the sign) if it has one
+static char const *ya_s__special(ya_s_locale const *loc, char const *sn, char *buf)
+{
+   int neg = (sn[0] == '-');
+   char const *w = ((sn[neg] | 0x20) == 'i') ? loc->inf : loc->nan;
+   size_t n;
+   if (w == NULL)
+      return sn;
+   n = strlen(w);
+   if (n > 31)
+      n = 31;
+   buf[0] = '-';
+   memcpy(buf + 1, w, n);
+   buf[n + 1] = 0;
+   return neg ? buf : buf + 1;
 }
+#endif
 
 /* following constants must increase as powers of 2 */
 #define YA_S__LEFTJUST 1
@@ -448,6 +1002,7 @@ YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(set_separators)(char pcomma, char pp
 #define YA_S__QUARTWIDTH 8192
 #define YA_S__L 16384 /* %Lg etc for long double - needs YA_SP_SPRINTF_LD defined to work */
 #define YA_S__Q 32768 /* %Qg etc for __float128 - needs YA_SP_SPRINTF_Q defined to work */
+#define YA_S__PRECISION_COMMAS 65536 /* set while printing: leading zeros from the precision keep their commas (%'x etc with a large precision) */
 
 static void ya_s__lead_sign(uint32_t fl, char *sign)
 {
@@ -464,69 +1019,13 @@ static void ya_s__lead_sign(uint32_t fl, char *sign)
    }
 }
 
-YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback, void *user, char *buf, char const *fmt, va_list va)
+// parse the flags, field width, precision and length modifiers of a conversion specification.
+// f points to the character after the %, returns a pointer to the conversion character.
+// A field width of * is returned as fw=-1 and a precision of .* as pr=-2, the caller must then read these from the argument list.
+static inline char const *ya_s__parse_spec(char const *f, uint32_t *pfl, int32_t *pfw, int32_t *ppr)
 {
-   static char hex[] = "0123456789abcdefxp";
-   static char hexu[] = "0123456789ABCDEFXP";
-   char *bf;
-   char const *f;
-   int tlen = 0;
-   if(fmt==NULL) return 0; // PMi - just in case ! 
-   bf = buf;
-   f = fmt;
-   for (;;) {
-      int32_t fw, pr, tz;
-      uint32_t fl;
-
-      // macros for the callback buffer stuff
-      #define ya_s__chk_cb_bufL(bytes)                        \
-         {                                                     \
-            int len = (int)(bf - buf);                         \
-            if ((len + (bytes)) >= YA_SP_SPRINTF_MIN) {          \
-               tlen += len;                                    \
-               if (0 == (bf = buf = callback(buf, user, len))) \
-                  goto done;                                   \
-            }                                                  \
-         }
-      #define ya_s__chk_cb_buf(bytes)    \
-         {                                \
-            if (callback) {               \
-               ya_s__chk_cb_bufL(bytes); \
-            }                             \
-         }
-      #define ya_s__flush_cb()                      \
-         {                                           \
-            ya_s__chk_cb_bufL(YA_SP_SPRINTF_MIN - 1); \
-         } // flush if there is even one byte in the buffer
-      // PMI - added if(lg<0) and V? checks in macro below to ensure it always returns a positive number   
-      #define ya_s__cb_buf_clamp(cl, v)                \
-         cl = (v)>0?(v):0;                              \
-         if (callback) {                                \
-            int lg = YA_SP_SPRINTF_MIN - (int)(bf - buf); \
-            if(lg<0) lg=0;                              \
-            if (cl > lg)                                \
-               cl = lg;                                 \
-         }
-
-      // fast copy everything up to the next % (or end of string)
-      for (;;) {
-			// simple loop to check for % or 0 and copy to output buffer if neither
-            if (*f == '%')
-               goto scandd;
-            if (*f == 0)
-               goto endfmt;
-            ya_s__chk_cb_buf(1);
-            *bf++ = *f++;         
-      }
-   scandd:
-
-      ++f;
-
-      // ok, we have a percent, read the modifiers first
-      fw = 0;
-      pr = -1;
-      fl = 0;
-      tz = 0;
+   int32_t fw = 0, pr = -1;
+   uint32_t fl = 0;
 
       // flags
       for (;;) {
@@ -596,11 +1095,7 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
           fl &= ~YA_S__LEADINGZERO; // cannot have 0 and -
       // get the field width
       if (f[0] == '*') {
-         fw = va_arg(va, uint32_t);
-         if(fw<0)
-         	{fl |= YA_S__LEFTJUST; // -neg field width is taken as negative flag followed by a positive field width [C99 standard]
-         	 fw= -fw;
-         	}
+         fw = -1; // read from argument list by caller
          ++f;
       } else {
          while ((f[0] >= '0') && (f[0] <= '9')) {
@@ -612,8 +1107,7 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
       if (f[0] == '.') {
          ++f;
          if (f[0] == '*') {
-            pr = va_arg(va, uint32_t);
-            if(pr<0) pr= -1;// C99 standard: if a negative precision given behave as if no precision is specified
+            pr = -2; // read from argument list by caller
             ++f;
          } else {
             pr = 0;
@@ -621,10 +1115,10 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
                pr = pr * 10 + f[0] - '0';
                f++;
             }
+           // deal with invalid combinations
+           if(fl & YA_S__LEADINGZERO)
+             fl &= ~YA_S__LEADINGZERO; // cannot have 0 flag when precision specified
          }
-        // deal with invalid combinations
-        if((fl & YA_S__LEADINGZERO) && pr != -1 ) 
-          fl &= ~YA_S__LEADINGZERO; // cannot have 0 flag when precision specified
       }
 
       // handle integer and double size overrides
@@ -692,17 +1186,189 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
 #endif			  	      
       default: break;
       }
+   *pfl = fl;
+   *pfw = fw;
+   *ppr = pr;
+   return f;
+}
+
+// where the output goes, the workhorse below is built once for each of these with the sink logic inlined (so eg sprintf() has no callback checks at all)
+#define YA_S__SINK_BUF 0 // unbounded buffer (sprintf(), vsprintf())
+#define YA_S__SINK_BOUNDED 1 // the user's buffer (snprintf(), vsnprintf()), user is a ya_s__context
+#define YA_S__SINK_SINK 2 // any other sink (including the callbacks of vsprintfcb()), user is sink->user
+
+#if defined(__GNUC__) || defined(__clang__)
+#define YA_S__FORCEINLINE inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define YA_S__FORCEINLINE __forceinline
+#else
+#define YA_S__FORCEINLINE inline
+#endif
+
+typedef struct ya_s__context {
+   char *buf; // where the next chars go in the user's buffer
+   int count; // space left there
+   char *res; // the last space reserved, buf or tmp
+   char tmp[YA_SP_SPRINTF_MIN];
+} ya_s__context;
+
+// reserve() and commit() for the user's buffer: write directly into it while want chars fit, then go through tmp copying as much as fits
+static YA_S__FORCEINLINE char *ya_s__bounded_reserve(ya_s__context *c, int want, int *avail)
+{
+   if (c->count >= want) {
+      *avail = c->count;
+      return c->res = c->buf;
+   }
+   *avail = YA_SP_SPRINTF_MIN;
+   return c->res = c->tmp;
+}
+
+static YA_S__FORCEINLINE void ya_s__bounded_commit(ya_s__context *c, int len)
+{
+   if (len > c->count)
+      len = c->count;
+   if (len > 0) {
+      if (c->res != c->buf)
+         memcpy(c->buf, c->res, (size_t)len);
+      c->buf += len;
+      c->count -= len;
+   }
+}
+
+// the workhorse for everything, if ops (a compiled program) is not NULL it is used instead of fmt. sink is always a constant (see ya_s__vsprintf_buf() etc below).
+// buf is only used for YA_S__SINK_BUF, snk only for YA_S__SINK_SINK
+static YA_S__FORCEINLINE int ya_s__vsprintfcb_prog(int sink, ya_s_sink const *snk, void *user, char *buf, char const *fmt, ya_s_format_op const *ops, va_list va)
+{
+   static char hex[] = "0123456789abcdefxp";
+   static char hexu[] = "0123456789ABCDEFXP";
+   char *bf;
+   char const *f;
+   ya_s_format_op const *op = ops;
+   int tlen = 0;
+   int cap = YA_SP_SPRINTF_MIN; // space reserved at buf
+   ya_s_locale const *loc = ya_s__cur_locale();
+   char const comma = loc->comma;
+#ifndef YA_SP_SPRINTF_NOFLOAT
+   char const period = loc->period;
+#endif
+   uint32_t const grp = ya_s__grouping(loc);
+#ifdef YA_S__Q_EXACT
+   // which of these holds the value to be converted depends on fl, initialise them here to stop the compiler warning they may be used uninitialised
+   long double fvL = 0;
+   __float128 fv128 = 0;
+#endif
+   if ((op == NULL) && (fmt == NULL))
+      return 0; // PMi - just in case ! 
+   #define ya_s__reserve(want) ((sink == YA_S__SINK_BOUNDED) ? ya_s__bounded_reserve((ya_s__context *)user, want, &cap) : snk->reserve(user, want, &cap))
+   #define ya_s__commit(len)                                     \
+      {                                                          \
+         if (sink == YA_S__SINK_BOUNDED)                         \
+            ya_s__bounded_commit((ya_s__context *)user, len);    \
+         else                                                    \
+            snk->commit(user, len);                              \
+      }
+   if (sink != YA_S__SINK_BUF)
+      if (0 == (buf = ya_s__reserve(1)))
+         return 0;
+   bf = buf;
+   f = fmt;
+   for (;;) {
+      int32_t fw, pr, tz, iz, izc; // tz trailing zeros, iz zeros (with a comma every grp digits if izc >= 0) copied after the string
+      uint32_t l2; // then l2 chars from s2 (so long runs of zeros are never built in num)
+      char const *s2;
+      uint32_t fl;
+      char fc; // the conversion character
+
+      // macros for the sink buffer stuff, bytes (< YA_SP_SPRINTF_MIN) must fit in the space reserved
+      #define ya_s__chk_cb_bufL(bytes)                        \
+         {                                                     \
+            int len = (int)(bf - buf);                         \
+            if ((bytes) >= cap - len) {                        \
+               tlen += len;                                    \
+               ya_s__commit(len);                              \
+               if (0 == (bf = buf = ya_s__reserve((bytes) + 1))) \
+                  goto done;                                   \
+            }                                                  \
+         }
+      #define ya_s__chk_cb_buf(bytes)    \
+         {                                \
+            if (sink != YA_S__SINK_BUF) { \
+               ya_s__chk_cb_bufL(bytes); \
+            }                             \
+         }
+      // PMI - added if(lg<0) and V? checks in macro below to ensure it always returns a positive number   
+      #define ya_s__cb_buf_clamp(cl, v)                \
+         cl = (v)>0?(v):0;                              \
+         if (sink != YA_S__SINK_BUF) {                  \
+            int lg = cap - (int)(bf - buf);             \
+            if(lg<0) lg=0;                              \
+            if (cl > lg)                                \
+               cl = lg;                                 \
+         }
+
+      {
+         // copy the literal text in front of the next conversion (everything up to the next % or the end of the format string)
+         char const *s;
+         int32_t n;
+         if (op) {
+            s = op->lit;
+            n = op->litlen;
+         } else {
+            s = f;
+            f = ya_s__scan_literal(f);
+            n = (int32_t)(f - s);
+         }
+         while (n > 0) {
+            int32_t i;
+            ya_s__chk_cb_buf(1);
+            ya_s__cb_buf_clamp(i, n);
+            n -= i;
+            memcpy(bf, s, i);
+            bf += i;
+            s += i;
+         }
+      }
+      if (op) {
+         fc = op->conv;
+         if (fc == 0)
+            goto endfmt;
+         fl = op->fl;
+         fw = op->fw;
+         pr = op->pr;
+         ++op;
+      } else {
+      if (*f == 0)
+         goto endfmt;
+      // ok, we have a percent, read the modifiers first
+      f = ya_s__parse_spec(f + 1, &fl, &fw, &pr);
+      fc = *f++;
+      if (fc == 0)
+         goto endfmt; // format string ends in the middle of a conversion specification
+      }
+      tz = 0;
+      iz = 0;
+      l2 = 0;
+      // get the field width and precision from the argument list if required
+      if (fw < 0) {
+         fw = va_arg(va, uint32_t);
+         if(fw<0)
+         	{fl |= YA_S__LEFTJUST; // -neg field width is taken as negative flag followed by a positive field width [C99 standard]
+         	 fw= -fw;
+         	}
+      }
+      if (pr == -2) {
+         pr = va_arg(va, uint32_t);
+         if(pr<0) pr= -1;// C99 standard: if a negative precision given behave as if no precision is specified
+         else if(fl & YA_S__LEADINGZERO) 
+           fl &= ~YA_S__LEADINGZERO; // cannot have 0 flag when precision specified
+      }
      char lead[8];
      char tail[10];
      lead[0]=0;// make sure lead and tail are correctly initialised, 1st element is count of elements actually used.
      tail[0]=0;
       // handle each replacement
-      switch (f[0]) {
-#ifdef YA_SP_SPRINTF_LD   
-		 #define YA_S__NUMSZ 20000 // clipped to 350 digits after decimal point and could have 4932 before plus commas... 
-#else      	
-         #define YA_S__NUMSZ 1024 // clipped to 350 digits after decimal point and could have 308 before plus commas...
-#endif         
+      switch (fc) {
+         #define YA_S__NUMSZ 256 // at most 36 significant digits (plus commas) are put here, zeros before or after them (eg %Lf of 1e4932) are copied by scopy using iz
          char num[YA_S__NUMSZ];
 
          char *s;
@@ -711,11 +1377,13 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
          uint64_t n64;
 #ifndef YA_SP_SPRINTF_NOFLOAT
          double fv;
-#ifdef YA_SP_SPRINTF_LD       
+#if defined(YA_SP_SPRINTF_LD) && !defined(YA_S__Q_EXACT)
 	  	 long double fvL; // long double
 #endif	
 #ifdef YA_SP_SPRINTF_Q       
+#ifndef YA_S__Q_EXACT
 	      __float128 fv128;  // Quad double (__float128)
+#endif
 	      ya_s__uint128_t u128; // 128 bit integer
 #endif	         
 #endif
@@ -735,11 +1403,12 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
 #else         
             s = "(null)"; // PMi was "null" changed to match built in sprintf()
 #endif            
-         // get the length
-		l=strlen(s); // assume this is faster than code below, its certainly clearer.         
-         // clamp to precision
-         if (l > (uint32_t)pr)
-            l = pr;
+         // get the length, with a precision only look at the first pr chars (the array need not be 0 terminated and may be much longer than pr)
+         if (pr >= 0) {
+            char const *e = (char const *)memchr(s, 0, (uint32_t)pr);
+            l = e ? (uint32_t)(e - s) : (uint32_t)pr;
+         } else
+            l = strlen(s);
          lead[0] = 0;
          tail[0] = 0;
          pr = 0;
@@ -797,6 +1466,8 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
       case 'e':              // float
       case 'f':              // float
       case 'F':				 // float
+      case 'r':              // float
+      case 'R':              // float
          va_arg(va, double); // eat it
          s = (char *)"No float";
          l = 8;
@@ -809,7 +1480,7 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
 #else
       case 'A': // A hex float
       case 'a': // a hex float
-         h = (f[0] == 'A') ? hexu : hex;
+         h = (fc == 'A') ? hexu : hex;
 #ifdef YA_SP_SPRINTF_LD       
 	     if(fl & YA_S__L) // long double 
 	     	{
@@ -817,7 +1488,7 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
          	 if (isnan(fvL) || isinf(fvL)) 
 		   		{
 				 fl &= ~YA_S__LEADINGZERO;// special (nan,inf) don't have leading zeros
-				 if(isupper(f[0]))
+				 if(isupper(fc))
 					{	
 #ifdef YA_SP_SIGNED_NANS
                      if(isnan(fvL))
@@ -845,7 +1516,7 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
 				 	 else if(signbit(fvL))	sn="-inf";
 				 	 else 				sn="inf";
 					}							
-            	 s = (char *)sn;
+            	 s = (char *)ya_s__special(loc, sn, num);
             	 l=strlen(s);
             	 cs = 0;
             	 pr = 0;
@@ -862,7 +1533,7 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
          	 if (isnanq(fv128) || isinfq(fv128)) 
 		   		{
 				 fl &= ~YA_S__LEADINGZERO;// special (nan,inf) don't have leading zeros
-				 if(isupper(f[0]))
+				 if(isupper(fc))
 					{	
 #ifdef YA_SP_SIGNED_NANS
                      if(isnanq(fv128))
@@ -890,7 +1561,7 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
 				 	 else if(signbitq(fv128))	sn="-inf";
 				 	 else 				sn="inf";
 					}							
-            	 s = (char *)sn;
+            	 s = (char *)ya_s__special(loc, sn, num);
             	 l=strlen(s);
             	 cs = 0;
             	 pr = 0;
@@ -929,13 +1600,13 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
   	
 			// add leading chars
 	         lead[1 + lead[0]] = '0';
-	         lead[2 + lead[0]] = (f[0] == 'A') ?'X':'x';
+	         lead[2 + lead[0]] = (fc == 'A') ?'X':'x';
 	         lead[0] += 2;
 	         *s++ = h[(n128 >> 112) & 15];//  we want 1. for 1st digit as thats what quadmath_snprintf () generates
 	         n128 ^= n128 & ((ya_s__uint128_t)15)<<112 ; // delete digit just printed
 	         n128 <<= 4;
 	         if (origpr>=0 || (origpr<0 && n128 !=0) || (fl & YA_S__LEADING_0X) ) // PMi only print period if non-zero digits after dp, or user requested it (eg %.5A) or %#A (LEADING_0X flag)
-	            *s++ = ya_s__period;
+	            *s++ = period;
 	         sn = s;
 	
 	         // print the bits
@@ -960,7 +1631,7 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
          	 if (isnan(fv) || isinf(fv)) 
 		   		{
 				 fl &= ~YA_S__LEADINGZERO;// special (nan,inf) don't have leading zeros
-				 if(isupper(f[0]))
+				 if(isupper(fc))
 					{
 #ifdef YA_SP_SIGNED_NANS
                      if(isnan(fv))
@@ -988,7 +1659,7 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
 				 	 else if(signbit(fv))	sn="-inf";
 				 	 else 			sn="inf";
 					}							
-            	 s = (char *)sn;
+            	 s = (char *)ya_s__special(loc, sn, num);
             	 l=strlen(s);
             	 cs = 0;
             	 pr = 0;
@@ -1081,12 +1752,12 @@ YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback,
  #endif 	
 // add leading chars
          lead[1 + lead[0]] = '0';
-         lead[2 + lead[0]] = (f[0] == 'A') ?'X':'x';
+         lead[2 + lead[0]] = (fc == 'A') ?'X':'x';
          lead[0] += 2;
          *s++ = h[(n64 >> 60) & 15];
          n64 <<= 4;
          if (origpr>=0 || (origpr<0 && n64 !=0) || (fl & YA_S__LEADING_0X) ) // PMi only print period if non-zero digits after dp, or user requested it (eg %.5A) or %#A (LEADING_0X flag)
-            *s++ = ya_s__period;
+            *s++ = period;
          sn = s;
 
          // print the bits
@@ -1129,12 +1800,45 @@ a_pr_axp:
          dp = (int)(s - sn);
          l = (int)(s - (num + 64));
          s = num + 64;
-         cs = 1 + (3 << 24);
+         cs = 1 + (grp << 24);
          goto scopy;
        
+      case 'R': // shortest round trip float
+      case 'r': // shortest round trip float
+         h = (fc == 'R') ? hexu : hex;
+#ifdef YA_SP_SPRINTF_LD       
+	     if(fl & YA_S__L) // long double - no shortest conversion, so print enough digits to round trip using %g rules
+	     	{
+			 fvL=va_arg(va, long double);
+			 pr=21;
+			 goto dogfromr;
+			}
+#endif	
+#ifdef YA_SP_SPRINTF_Q       
+	  	 if(fl & YA_S__Q) //__float128  
+	  	   	{
+			 fv128=va_arg(va, __float128);
+#ifndef YA_S__Q_EXACT
+			 fvL=(long double)fv128;
+#endif
+			 pr=36;
+			 goto dogfromr;
+			}			 
+#endif     
+         fv = va_arg(va, double);
+         if (ya_s__shortest_to_str(&sn, &l, num, &dp, fv))
+            fl |= YA_S__NEGATIVE;
+         // use %e style if the exponent is < -4 or >= 17 (the same as %.17g), otherwise %f style with just the digits needed
+         if (dp != YA_S__SPECIAL && (dp < -3 || dp > 17)) {
+            pr = l - 1;
+            goto doexpfromg;
+         }
+         pr = (dp < (int32_t)l) ? (int32_t)l - dp : 0;
+         goto dofloatfromg;
+
       case 'G': // float
       case 'g': // float
-         h = (f[0] == 'G') ? hexu : hex;
+         h = (fc == 'G') ? hexu : hex;
 #ifdef YA_SP_SPRINTF_LD       
 	     if(fl & YA_S__L) // long double 
 	     	{
@@ -1147,8 +1851,10 @@ a_pr_axp:
 	  	   if(fl & YA_S__Q) //__float128  
 	  	   	{
 			 fv128=va_arg(va, __float128);
+#ifndef YA_S__Q_EXACT
 			 fv=(double)fv128; // simple way to allow original code to work until something better is added
 			 fvL=(long double)fv128;
+#endif
 			}			 
 	  	 else
 #endif     
@@ -1158,6 +1864,9 @@ a_pr_axp:
              fvL=fv; // process as long double
 #endif             
         	}
+#ifdef YA_SP_SPRINTF_LD
+      dogfromr:
+#endif
          if (pr == -1)
             pr = 6; // default is 6
          else if (pr == 0)
@@ -1165,6 +1874,13 @@ a_pr_axp:
          if(pr>350) pr=350; // limit number of digits after dp to something sensible [so buffer size is limited]            
          // read the double into a string
 #ifdef YA_SP_SPRINTF_LD 
+#ifdef YA_S__Q_EXACT
+		 if (fl & YA_S__Q) {
+			 if (ya_s__real_to_str_q(&sn, &l, num, &dp, fv128, (pr - 1) | 0x80000000))
+				fl |= YA_S__NEGATIVE;
+		 }
+		 else
+#endif
 		 if (ya_s__real_to_str(&sn, &l, num, &dp, fvL, (pr - 1) | 0x80000000))
 #else         
          if (ya_s__real_to_str(&sn, &l, num, &dp, fv, (pr - 1) | 0x80000000))
@@ -1218,7 +1934,7 @@ a_pr_axp:
 
       case 'E': // float
       case 'e': // float
-         h = (f[0] == 'E') ? hexu : hex;
+         h = (fc == 'E') ? hexu : hex;
 #ifdef YA_SP_SPRINTF_LD       
 	     if(fl & YA_S__L) // long double 
 	     	{
@@ -1231,8 +1947,10 @@ a_pr_axp:
 	  	   if(fl & YA_S__Q) //__float128  
 	  	   	{
 			 fv128=va_arg(va, __float128);
+#ifndef YA_S__Q_EXACT
 			 fv=(double)fv128; // simple way to allow original code to work until something better is added
 			 fvL=(long double)fv128;
+#endif
 			}			 
 	  	 else
 #endif    
@@ -1247,6 +1965,13 @@ a_pr_axp:
          if(pr>350) pr=350; // limit number of digits after dp to something sensible [so buffer size is limited]            
          // read the double into a string
 #ifdef YA_SP_SPRINTF_LD      
+#ifdef YA_S__Q_EXACT
+		 if (fl & YA_S__Q) {
+			 if (ya_s__real_to_str_q(&sn, &l, num, &dp, fv128, pr | 0x80000000))
+				fl |= YA_S__NEGATIVE;
+		 }
+		 else
+#endif
 		 if (ya_s__real_to_str(&sn, &l, num, &dp, fvL, pr | 0x80000000))  
 #else  
          if (ya_s__real_to_str(&sn, &l, num, &dp, fv, pr | 0x80000000))
@@ -1257,12 +1982,13 @@ a_pr_axp:
          ya_s__lead_sign(fl, lead);
          if (dp == YA_S__SPECIAL) {
 			fl &= ~YA_S__LEADINGZERO;// special (nan,inf) don't have leading zeros
-			if(isupper(f[0]))
+			if(isupper(fc))
 				{
 				 if(*sn=='n') sn="NAN";
 				 else if(*sn=='i') sn="INF";
 				}
-            s = (char *)sn;
+            s = (char *)ya_s__special(loc, sn, num);
+            l = (uint32_t)strlen(s);
             cs = 0;
             pr = 0;
             goto scopy;
@@ -1272,7 +1998,7 @@ a_pr_axp:
          *s++ = sn[0];
 
          if (pr || (fl & YA_S__LEADING_0X))
-            *s++ = ya_s__period;
+            *s++ = period;
 
          // handle after decimal
          if ((l - 1) > (uint32_t)pr)
@@ -1303,7 +2029,7 @@ a_pr_axp:
             --n;
             dp /= 10;
          }
-         cs = 1 + (3 << 24); // how many tens
+         cs = 1 + (grp << 24); // how many tens
          goto flt_lead;
          
 	  case 'F': // float
@@ -1320,8 +2046,10 @@ a_pr_axp:
 	  	   if(fl & YA_S__Q) //__float128  
 	  	   	{
 			 fv128=va_arg(va, __float128);
+#ifndef YA_S__Q_EXACT
 			 fv=(double)fv128; // simple way to allow original code to work until something better is added
 			 fvL=(long double)fv128;
+#endif
 			}			 
 	  	 else
 #endif      
@@ -1339,6 +2067,16 @@ a_pr_axp:
             divisor = 1000.0;
             if (fl & YA_S__METRIC_1024)
                divisor = 1024.0;
+#ifdef YA_S__Q_EXACT
+            if (fl & YA_S__Q) { // __float128 (or 128 bit integer)
+               while (fl < 0x8000000) {
+                  if ((fv128 < divisor) && (fv128 > -divisor))
+                     break;
+                  fv128 /= divisor;
+                  fl += 0x1000000;
+               }
+            } else
+#endif
             while (fl < 0x8000000) {
                if ((fvL < divisor) && (fvL > -divisor))
                   break;
@@ -1366,6 +2104,13 @@ a_pr_axp:
          if(pr>350) pr=350; // limit number of digits after dp to something sensible [so buffer size is limited]
          // read the double into a string
 #ifdef YA_SP_SPRINTF_LD   
+#ifdef YA_S__Q_EXACT
+		 if (fl & YA_S__Q) {
+			 if (ya_s__real_to_str_q(&sn, &l, num, &dp, fv128, pr))
+				fl |= YA_S__NEGATIVE;
+		 }
+		 else
+#endif
 		 if (ya_s__real_to_str(&sn, &l, num, &dp, fvL, pr))
 #else         
          if (ya_s__real_to_str(&sn, &l, num, &dp, fv, pr))
@@ -1376,12 +2121,13 @@ a_pr_axp:
          ya_s__lead_sign(fl, lead);
          if (dp == YA_S__SPECIAL) {
 			fl &= ~YA_S__LEADINGZERO;// special (nan,inf) don't have leading zeros    
-			if(isupper(f[0]))
+			if(isupper(fc))
 				{
 				 if(*sn=='n') sn="NAN";
 				 else if(*sn=='i') sn="INF";
 				}			     	
-            s = (char *)sn;         	        	
+            s = (char *)ya_s__special(loc, sn, num);
+            l = (uint32_t)strlen(s);
             cs = 0;
             pr = 0;
             goto scopy;
@@ -1390,35 +2136,30 @@ a_pr_axp:
 
          // handle the three decimal varieties
          if (dp <= 0) {
-            int32_t i;
             // handle 0.000*000xxxx
             *s++ = '0';
             if (pr || (fl & YA_S__LEADING_0X))
-               *s++ = ya_s__period;
+               *s++ = period;
             n = -dp;
             if ((int32_t)n > pr)
                n = pr;
-            i = n;
-			memset(s,'0',i); // set memory to digit zero
-			s+=i; // increment pointer
-          
+            iz = n; // zeros after the decimal point
+            izc = -1;
             if ((int32_t)(l + n) > pr)
                l = pr - n;
-            i = l;
-			memcpy(s,sn,i);
-			s+=i;
-			sn+=i;         
+            s2 = sn; // then the digits
+            l2 = l;
             tz = pr - (n + l);
-            cs = 1 + (3 << 24); // how many tens did we write (for commas below)
+            cs = 1 + (grp << 24); // how many tens did we write (for commas below)
          } else {
-            cs = (fl & YA_S__TRIPLET_COMMA) ? ((600 - (uint32_t)dp) % 3) : 0;
+            cs = (fl & YA_S__TRIPLET_COMMA) ? ((grp - (uint32_t)dp % grp) % grp) : 0; // so the commas are every grp digits counting from the decimal point
             if ((uint32_t)dp >= l) {
                // handle xxxx000*000.0
                n = 0;
                for (;;) {
-                  if ((fl & YA_S__TRIPLET_COMMA) && (++cs == 4)) {
+                  if ((fl & YA_S__TRIPLET_COMMA) && (++cs == grp + 1)) {
                      cs = 0;
-                     *s++ = ya_s__comma;
+                     *s++ = comma;
                   } else {
                      *s++ = sn[n];
                      ++n;
@@ -1426,35 +2167,24 @@ a_pr_axp:
                         break;
                   }
                }
-               if (n < (uint32_t)dp) {
-                  n = dp - n;
-                  if ((fl & YA_S__TRIPLET_COMMA) == 0) {
-				  	 memset(s,'0',n); // set memory to digit zero
-				  	 s+=n; // increment pointer
-				  	 n=0;                    
-                  }                  
-                  while (n) {
-                     if ((fl & YA_S__TRIPLET_COMMA) && (++cs == 4)) {
-                        cs = 0;
-                        *s++ = ya_s__comma;
-                     } else {
-                        *s++ = '0';
-                        --n;
-                     }
-                  }
-               }
-               cs = (int)(s - (num + 64)) + (3 << 24); // cs is how many tens
+               // the remaining dp-n zeros of the integer part (and their commas) are copied by scopy
+               izc = (fl & YA_S__TRIPLET_COMMA) ? (int32_t)cs : -1;
+               n = (fl & YA_S__TRIPLET_COMMA) ? dp + (dp - 1) / grp : dp; // length of the integer part
+               iz = n - (int32_t)(s - (num + 64));
+               cs = n + (grp << 24); // cs is how many tens
                if (pr || (fl & YA_S__LEADING_0X)) {
-                  *s++ = ya_s__period;
+                  *s = period; // put just after the digits, and copied after the zeros
+                  s2 = s;
+                  l2 = 1;
                   tz = pr;
                }
             } else {
                // handle xxxxx.xxxx000*000
                n = 0;
                for (;;) {
-                  if ((fl & YA_S__TRIPLET_COMMA) && (++cs == 4)) {
+                  if ((fl & YA_S__TRIPLET_COMMA) && (++cs == grp + 1)) {
                      cs = 0;
-                     *s++ = ya_s__comma;
+                     *s++ = comma;
                   } else {
                      *s++ = sn[n];
                      ++n;
@@ -1462,9 +2192,9 @@ a_pr_axp:
                         break;
                   }
                }
-               cs = (int)(s - (num + 64)) + (3 << 24); // cs is how many tens
+               cs = (int)(s - (num + 64)) + (grp << 24); // cs is how many tens
                if (pr || (fl & YA_S__LEADING_0X))
-                  *s++ = ya_s__period;
+                  *s++ = period;
                if ((l - dp) > (uint32_t)pr)
                   l = pr + dp;
                while (n < l) {
@@ -1510,7 +2240,7 @@ a_pr_axp:
 
       case 'B': // upper binary
       case 'b': // lower binary
-         h = (f[0] == 'B') ? hexu : hex;
+         h = (fc == 'B') ? hexu : hex;
          lead[0] = 0;
          if (fl & YA_S__LEADING_0X) {
             lead[0] = 2;
@@ -1542,7 +2272,7 @@ a_pr_axp:
 
       case 'X': // upper hex
       case 'x': // lower hex
-         h = (f[0] == 'X') ? hexu : hex;
+         h = (fc == 'X') ? hexu : hex;
          l = (4 << 4) | (4 << 8);
          lead[0] = 0;
          if (fl & YA_S__LEADING_0X) {
@@ -1580,13 +2310,13 @@ a_pr_axp:
          for (;;) {
             *--s = h[u128 & ((1 << (l >> 8)) - 1)];
             u128 >>= (l >> 8);
-            if (!((u128) || ((int32_t)((num + YA_S__NUMSZ) - s) < pr)))
+            if (!((u128) || (((int32_t)((num + YA_S__NUMSZ) - s) < pr) && (s > num + 1)))) // any leading zeros that don't fit are added by scopy
                break;
             if (fl & YA_S__TRIPLET_COMMA) {
                ++l;
                if ((l & 15) == ((l >> 4) & 15)) {
                   l &= ~15;
-                  *--s = ya_s__comma;
+                  *--s = comma;
                }
             }
          };		    
@@ -1615,13 +2345,13 @@ a_pr_axp:
          for (;;) {
             *--s = h[n64 & ((1 << (l >> 8)) - 1)];
             n64 >>= (l >> 8);
-            if (!((n64) || ((int32_t)((num + YA_S__NUMSZ) - s) < pr)))
+            if (!((n64) || (((int32_t)((num + YA_S__NUMSZ) - s) < pr) && (s > num + 1)))) // any leading zeros that don't fit are added by scopy
                break;
             if (fl & YA_S__TRIPLET_COMMA) {
                ++l;
                if ((l & 15) == ((l >> 4) & 15)) {
                   l &= ~15;
-                  *--s = ya_s__comma;
+                  *--s = comma;
                }
             }
          };
@@ -1630,6 +2360,12 @@ a_pr_axp:
          cs = (uint32_t)((num + YA_S__NUMSZ) - s) + ((((l >> 4) & 15)) << 24);
          // get the length that we copied
          l = (uint32_t)((num + YA_S__NUMSZ) - s);
+         if (((int32_t)l < pr) && (fl & YA_S__TRIPLET_COMMA)) {
+            // the leading zeros did not all fit in num, scopy adds the rest with their commas (and like the loop above never starts with a comma)
+            if ((pr % ((cs >> 24) + 1)) == 0)
+               ++pr;
+            fl |= YA_S__PRECISION_COMMAS;
+         }
          // copy it
          goto scopy;
 
@@ -1644,11 +2380,12 @@ a_pr_axp:
          // get the integer and abs it
 #ifdef YA_SP_SPRINTF_Q  
 		u128=0; // stop gcc complaining about possibly uninitislised u128
+		n64=0; // and n64
 		if (fl & YA_S__Q) 
 			{// 128 bit integer
              ya_s__int128_t i128 = va_arg(va, ya_s__int128_t);
              u128 = (ya_s__uint128_t)i128;
-             if ((f[0] != 'u') && (i128 < 0)) 
+             if ((fc != 'u') && (i128 < 0)) 
 				{
 			     u128=~u128+1; // same as u128=-i128 but avoids issues when processing MIN_INT             	 
                	 fl |= YA_S__NEGATIVE;
@@ -1659,14 +2396,14 @@ a_pr_axp:
           if (fl & YA_S__INTMAX) {
             int64_t i64 = va_arg(va, int64_t);
             n64 = (uint64_t)i64;
-            if ((f[0] != 'u') && (i64 < 0)) {
+            if ((fc != 'u') && (i64 < 0)) {
 			   n64=~n64+1; // same as n64=-i64 but avoids issues when processing MIN_INT              
                fl |= YA_S__NEGATIVE;
             }
          } else {
             int32_t i = va_arg(va, int32_t);
             n64 = (uint32_t)i;
-            if ((f[0] != 'u') && (i < 0)) 
+            if ((fc != 'u') && (i < 0)) 
 				{					
 				 uint32_t n=(uint32_t)(i);
 				 n=~n+1; // same as -n but avoids issues when processing MIN_INT				 
@@ -1677,7 +2414,7 @@ a_pr_axp:
 				n64 &= 0xff;
 			else if(fl & YA_S__HALFWIDTH) // 16 bits
 				n64 &= 0xffff;				            	
-            if(f[0] != 'u')
+            if(fc != 'u')
 				{// for signed 1/2 and 1/4 width need to deal with negative values here 
 				 if(fl & YA_S__QUARTWIDTH) // 8 bits
 					{if(n64>127) 
@@ -1709,7 +2446,11 @@ a_pr_axp:
 #ifdef YA_SP_SPRINTF_LD  
 #ifdef YA_SP_SPRINTF_Q  
 		if (fl & YA_S__Q) // 128 bit integer
+#ifdef YA_S__Q_EXACT
+			fv128= u128; // all 128 bit values are done as __float128's so they get the full resolution
+#else
 			fvL= u128;
+#endif
 		else
 #endif			
             fvL = (long double)(uint64_t)n64; // needs to be unsigned as we have already stripped sign from signed numbers, but could be an unsigned number (%u)
@@ -1725,64 +2466,82 @@ a_pr_axp:
          }
 #endif
 
-         // convert to string
-         s = num + YA_S__NUMSZ;
-         l = 0;
-#ifdef YA_SP_SPRINTF_Q  
-		if (fl & YA_S__Q) 
-		{// print 128 bit unsigned integer [ sign if required is dealt with above ]
-         for (;;) {
-            // do in 32-bit chunks (avoid lots of 128-bit divides even with constant denominators)
-            char *o = s - 8;
-            if (u128 >= 100000000) {
-               n = (uint32_t)(u128 % 100000000);
-               u128 /= 100000000;
-            } else {
-               n = (uint32_t)u128;
-               u128 = 0;
-            }
-            if ((fl & YA_S__TRIPLET_COMMA) == 0) {
-               do {
-#ifdef YA_SP_NO_DIGITPAIR     
-				  // do it the simple way - 8 bits at a time
-                  *--s = (char)(n % 10) + '0';
-                  n /= 10;                             
-#else
-				  // original code using a table lookup 2 digits at a time
-                  s -= 2;
-                  *(uint16_t *)s = *(uint16_t *)&ya_s__digitpair.pair[(n % 100) * 2];
-                  n /= 100;
-#endif                  
-               } while (n);
-            }
-            while (n) {
-               if ((fl & YA_S__TRIPLET_COMMA) && (l++ == 3)) {
-                  l = 0;
-                  *--s = ya_s__comma;
-                  --o;
-               } else {
-                  *--s = (char)(n % 10) + '0';
-                  n /= 10;
+         // common case of no precision, no ' flag and a 64 bit value: write sign, padding and digits directly to the output in one forward pass
+         if (((fl & (YA_S__TRIPLET_COMMA | YA_S__Q)) == 0) && (pr < 0)) {
+            uint32_t nd = ya_s__u64_digits(n64);
+            ya_s__lead_sign(fl, lead);
+            l = nd + lead[0];
+            n = (fw > (int32_t)l) ? (uint32_t)fw - l : 0; // padding
+            if ((sink == YA_S__SINK_BUF) || ((l + n < YA_SP_SPRINTF_MIN) && ((int32_t)(l + n) < cap))) {
+               ya_s__chk_cb_buf(l + n); // make sure it all fits in the current chunk
+               if ((fl & (YA_S__LEFTJUST | YA_S__LEADINGZERO)) == 0) {
+                  memset(bf, ' ', n);
+                  bf += n;
                }
-            }
-            if (u128 == 0) {
-               if ((s < (num + YA_S__NUMSZ)) && *s=='0') // original checked *s first before checking s was valid
-                  ++s;
+               if (lead[0])
+                  *bf++ = lead[1];
+               if ((fl & (YA_S__LEFTJUST | YA_S__LEADINGZERO)) == YA_S__LEADINGZERO) { // 0 is ignored with - (which can come from a negative * width)
+                  memset(bf, '0', n);
+                  bf += n;
+               }
+               ya_s__u64_to_dec_n(bf, n64, nd);
+               bf += nd;
+               if (fl & YA_S__LEFTJUST) {
+                  memset(bf, ' ', n);
+                  bf += n;
+               }
+               ya_s__chk_cb_buf(1);
                break;
             }
-            while (s != o)
-               if ((fl & YA_S__TRIPLET_COMMA) && (l++ == 3)) {
-                  l = 0;
-                  *--s = ya_s__comma;
-                  --o;
-               } else {
-                  *--s = '0';
+         }
+
+         // convert to string
+         s = num + YA_S__NUMSZ;
+         l = 0;
+#ifdef YA_SP_SPRINTF_Q  
+		if (fl & YA_S__Q) 
+		{// print 128 bit unsigned integer [ sign if required is dealt with above ]
+         // split into 16 digit chunks with ya_s__u128_div1e16() (a multiply, not a call to a 128 bit divide), then use the 64 bit code for each chunk
+         char *e = (fl & YA_S__TRIPLET_COMMA) ? s - 64 : s; // with commas put the digits below where the result will go
+         char *p = e;
+         while (u128 >> 64) { // at most twice
+            ya_s__uint128_t q = ya_s__u128_div1e16(u128);
+            p -= 16;
+#ifdef YA_S__SIMD_DEC
+            ya_s__u64_to_dec16(p, (uint64_t)u128 - (uint64_t)q * 10000000000000000ULL);
+#else
+            ya_s__u64_to_dec_n(p, (uint64_t)u128 - (uint64_t)q * 10000000000000000ULL, 16);
+#endif
+            u128 = q;
+         }
+#ifdef YA_S__SIMD_DEC
+         p = ya_s__u64_to_dec(p, (uint64_t)u128);
+#else
+         n = ya_s__u64_digits((uint64_t)u128);
+         p -= n;
+         ya_s__u64_to_dec_n(p, (uint64_t)u128, n);
+#endif
+         if (fl & YA_S__TRIPLET_COMMA) {
+            while (e != p) { // copy down to s inserting a comma every grp digits
+               if (l++ == grp) {
+                  l = 1;
+                  *--s = comma;
                }
-         }		
+               *--s = *--e;
+            }
+         } else
+            s = p;
 		}
 		else
 #endif		
 		{// print u64
+#ifdef YA_S__SIMD_DEC
+         if ((fl & YA_S__TRIPLET_COMMA) == 0) {
+            s = ya_s__u64_to_dec(s, n64);
+            if (n64 == 0)
+               ++s;
+         } else
+#endif
          for (;;) {
             // do in 32-bit chunks (avoid lots of 64-bit divides even with constant denominators)
             char *o = s - 8;
@@ -1809,9 +2568,9 @@ a_pr_axp:
                } while (n);
             }
             while (n) {
-               if ((fl & YA_S__TRIPLET_COMMA) && (l++ == 3)) {
+               if ((fl & YA_S__TRIPLET_COMMA) && (l++ == grp)) {
                   l = 0;
-                  *--s = ya_s__comma;
+                  *--s = comma;
                   --o;
                } else {
                   *--s = (char)(n % 10) + '0';
@@ -1824,9 +2583,9 @@ a_pr_axp:
                break;
             }
             while (s != o)
-               if ((fl & YA_S__TRIPLET_COMMA) && (l++ == 3)) {
+               if ((fl & YA_S__TRIPLET_COMMA) && (l++ == grp)) {
                   l = 0;
-                  *--s = ya_s__comma;
+                  *--s = comma;
                   --o;
                } else {
                   *--s = '0';
@@ -1842,7 +2601,7 @@ a_pr_axp:
             *--s = '0';
             l = 1;
          }
-         cs = l + (3 << 24);
+         cs = l + (grp << 24);
          if (pr < 0)
             pr = 0;
 
@@ -1850,7 +2609,7 @@ a_pr_axp:
          // get fw=leading/trailing space, pr=leading zeros
          if (pr < (int32_t)l)
             pr = l;
-         n = pr + lead[0] + tail[0] + tz;
+         n = pr + lead[0] + tail[0] + tz + iz + l2;
          if (fw < (int32_t)n)
             fw = n;
          fw -= n;
@@ -1862,7 +2621,7 @@ a_pr_axp:
             {
                pr = (fw > pr) ? fw : pr;
                fw = 0;
-            } else {
+            } else if ((fl & YA_S__PRECISION_COMMAS) == 0) {
                fl &= ~YA_S__TRIPLET_COMMA; // if no leading zeros, then no commas
             }
          }
@@ -1906,13 +2665,28 @@ a_pr_axp:
 				  bf+=i; // increment pointer
 				  i=0;
                }
-               while (i) {// set to digit zero with comma every c digits
-                  if ((fl & YA_S__TRIPLET_COMMA) && (cs++ == c)) {
-                     cs = 0;
-                     *bf++ = ya_s__comma;
-                  } else
+               while (i) {// set to digit zero with comma every c digits, finish the current group then copy whole groups from a pattern
+                  if (cs == c) {
+                     char pat[64];
+                     int32_t k, m = (int32_t)(64 / (c + 1) * (c + 1)); // whole groups of c zeros and a comma
+                     for (k = 0; k < m; ++k)
+                        pat[k] = ((uint32_t)k % (c + 1) == c) ? comma : '0';
+                     *bf++ = comma;
+                     --i;
+                     while (i > m) {
+                        memcpy(bf, pat, m);
+                        bf += m;
+                        i -= m;
+                     }
+                     memcpy(bf, pat, i);
+                     bf += i;
+                     cs = (uint32_t)i % (c + 1); // i < c+1 zeros in the last group (a whole group ends with a comma)
+                     i = 0;
+                  } else {
                      *bf++ = '0';
-                  --i;
+                     ++cs;
+                     --i;
+                  }
                }
                ya_s__chk_cb_buf(1);
             }
@@ -1943,6 +2717,43 @@ a_pr_axp:
 			s+=i;                
          }
 
+         // copy the zeros that were not put into num, then the rest of the string
+         while (iz) {
+            int32_t i;
+            ya_s__chk_cb_buf(1);
+            ya_s__cb_buf_clamp(i, iz);
+            iz -= i;
+            if (izc < 0) {
+               memset(bf, '0', i);
+               bf += i;
+            } else
+               while (i) { // grp zeros then a comma
+                  if (izc == (int32_t)grp) {
+                     izc = 0;
+                     *bf++ = comma;
+                     --i;
+                  } else {
+                     int32_t k = (int32_t)grp - izc;
+                     if (k > i)
+                        k = i;
+                     memset(bf, '0', k);
+                     bf += k;
+                     izc += k;
+                     i -= k;
+                  }
+               }
+         }
+         n = l2;
+         while (n) {
+            int32_t i;
+            ya_s__chk_cb_buf(1);
+            ya_s__cb_buf_clamp(i, n);
+            n -= i;
+            memcpy(bf, s2, i);
+            bf += i;
+            s2 += i;
+         }
+
          // copy trailing zeros
          while (tz) {
             int32_t i;
@@ -1984,7 +2795,7 @@ a_pr_axp:
 
       default: // unknown, just copy code
          s = num + YA_S__NUMSZ - 1;
-         *s = f[0];
+         *s = fc;
          l = 1;
          fw = fl = 0;
          lead[0] = 0;
@@ -1994,1197 +2805,1819 @@ a_pr_axp:
          cs = 0;
          goto scopy;
       }
-      ++f;
    }
 endfmt:
 
-   if (!callback)
+   if (sink == YA_S__SINK_BUF)
       *bf = 0;
-   else
-      ya_s__flush_cb();
+   else {
+      tlen += (int)(bf - buf);
+      ya_s__commit((int)(bf - buf));
+      if ((sink == YA_S__SINK_SINK) && snk->flush)
+         snk->flush(user);
+      bf = buf;
+   }
 
 done:
    return tlen + (int)(bf - buf);
 }
 
-// cleanup
-#undef YA_S__LEFTJUST
-#undef YA_S__LEADINGPLUS
-#undef YA_S__LEADINGSPACE
-#undef YA_S__LEADING_0X
-#undef YA_S__LEADINGZERO
-#undef YA_S__INTMAX
-#undef YA_S__TRIPLET_COMMA
-#undef YA_S__NEGATIVE
-#undef YA_S__METRIC_SUFFIX
-#undef YA_S__NUMSZ
-#undef ya_s__chk_cb_bufL
-#undef ya_s__chk_cb_buf
-#undef ya_s__flush_cb
-#undef ya_s__cb_buf_clamp
+static int ya_s__vsprintf_buf(char *buf, char const *fmt, ya_s_format_op const *ops, va_list va)
+{
+   return ya_s__vsprintfcb_prog(YA_S__SINK_BUF, NULL, NULL, buf, fmt, ops, va);
+}
 
-// ============================================================================
-//   wrapper functions
+static int ya_s__vsprintf_bounded(ya_s__context *c, char const *fmt, ya_s_format_op const *ops, va_list va)
+{
+   return ya_s__vsprintfcb_prog(YA_S__SINK_BOUNDED, NULL, c, NULL, fmt, ops, va);
+}
 
-YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(sprintf)(char *buf, char const *fmt, ...)
+static int ya_s__vsprintf_sink(ya_s_sink const *sink, char const *fmt, ya_s_format_op const *ops, va_list va)
 {
-   int result;
-   va_list va;
-   va_start(va, fmt);
-   result = YA_SP_SPRINTF_DECORATE(vsprintfcb)(0, 0, buf, fmt, va);
-   va_end(va);
-   return result;
+   return ya_s__vsprintfcb_prog(YA_S__SINK_SINK, sink, sink->user, NULL, fmt, ops, va);
 }
 
-typedef struct ya_s__context {
+// a sink for the callbacks of vsprintfcb() and exec()
+typedef struct ya_s__cb_sink {
+   YA_S_SPRINTFCB *callback;
+   void *user;
    char *buf;
-   int count;
-   int length;
-   char tmp[YA_SP_SPRINTF_MIN];
-} ya_s__context;
+   int buflen;
+} ya_s__cb_sink;
 
-static char *ya_s__clamp_callback(const char *buf, void *user, int len)
+static char *ya_s__cb_reserve(void *user, int want, int *avail)
 {
-   ya_s__context *c = (ya_s__context *)user;
-   c->length += len;
+   (void)want;
+   *avail = ((ya_s__cb_sink *)user)->buflen;
+   return ((ya_s__cb_sink *)user)->buf;
+}
 
-   if (len > c->count)
-      len = c->count;
+static void ya_s__cb_commit(void *user, int len)
+{
+   ya_s__cb_sink *c = (ya_s__cb_sink *)user;
+   if (len > 0) // the callback is never called with 0 chars
+      c->buf = c->callback(c->buf, c->user, len);
+}
+
+static int ya_s__vsprintf_cb(YA_S_SPRINTFCB *callback, void *user, char *buf, int buflen, char const *fmt, ya_s_format_op const *ops, va_list va)
+{
+   ya_s__cb_sink c;
+   ya_s_sink sink;
+   if (callback == 0)
+      return ya_s__vsprintf_buf(buf, fmt, ops, va);
+   c.callback = callback;
+   c.user = user;
+   c.buf = buf;
+   c.buflen = buflen;
+   sink.reserve = ya_s__cb_reserve;
+   sink.commit = ya_s__cb_commit;
+   sink.flush = NULL;
+   sink.user = &c;
+   return ya_s__vsprintf_sink(&sink, fmt, ops, va);
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(exec)(YA_S_SPRINTFCB *callback, void *user, char *buf, ya_s_format_program const *prog, va_list va)
+{
+   if (prog == NULL)
+      return 0;
+   return ya_s__vsprintf_cb(callback, user, buf, YA_SP_SPRINTF_MIN, NULL, prog->op, va);
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(execsink)(ya_s_sink const *sink, ya_s_format_program const *prog, va_list va)
+{
+   if (prog == NULL)
+      return 0;
+   return ya_s__vsprintf_sink(sink, NULL, prog->op, va);
+}
 
-   if (len) {
-      if (buf != c->buf) {
-         const char *s, *se;
-         char *d;
-         d = c->buf;
-         s = buf;
-         se = buf + len;
-         do {
-            *d++ = *s++;
-         } while (s < se);
+// parse fmt once into a list of (literal text, conversion) pairs that exec() can then run without re-parsing fmt
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(compile_format)(ya_s_format_program *prog, char const *fmt)
+{
+   char const *f = fmt;
+   ya_s_format_op *op;
+   if (prog == NULL || fmt == NULL)
+      return 0;
+   prog->nops = 0;
+   for (;;) {
+      char const *lit = f;
+      uint32_t fl = 0;
+      int32_t fw = 0, pr = -1;
+      char fc = 0;
+      f = ya_s__scan_literal(f);
+      op = &prog->op[prog->nops];
+      op->lit = lit;
+      op->litlen = (int)(f - lit);
+      if (*f == '%') {
+         f = ya_s__parse_spec(f + 1, &fl, &fw, &pr);
+         fc = *f;
+         if (fc)
+            ++f;
+      }
+      op->fl = fl;
+      op->fw = fw;
+      op->pr = pr;
+      op->conv = fc;
+      if (fc == 0)
+         return 1; // op with conv==0 marks the end of the program, and is not counted in nops
+      if (++prog->nops >= YA_SP_FORMAT_MAXOPS + 1) {
+         prog->nops = 0;
+         return 0; // too many conversions
+      }
+   }
+}
+
+#ifdef YA_SP_FORMAT_CACHE
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "YA_SP_FORMAT_CACHE needs gcc or clang (for __atomic builtins)"
+#endif
+#ifndef YA_SP_FORMAT_CACHE_SLOTS
+#define YA_SP_FORMAT_CACHE_SLOTS 256
+#endif
+#ifndef YA_SP_FORMAT_CACHE_MAXLEN
+#define YA_SP_FORMAT_CACHE_MAXLEN 128
+#endif
+#define YA_S__CACHE_PROBES 4 // number of slots checked for each format string
+// slot states - a slot is only ever written once (empty->busy->ready or uncacheable) so readers never need a lock
+#define YA_S__CACHE_EMPTY 0
+#define YA_S__CACHE_BUSY 1
+#define YA_S__CACHE_READY 2
+#define YA_S__CACHE_UNCACHEABLE 3 // format string has too many conversions for a program
+typedef struct ya_s__cache_slot {
+   int state;
+   char const *key; // address of the format string
+   char text[YA_SP_FORMAT_CACHE_MAXLEN]; // copy of the format string, checked on every hit and used by prog for its literal text
+   ya_s_format_program prog;
+} ya_s__cache_slot;
+static ya_s__cache_slot ya_s__format_cache[YA_SP_FORMAT_CACHE_SLOTS];
+#ifdef YA_SP_FORMAT_CACHE_STATS
+static unsigned long long ya_s__cache_hits, ya_s__cache_misses;
+#define ya_s__cache_count(n) __atomic_fetch_add(&(n), 1, __ATOMIC_RELAXED)
+#else
+#define ya_s__cache_count(n) // a shared counter would be written by every lookup on every core
+#endif
+
+// returns a compiled program for fmt, or NULL if fmt is not (and cannot be) cached
+static ya_s_format_program const *ya_s__format_cache_lookup(char const *fmt)
+{
+   uint32_t h = (uint32_t)(((uintptr_t)fmt * 0x9E3779B97F4A7C15ULL) >> 32);
+   size_t len = 0;
+   int i;
+   for (i = 0; i < YA_S__CACHE_PROBES; ++i) {
+      ya_s__cache_slot *c = &ya_s__format_cache[(h + i) & (YA_SP_FORMAT_CACHE_SLOTS - 1)];
+      int st = __atomic_load_n(&c->state, __ATOMIC_ACQUIRE);
+      if (st == YA_S__CACHE_EMPTY) {
+         if (len == 0)
+            len = strlen(fmt);
+         if (len >= YA_SP_FORMAT_CACHE_MAXLEN)
+            break; // too long to cache
+         if (!__atomic_compare_exchange_n(&c->state, &st, YA_S__CACHE_BUSY, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            continue; // another thread got this slot first
+         c->key = fmt;
+         memcpy(c->text, fmt, len + 1);
+         st = YA_SP_SPRINTF_DECORATE(compile_format)(&c->prog, c->text) ? YA_S__CACHE_READY : YA_S__CACHE_UNCACHEABLE;
+         __atomic_store_n(&c->state, st, __ATOMIC_RELEASE);
+         ya_s__cache_count(ya_s__cache_misses);
+         return (st == YA_S__CACHE_READY) ? &c->prog : NULL;
+      }
+#ifdef YA_SP_FORMAT_CACHE_BY_ADDRESS
+      if (st != YA_S__CACHE_BUSY && c->key == fmt) {
+#else
+      if (st != YA_S__CACHE_BUSY && c->key == fmt && strcmp(c->text, fmt) == 0) { // the address alone is not enough, fmt may be a reused buffer
+#endif
+         if (st != YA_S__CACHE_READY)
+            break;
+         ya_s__cache_count(ya_s__cache_hits);
+         return &c->prog;
       }
-      c->buf += len;
-      c->count -= len;
    }
+   ya_s__cache_count(ya_s__cache_misses);
+   return NULL;
+}
+#undef ya_s__cache_count
 
-   if (c->count <= 0)
-      return c->tmp;
-   return (c->count >= YA_SP_SPRINTF_MIN) ? c->buf : c->tmp; // go direct into buffer if you can
+#ifdef YA_SP_FORMAT_CACHE_STATS
+YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(format_cache_stats)(unsigned long long *hits, unsigned long long *misses)
+{
+   if (hits)
+      *hits = __atomic_load_n(&ya_s__cache_hits, __ATOMIC_RELAXED);
+   if (misses)
+      *misses = __atomic_load_n(&ya_s__cache_misses, __ATOMIC_RELAXED);
 }
+#endif // YA_SP_FORMAT_CACHE_STATS
+#endif
 
-static char * ya_s__count_clamp_callback( const char * buf, void * user, int len )
+// the ops of the cached program for fmt (and fmt is set to NULL), or NULL if there is none
+static ya_s_format_op const *ya_s__cached_program(char const **fmt)
 {
-   ya_s__context * c = (ya_s__context*)user;
-   (void) sizeof(buf);
+#ifdef YA_SP_FORMAT_CACHE
+   if (*fmt) {
+      ya_s_format_program const *prog = ya_s__format_cache_lookup(*fmt);
+      if (prog) {
+         *fmt = NULL;
+         return prog->op;
+      }
+   }
+#else
+   (void)fmt;
+#endif
+   return NULL;
+}
 
-   c->length += len;
-   return c->tmp; // go direct into buffer if you can
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfsink)(ya_s_sink const *sink, char const *fmt, va_list va)
+{
+   ya_s_format_op const *ops = ya_s__cached_program(&fmt);
+   return ya_s__vsprintf_sink(sink, fmt, ops, va);
 }
 
-YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE( vsnprintf )( char * buf, int count, char const * fmt, va_list va )
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb)(YA_S_SPRINTFCB *callback, void *user, char *buf, char const *fmt, va_list va)
 {
+   ya_s_format_op const *ops = ya_s__cached_program(&fmt);
+   return ya_s__vsprintf_cb(callback, user, buf, YA_SP_SPRINTF_MIN, fmt, ops, va);
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb_ex)(YA_S_SPRINTFCB *callback, void *user, char *buf, int buflen, char const *fmt, va_list va)
+{
+   ya_s_format_op const *ops = ya_s__cached_program(&fmt);
+   if (buflen < 2)
+      buflen = 2;
+   return ya_s__vsprintf_cb(callback, user, buf, buflen, fmt, ops, va);
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintfcb_locale)(YA_S_SPRINTFCB *callback, void *user, char *buf, int buflen, ya_s_locale const *loc, char const *fmt, va_list va)
+{
+   ya_s_locale const *old = ya_s__locale;
+   int r;
+   ya_s__locale = loc;
+   r = YA_SP_SPRINTF_DECORATE(vsprintfcb_ex)(callback, user, buf, buflen, fmt, va);
+   ya_s__locale = old;
+   return r;
+}
+
+// the length of one conversion found by running the workhorse on it (with nowhere to put the output), its argument follows op
+static int ya_s__op_length(ya_s_format_op const *op, ...)
+{
+   ya_s_format_op ops[2];
    ya_s__context c;
+   va_list va;
+   int r;
+   ops[0] = *op;
+   memset(&ops[1], 0, sizeof(ops[1])); // conv 0 ends the program
+   ops[1].lit = "";
+   c.buf = NULL;
+   c.count = 0;
+   va_start(va, op);
+   r = ya_s__vsprintf_bounded(&c, NULL, ops, va);
+   va_end(va);
+   return r;
+}
 
-   if ( (count == 0) && !buf )
-   {
-      c.length = 0;
+// the exact length of the output of fmt without writing it, integers, strings and chars (and their padding) are measured directly
+// and only floats (and the rare %'x, %$d and 128 bit integers) are converted, one at a time
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vformat_length)(char const *fmt, va_list va)
+{
+   char const *f = fmt;
+   int tlen = 0;
+   if (fmt == NULL)
+      return 0;
+   for (;;) {
+      char const *s = f;
+      ya_s_format_op op;
+      uint32_t fl, l, lead, bits;
+      int32_t fw, pr;
+      uint64_t n64;
+      char fc;
+      f = ya_s__scan_literal(f);
+      tlen += (int)(f - s);
+      if (*f == 0)
+         break;
+      f = ya_s__parse_spec(f + 1, &fl, &fw, &pr);
+      fc = *f++;
+      if (fc == 0)
+         break;
+      // get the field width and precision from the argument list if required, exactly as the workhorse does
+      if (fw < 0) {
+         fw = va_arg(va, uint32_t);
+         if (fw < 0) {
+            fl |= YA_S__LEFTJUST;
+            fw = -fw;
+         }
+      }
+      if (pr == -2) {
+         pr = va_arg(va, uint32_t);
+         if (pr < 0)
+            pr = -1;
+         else
+            fl &= ~YA_S__LEADINGZERO;
+      }
+      lead = 0;
+      switch (fc) {
+      case 's':
+         s = va_arg(va, char const *);
+         if (s == NULL)
+#ifdef YA_SP_LINUX_STYLE
+            s = (pr != -1 && pr < 6) ? "" : "(null)";
+#else
+            s = "(null)";
+#endif
+         if (pr >= 0) {
+            char const *e = (char const *)memchr(s, 0, (uint32_t)pr);
+            l = e ? (uint32_t)(e - s) : (uint32_t)pr;
+         } else
+            l = (uint32_t)strlen(s);
+         pr = 0;
+         break;
+
+      case 'c':
+         (void)va_arg(va, int);
+         l = 1;
+         pr = 0;
+         break;
+
+      case 'n':
+         if (fl & YA_S__QUARTWIDTH)
+            *va_arg(va, signed char *) = (signed char)tlen;
+         else if (fl & YA_S__HALFWIDTH)
+            *va_arg(va, short *) = (short)tlen;
+         else if (fl & YA_S__INTMAX)
+            *va_arg(va, int64_t *) = tlen;
+#ifdef YA_SP_SPRINTF_Q
+         else if (fl & YA_S__Q)
+            *va_arg(va, ya_s__int128_t *) = tlen;
+#endif
+         else
+            *va_arg(va, int *) = tlen;
+         continue;
+
+      case 'A':
+      case 'a':
+      case 'G':
+      case 'g':
+      case 'E':
+      case 'e':
+      case 'F':
+      case 'f':
+      case 'R':
+      case 'r':
+#ifdef YA_SP_SPRINTF_NOFLOAT
+         (void)va_arg(va, double);
+         l = 8; // "No float"
+         pr = 0;
+         break;
+#else
+         goto convert;
+#endif
+
+      case 'u':
+#ifdef YA_SP_LINUX_STYLE
+         fl &= ~(YA_S__LEADINGPLUS | YA_S__LEADINGSPACE);
+#endif
+      case 'i':
+      case 'd':
+         // commas in the leading zeros, %$d and 128 bit values are converted
+         if ((fl & (YA_S__Q | YA_S__METRIC_SUFFIX)) || ((fl & YA_S__TRIPLET_COMMA) && ((pr >= 0) || (fl & YA_S__LEADINGZERO))))
+            goto convert;
+         if (fl & YA_S__INTMAX) {
+            int64_t i64 = va_arg(va, int64_t);
+            n64 = (uint64_t)i64;
+            if ((fc != 'u') && (i64 < 0)) {
+               n64 = ~n64 + 1;
+               fl |= YA_S__NEGATIVE;
+            }
+         } else {
+            int32_t i = va_arg(va, int32_t);
+            n64 = (uint32_t)i;
+            if ((fc != 'u') && (i < 0)) {
+               n64 = (uint32_t)(~(uint32_t)i + 1);
+               fl |= YA_S__NEGATIVE;
+            }
+            if (fl & YA_S__QUARTWIDTH)
+               n64 &= 0xff;
+            else if (fl & YA_S__HALFWIDTH)
+               n64 &= 0xffff;
+            if (fc != 'u') {
+               if ((fl & YA_S__QUARTWIDTH) && (n64 > 127)) {
+                  n64 = 256 - n64;
+                  fl |= YA_S__NEGATIVE;
+               }
+               if ((fl & YA_S__HALFWIDTH) && (n64 > 32767)) {
+                  n64 = 32768 - n64;
+                  fl |= YA_S__NEGATIVE;
+               }
+            }
+         }
+         l = ya_s__u64_digits(n64);
+         if (fl & YA_S__TRIPLET_COMMA)
+            l += (l - 1) / ya_s__grouping(ya_s__cur_locale());
+         lead = (fl & (YA_S__NEGATIVE | YA_S__LEADINGPLUS | YA_S__LEADINGSPACE)) ? 1 : 0;
+         break;
+
+      case 'B':
+      case 'b':
+         bits = 1;
+         lead = (fl & YA_S__LEADING_0X) ? 2 : 0;
+         goto radixnum;
+
+      case 'o':
+         bits = 3;
+         lead = (fl & YA_S__LEADING_0X) ? 1 : 0;
+         goto radixnum;
+
+      case 'p':
+         fl |= (sizeof(void *) == 8) ? YA_S__INTMAX : 0;
+#ifdef YA_SP_LINUX_STYLE
+         fl |= YA_S__LEADING_0X;
+#else
+         if (fw == 0)
+            pr = sizeof(void *) * 2;
+         fl &= ~YA_S__LEADINGZERO;
+#endif
+         // fall through
+      case 'X':
+      case 'x':
+         bits = 4;
+         lead = (fl & YA_S__LEADING_0X) ? 2 : 0;
+      radixnum:
+         if (fl & (YA_S__Q | YA_S__TRIPLET_COMMA))
+            goto convert;
+         if (fl & YA_S__INTMAX)
+            n64 = va_arg(va, uint64_t);
+         else
+            n64 = va_arg(va, uint32_t);
+         if (fl & YA_S__QUARTWIDTH)
+            n64 &= 0xff;
+         else if (fl & YA_S__HALFWIDTH)
+            n64 &= 0xffff;
+         if (n64 == 0) {
+            lead = 0;
+            l = (pr == 0) ? 0 : 1;
+         } else {
+            l = 0;
+            do {
+               ++l;
+               n64 >>= bits;
+            } while (n64);
+         }
+         break;
 
-      YA_SP_SPRINTF_DECORATE( vsprintfcb )( ya_s__count_clamp_callback, &c, c.tmp, fmt, va );
+      default: // unknown, just copied
+         ++tlen;
+         continue;
+      }
+      // as scopy: pr is the number of digits with their leading zeros, then padded to fw
+      if (pr < (int32_t)l)
+         pr = (int32_t)l;
+      tlen += (fw > (int32_t)(pr + lead)) ? fw : (int32_t)(pr + lead);
+      continue;
+
+   convert:
+      op.lit = "";
+      op.litlen = 0;
+      op.fl = fl;
+      op.fw = fw;
+      op.pr = pr;
+      op.conv = fc;
+      switch (fc) {
+      case 'd':
+      case 'i':
+      case 'u':
+#ifdef YA_SP_SPRINTF_Q
+         if (fl & YA_S__Q)
+            tlen += ya_s__op_length(&op, va_arg(va, ya_s__int128_t));
+         else
+#endif
+         if (fl & YA_S__INTMAX)
+            tlen += ya_s__op_length(&op, va_arg(va, int64_t));
+         else
+            tlen += ya_s__op_length(&op, va_arg(va, int32_t));
+         break;
+      case 'B':
+      case 'b':
+      case 'o':
+      case 'p':
+      case 'X':
+      case 'x':
+#ifdef YA_SP_SPRINTF_Q
+         if (fl & YA_S__Q)
+            tlen += ya_s__op_length(&op, va_arg(va, ya_s__uint128_t));
+         else
+#endif
+         if (fl & YA_S__INTMAX)
+            tlen += ya_s__op_length(&op, va_arg(va, uint64_t));
+         else
+            tlen += ya_s__op_length(&op, va_arg(va, uint32_t));
+         break;
+      default: // floats
+#ifdef YA_SP_SPRINTF_LD
+         if (fl & YA_S__L)
+            tlen += ya_s__op_length(&op, va_arg(va, long double));
+         else
+#endif
+#ifdef YA_SP_SPRINTF_Q
+         if (fl & YA_S__Q)
+            tlen += ya_s__op_length(&op, va_arg(va, __float128));
+         else
+#endif
+            tlen += ya_s__op_length(&op, va_arg(va, double));
+         break;
+      }
    }
-   else
-   {
-      int l;
+   return tlen;
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(format_length)(char const *fmt, ...)
+{
+   int result;
+   va_list va;
+   va_start(va, fmt);
+   result = YA_SP_SPRINTF_DECORATE(vformat_length)(fmt, va);
+   va_end(va);
+   return result;
+}
 
-      c.buf = buf;
-      c.count = count;
-      c.length = 0;
+#ifdef YA_SP_LOG
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "YA_SP_LOG needs gcc or clang (for __atomic builtins)"
+#endif
+// a record is a header (its length in bytes, then the format string pointer) followed by the raw arguments, and starts on an 8 byte boundary.
+//  A length of 0 means the rest of the ring is unused and the next record is at the start.
+#define YA_S__LOG_HDR 16
+#define YA_S__LOG_NULLSTR 0xffffffffu // string length stored for a NULL %s
+
+static ya_s_log_ring *ya_s__log_rings; // every ring, for ya_s_log_drain()
+static YA_S__THREAD ya_s_log_ring *ya_s__log_ring; // this thread's ring
+
+#define ya_s__log_put(T, v)                  \
+   {                                         \
+      T t_ = (v);                            \
+      if ((size_t)(e - o) < sizeof(T))       \
+         return -1;                          \
+      memcpy(o, &t_, sizeof(T));             \
+      o += sizeof(T);                        \
+   }
+
+// copy the arguments of fmt into the record at out (lim bytes), returns the record's length or -1 if it does not fit
+static int ya_s__log_pack(char *out, uint32_t lim, char const *fmt, va_list va)
+{
+   char *o = out + YA_S__LOG_HDR;
+   char *e = out + lim;
+   char const *f = fmt;
+   ya_s_format_op const *op = ya_s__cached_program(&f); // the types are known without parsing fmt when it is in the format cache
+   uint32_t len;
+   if (lim < YA_S__LOG_HDR)
+      return -1;
+   for (;;) {
+      uint32_t fl;
+      int32_t fw, pr;
+      char fc;
+      if (op) {
+         fc = op->conv;
+         if (fc == 0)
+            break;
+         fl = op->fl;
+         fw = op->fw;
+         pr = op->pr;
+         ++op;
+      } else {
+         f = ya_s__scan_literal(f);
+         if (*f == 0)
+            break;
+         f = ya_s__parse_spec(f + 1, &fl, &fw, &pr);
+         fc = *f++;
+         if (fc == 0)
+            break;
+      }
+      if (fw < 0)
+         ya_s__log_put(int32_t, va_arg(va, int32_t));
+      if (pr == -2) {
+         pr = va_arg(va, int32_t);
+         ya_s__log_put(int32_t, pr);
+      }
+      switch (fc) {
+      case 's': {
+         char const *s = va_arg(va, char const *);
+         uint32_t n = YA_S__LOG_NULLSTR;
+         if (s) {
+            if (pr >= 0) {
+               char const *z = (char const *)memchr(s, 0, (uint32_t)pr);
+               n = z ? (uint32_t)(z - s) : (uint32_t)pr;
+            } else
+               n = (uint32_t)strlen(s);
+         }
+         ya_s__log_put(uint32_t, n);
+         if (s) {
+            if ((size_t)(e - o) < n)
+               return -1;
+            memcpy(o, s, n);
+            o += n;
+         }
+      } break;
+      case 'c':
+         ya_s__log_put(int32_t, va_arg(va, int32_t));
+         break;
+      case 'p':
+         ya_s__log_put(void *, va_arg(va, void *));
+         break;
+      case 'n': // nothing is known about the length yet, so %n is ignored
+         (void)va_arg(va, void *);
+         break;
+      case 'B':
+      case 'b':
+      case 'o':
+      case 'X':
+      case 'x':
+      case 'u':
+      case 'i':
+      case 'd':
+#ifdef YA_SP_SPRINTF_Q
+         if (fl & YA_S__Q)
+            ya_s__log_put(ya_s__int128_t, va_arg(va, ya_s__int128_t))
+         else
+#endif
+         if (fl & YA_S__INTMAX)
+            ya_s__log_put(int64_t, va_arg(va, int64_t))
+         else
+            ya_s__log_put(int32_t, va_arg(va, int32_t))
+         break;
+      case 'A':
+      case 'a':
+      case 'G':
+      case 'g':
+      case 'E':
+      case 'e':
+      case 'F':
+      case 'f':
+      case 'R':
+      case 'r':
+#if defined(YA_SP_SPRINTF_LD) && !defined(YA_SP_SPRINTF_NOFLOAT)
+         if (fl & YA_S__L)
+            ya_s__log_put(long double, va_arg(va, long double))
+         else
+#endif
+#if defined(YA_SP_SPRINTF_Q) && !defined(YA_SP_SPRINTF_NOFLOAT)
+         if (fl & YA_S__Q)
+            ya_s__log_put(__float128, va_arg(va, __float128))
+         else
+#endif
+            ya_s__log_put(double, va_arg(va, double))
+         break;
+      default: // unknown, no argument
+         break;
+      }
+   }
+   len = (uint32_t)(o - out);
+   memcpy(out, &len, sizeof(len));
+   memcpy(out + 8, &fmt, sizeof(fmt));
+   return (int)len;
+}
+
+// the conversion op (with its literal text) to the sink, its argument (if any) follows op
+static int ya_s__op_sink(ya_s_sink const *sink, ya_s_format_op const *op, ...)
+{
+   ya_s_format_op ops[2];
+   va_list va;
+   int r;
+   ops[0] = *op;
+   memset(&ops[1], 0, sizeof(ops[1]));
+   ops[1].lit = "";
+   va_start(va, op);
+   r = ya_s__vsprintf_sink(sink, NULL, ops, va);
+   va_end(va);
+   return r;
+}
+
+#define ya_s__log_get(T, v)                  \
+   {                                         \
+      if ((size_t)(e - a) < sizeof(T))       \
+         return -1;                          \
+      memcpy(&(v), a, sizeof(T));            \
+      a += sizeof(T);                        \
+   }
+
+// format the arguments a..e captured for fmt to the sink (whose flush is not called), returns the number of chars or -1 if the arguments are short
+static int ya_s__log_replay(ya_s_sink const *sink, char const *fmt, char const *a, char const *e)
+{
+   char const *f = fmt;
+   int tlen = 0;
+   for (;;) {
+      ya_s_format_op op;
+      uint32_t fl;
+      int32_t fw, pr;
+      char fc;
+      op.lit = f;
+      f = ya_s__scan_literal(f);
+      op.litlen = (int)(f - op.lit);
+      op.conv = 0;
+      if (*f)
+         f = ya_s__parse_spec(f + 1, &fl, &fw, &pr);
+      if ((*f == 0) || ((fc = *f++) == 0)) {
+         if (op.litlen)
+            tlen += ya_s__op_sink(sink, &op);
+         return tlen;
+      }
+      // resolve * width and precision here, exactly as the workhorse does
+      if (fw < 0) {
+         ya_s__log_get(int32_t, fw);
+         if (fw < 0) {
+            fl |= YA_S__LEFTJUST;
+            fw = -fw;
+         }
+      }
+      if (pr == -2) {
+         ya_s__log_get(int32_t, pr);
+         if (pr < 0)
+            pr = -1;
+         else
+            fl &= ~YA_S__LEADINGZERO;
+      }
+      op.fl = fl;
+      op.fw = fw;
+      op.pr = pr;
+      op.conv = fc;
+      switch (fc) {
+      case 's': {
+         uint32_t n;
+         char const *s = NULL;
+         ya_s__log_get(uint32_t, n);
+         if (n != YA_S__LOG_NULLSTR) {
+            if ((size_t)(e - a) < n)
+               return -1;
+            s = a;
+            a += n;
+            op.pr = (int32_t)n; // the copy has no trailing 0
+         }
+         tlen += ya_s__op_sink(sink, &op, s);
+      } break;
+      case 'c': {
+         int32_t c;
+         ya_s__log_get(int32_t, c);
+         tlen += ya_s__op_sink(sink, &op, c);
+      } break;
+      case 'p': {
+         void *p;
+         ya_s__log_get(void *, p);
+         tlen += ya_s__op_sink(sink, &op, p);
+      } break;
+      case 'n':
+         op.conv = 0;
+         tlen += ya_s__op_sink(sink, &op);
+         break;
+      case 'B':
+      case 'b':
+      case 'o':
+      case 'X':
+      case 'x':
+      case 'u':
+      case 'i':
+      case 'd':
+#ifdef YA_SP_SPRINTF_Q
+         if (fl & YA_S__Q) {
+            ya_s__int128_t v;
+            ya_s__log_get(ya_s__int128_t, v);
+            tlen += ya_s__op_sink(sink, &op, v);
+         } else
+#endif
+         if (fl & YA_S__INTMAX) {
+            int64_t v;
+            ya_s__log_get(int64_t, v);
+            tlen += ya_s__op_sink(sink, &op, v);
+         } else {
+            int32_t v;
+            ya_s__log_get(int32_t, v);
+            tlen += ya_s__op_sink(sink, &op, v);
+         }
+         break;
+      case 'A':
+      case 'a':
+      case 'G':
+      case 'g':
+      case 'E':
+      case 'e':
+      case 'F':
+      case 'f':
+      case 'R':
+      case 'r':
+#if defined(YA_SP_SPRINTF_LD) && !defined(YA_SP_SPRINTF_NOFLOAT)
+         if (fl & YA_S__L) {
+            long double v;
+            ya_s__log_get(long double, v);
+            tlen += ya_s__op_sink(sink, &op, v);
+         } else
+#endif
+#if defined(YA_SP_SPRINTF_Q) && !defined(YA_SP_SPRINTF_NOFLOAT)
+         if (fl & YA_S__Q) {
+            __float128 v;
+            ya_s__log_get(__float128, v);
+            tlen += ya_s__op_sink(sink, &op, v);
+         } else
+#endif
+         {
+            double v;
+            ya_s__log_get(double, v);
+            tlen += ya_s__op_sink(sink, &op, v);
+         }
+         break;
+      default: // unknown, just copied
+         tlen += ya_s__op_sink(sink, &op);
+         break;
+      }
+   }
+}
+#undef ya_s__log_put
+#undef ya_s__log_get
+
+YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(log_ring_init)(ya_s_log_ring *r, void *mem, unsigned int size)
+{
+   ya_s_log_ring *old = __atomic_load_n(&ya_s__log_rings, __ATOMIC_RELAXED);
+   memset(r, 0, sizeof(*r));
+   r->mem = (char *)mem;
+   while (size & (size - 1)) // round down to a power of 2
+      size &= size - 1;
+   r->size = size;
+   do
+      r->next = old;
+   while (!__atomic_compare_exchange_n(&ya_s__log_rings, &old, r, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(log_attach)(ya_s_log_ring *r)
+{
+   ya_s__log_ring = r;
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vlog)(char const *fmt, va_list va)
+{
+   ya_s_log_ring *r = ya_s__log_ring;
+   uint32_t head, pos, room, to_end;
+   int len;
+   if ((r == NULL) || (fmt == NULL) || (r->size < YA_S__LOG_HDR))
+      return -1;
+   head = r->head;
+   room = r->size - (head - r->tail_seen);
+   pos = head & (r->size - 1);
+   to_end = r->size - pos;
+   for (;;) {
+      uint32_t lim = (room < to_end) ? room : to_end;
+      va_list ap;
+      va_copy(ap, va);
+      len = ya_s__log_pack(r->mem + pos, lim, fmt, ap);
+      va_end(ap);
+      if (len >= 0)
+         break;
+      if (lim == room) { // out of space, unless the consumer has made some since we last looked
+         uint32_t tail = __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE);
+         if (tail == r->tail_seen) {
+            ++r->dropped;
+            return -1;
+         }
+         r->tail_seen = tail;
+         room = r->size - (head - tail);
+      } else { // skip the end of the ring and start again at the beginning
+         uint32_t zero = 0;
+         memcpy(r->mem + pos, &zero, sizeof(zero));
+         head += to_end;
+         room -= to_end;
+         pos = 0;
+         to_end = r->size;
+      }
+   }
+   __atomic_store_n(&r->head, head + (((uint32_t)len + 7) & ~7u), __ATOMIC_RELEASE);
+   return 0;
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(log)(char const *fmt, ...)
+{
+   int result;
+   va_list va;
+   va_start(va, fmt);
+   result = YA_SP_SPRINTF_DECORATE(vlog)(fmt, va);
+   va_end(va);
+   return result;
+}
+
+// hand every record waiting in every ring to fn, giving its space back as soon as fn returns, returns the number of records
+static int ya_s__log_consume(void (*fn)(void *user, char const *fmt, char const *a, char const *e), void *user)
+{
+   ya_s_log_ring *r;
+   int n = 0;
+   for (r = __atomic_load_n(&ya_s__log_rings, __ATOMIC_ACQUIRE); r; r = r->next) {
+      uint32_t tail = r->tail;
+      uint32_t head = __atomic_load_n(&r->head, __ATOMIC_ACQUIRE);
+      while (tail != head) {
+         char const *rec = r->mem + (tail & (r->size - 1));
+         char const *fmt;
+         uint32_t len;
+         memcpy(&len, rec, sizeof(len));
+         if (len == 0) // the rest of the ring is unused
+            tail += r->size - (tail & (r->size - 1));
+         else {
+            memcpy(&fmt, rec + 8, sizeof(fmt));
+            fn(user, fmt, rec + YA_S__LOG_HDR, rec + len);
+            tail += (len + 7) & ~7u;
+            ++n;
+         }
+         __atomic_store_n(&r->tail, tail, __ATOMIC_RELEASE); // hand the space back straight away
+      }
+   }
+   return n;
+}
+
+static void ya_s__log_drain_one(void *user, char const *fmt, char const *a, char const *e)
+{
+   ya_s__log_replay((ya_s_sink const *)user, fmt, a, e);
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(log_drain)(ya_s_sink const *sink)
+{
+   ya_s_sink s = *sink;
+   int n;
+   s.flush = NULL; // once at the end, not after every conversion
+   n = ya_s__log_consume(ya_s__log_drain_one, &s);
+   if (n && sink->flush)
+      sink->flush(sink->user);
+   return n;
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(log_replay)(ya_s_sink const *sink, char const *fmt, void const *args, int len)
+{
+   ya_s_sink s = *sink;
+   s.flush = NULL;
+   if ((fmt == NULL) || (len < 0))
+      return -1;
+   return ya_s__log_replay(&s, fmt, (char const *)args, (char const *)args + len);
+}
+#endif // YA_SP_LOG
+
+// cleanup
+#undef YA_S__LEFTJUST
+#undef YA_S__LEADINGPLUS
+#undef YA_S__LEADINGSPACE
+#undef YA_S__LEADING_0X
+#undef YA_S__LEADINGZERO
+#undef YA_S__INTMAX
+#undef YA_S__TRIPLET_COMMA
+#undef YA_S__NEGATIVE
+#undef YA_S__METRIC_SUFFIX
+#undef YA_S__NUMSZ
+#undef ya_s__chk_cb_bufL
+#undef ya_s__chk_cb_buf
+#undef ya_s__cb_buf_clamp
+#undef ya_s__reserve
+#undef ya_s__commit
+
+// ============================================================================
+//   wrapper functions
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(sprintf)(char *buf, char const *fmt, ...)
+{
+   int result;
+   va_list va;
+   va_start(va, fmt);
+   result = YA_SP_SPRINTF_DECORATE(vsprintfcb)(0, 0, buf, fmt, va);
+   va_end(va);
+   return result;
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE( vsnprintf )( char * buf, int count, char const * fmt, va_list va )
+{
+   ya_s__context c;
+   ya_s_format_op const *ops = ya_s__cached_program(&fmt);
+   int r;
+
+   c.buf = buf;
+   c.count = count; // (count == 0) && !buf just counts the chars
+   r = ya_s__vsprintf_bounded( &c, fmt, ops, va );
+
+   if ( buf && count > 0 )
+   {
+      // zero-terminate
+      int l = (int)( c.buf - buf );
+      if ( l >= count ) // should never be greater, only equal (or less) than count
+         l = count - 1;
+      buf[l] = 0;
+   }
+
+   return r;
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(snprintf)(char *buf, int count, char const *fmt, ...)
+{
+   int result;
+   va_list va;
+   va_start(va, fmt);
+
+   result = YA_SP_SPRINTF_DECORATE(vsnprintf)(buf, count, fmt, va);
+   va_end(va);
+
+   return result;
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintf)(char *buf, char const *fmt, va_list va)
+{
+   return YA_SP_SPRINTF_DECORATE(vsprintfcb)(0, 0, buf, fmt, va);
+}
+
+/* add definitions for fprintf() etc
+*/
+static YA_S__THREAD char ya_s__io_buf[YA_SP_IO_BUF]; // the buffer for vfprintf(), vdprintf() and vmpsc_printf()
+static YA_S__THREAD volatile int ya_s__io_busy; // set while ya_s__io_buf holds output that has not been written yet
+
+// returns ya_s__io_buf, or local (YA_SP_SPRINTF_MIN chars on the caller's stack) if this is a nested call made while ya_s__io_buf is in use
+//  (eg from a stream's write hook or a signal handler), so the pending output is not overwritten. *size is set to the size of the buffer returned.
+static char *ya_s__io_take(char *local, int *size)
+{
+   if (ya_s__io_busy) {
+      *size = YA_SP_SPRINTF_MIN;
+      return local;
+   }
+   ya_s__io_busy = 1;
+   *size = YA_SP_IO_BUF;
+   return ya_s__io_buf;
+}
+
+static void ya_s__io_give(char *buf)
+{
+   if (buf == ya_s__io_buf)
+      ya_s__io_busy = 0;
+}
+
+typedef struct ya_s__fout {
+   FILE *stream;
+   char *buf;
+   int size;
+} ya_s__fout;
+
+static char *ya_s__f_reserve(void *user, int want, int *avail) // stdio does not give us its buffer so go through ya_s__io_buf
+{
+   ya_s__fout *o = (ya_s__fout *)user;
+   (void)want;
+   *avail = o->size;
+   return o->buf;
+}
+
+static void ya_s__f_commit(void *user, int len) // actually write to required stream
+{
+   ya_s__fout *o = (ya_s__fout *)user;
+   if (len)
+      fwrite(o->buf, sizeof(char), len, o->stream);
+}
+
+// vfprintf() : write to stream (file)
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vfprintf)(FILE *stream, const char *format, va_list va)
+{
+   ya_s_sink sink;
+   ya_s__fout o;
+   char local[YA_SP_SPRINTF_MIN];
+   int r;
+   o.stream = stream;
+   o.buf = ya_s__io_take(local, &o.size);
+   sink.reserve = ya_s__f_reserve;
+   sink.commit = ya_s__f_commit;
+   sink.flush = NULL;
+   sink.user = &o;
+   r = YA_SP_SPRINTF_DECORATE(vsprintfsink)(&sink, format, va);
+   ya_s__io_give(o.buf);
+   return r;
+}
+
+// as above but to stdout
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vprintf)(const char *format, va_list va)
+{ return YA_SP_SPRINTF_DECORATE(vfprintf)(stdout,format,va);
+}
+
+// fprintf() : write to stream (file)
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(fprintf)(FILE *stream, const char *format, ...)
+{
+   int result;
+   va_list va;
+   va_start(va, format);
+   result = YA_SP_SPRINTF_DECORATE(vfprintf)(stream, format, va);
+   va_end(va);
+   return result;	
+}
+
+// printf(): like fprintf() but to stdout
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(printf) (const char *format, ...)
+{
+   int result;
+   va_list va;
+   va_start(va, format);
+   result = YA_SP_SPRINTF_DECORATE(vprintf)(format, va);
+   va_end(va);
+   return result;
+}
+
+// =======================================================================
+//   write()ing directly to file descriptors
+
+// write all n chars at p to fd (write() may write less than asked for, eg to a pipe, or be interrupted by a signal), returns 0 or -1 on an error
+static int ya_s__write_all(int fd, char const *p, int n)
+{
+   while (n > 0) {
+#ifdef _WIN32
+      int w = _write(fd, p, (unsigned)n);
+#else
+      int w = (int)write(fd, p, (size_t)n);
+#endif
+      if (w <= 0) {
+         if (w < 0 && errno == EINTR)
+            continue;
+         return -1;
+      }
+      p += w;
+      n -= w;
+   }
+   return 0;
+}
+
+// write na chars at a then nb chars at b, with a single writev() where there is one
+static int ya_s__write2(int fd, char const *a, int na, char const *b, int nb)
+{
+#ifndef _WIN32
+   struct iovec iov[2];
+   int w;
+   iov[0].iov_base = (void *)a;
+   iov[0].iov_len = (size_t)na;
+   iov[1].iov_base = (void *)b;
+   iov[1].iov_len = (size_t)nb;
+   do
+      w = (int)writev(fd, iov, 2);
+   while (w < 0 && errno == EINTR);
+   if (w < 0)
+      return -1;
+   if (w >= na)
+      return ya_s__write_all(fd, b + (w - na), nb - (w - na));
+   a += w;
+   na -= w;
+#endif
+   if (ya_s__write_all(fd, a, na))
+      return -1;
+   return ya_s__write_all(fd, b, nb);
+}
+
+typedef struct ya_s__dcontext {
+   ya_s_dbuf *b;
+   char *res; // the last space reserved, in b->buf or tmp
+   int tmplen; // chars in tmp (the end of this call's output that did not fit in b->buf)
+   char tmp[YA_SP_SPRINTF_MIN];
+} ya_s__dcontext;
+
+static char *ya_s__d_reserve(void *user, int want, int *avail)
+{
+   ya_s__dcontext *c = (ya_s__dcontext *)user;
+   ya_s_dbuf *b = c->b;
+   if (c->tmplen) { // b->buf and then tmp are full, write them both out and start again at the beginning of b->buf
+      if (ya_s__write2(b->fd, b->buf, b->len, c->tmp, c->tmplen)) {
+         b->err = 1;
+         return 0;
+      }
+      b->len = 0;
+      c->tmplen = 0;
+   }
+   if (b->size - b->len >= want) {
+      *avail = b->size - b->len;
+      return c->res = b->buf + b->len;
+   }
+   *avail = YA_SP_SPRINTF_MIN;
+   return c->res = c->tmp;
+}
+
+static void ya_s__d_commit(void *user, int len)
+{
+   ya_s__dcontext *c = (ya_s__dcontext *)user;
+   if (c->res == c->tmp)
+      c->tmplen += len;
+   else
+      c->b->len += len;
+}
+
+static void ya_s__d_flush(void *user) // end of a call, anything in tmp is written now with what is in b->buf
+{
+   ya_s__dcontext *c = (ya_s__dcontext *)user;
+   ya_s_dbuf *b = c->b;
+   if (c->tmplen) {
+      if (ya_s__write2(b->fd, b->buf, b->len, c->tmp, c->tmplen))
+         b->err = 1;
+      b->len = 0;
+      c->tmplen = 0;
+   }
+}
+
+YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(dbuf_init)(ya_s_dbuf *b, int fd, char *buf, int size)
+{
+   b->fd = fd;
+   b->buf = buf;
+   b->size = size;
+   b->len = 0;
+   b->err = 0;
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vbprintf)(ya_s_dbuf *b, const char *format, va_list va)
+{
+   ya_s__dcontext c;
+   ya_s_sink sink;
+   int r;
+   if (b->err)
+      return -1;
+   c.b = b;
+   c.res = 0;
+   c.tmplen = 0;
+   sink.reserve = ya_s__d_reserve;
+   sink.commit = ya_s__d_commit;
+   sink.flush = ya_s__d_flush;
+   sink.user = &c;
+   r = YA_SP_SPRINTF_DECORATE(vsprintfsink)(&sink, format, va);
+   return b->err ? -1 : r;
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(bprintf)(ya_s_dbuf *b, const char *format, ...)
+{
+   int result;
+   va_list va;
+   va_start(va, format);
+   result = YA_SP_SPRINTF_DECORATE(vbprintf)(b, format, va);
+   va_end(va);
+   return result;
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(dbuf_flush)(ya_s_dbuf *b)
+{
+   int r = b->err ? -1 : 0;
+   if (r == 0 && b->len)
+      r = ya_s__write_all(b->fd, b->buf, b->len);
+   b->len = 0;
+   b->err = 0;
+   return r;
+}
+
+// vdprintf() : write to file descriptor fd
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vdprintf)(int fd, const char *format, va_list va)
+{
+   ya_s_dbuf b;
+   char local[YA_SP_SPRINTF_MIN];
+   char *buf;
+   int r, size;
+   buf = ya_s__io_take(local, &size);
+   YA_SP_SPRINTF_DECORATE(dbuf_init)(&b, fd, buf, size);
+   r = YA_SP_SPRINTF_DECORATE(vbprintf)(&b, format, va);
+   if (YA_SP_SPRINTF_DECORATE(dbuf_flush)(&b))
+      r = -1;
+   ya_s__io_give(buf);
+   return r;
+}
+
+// dprintf() : write to file descriptor fd
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(dprintf)(int fd, const char *format, ...)
+{
+   int result;
+   va_list va;
+   va_start(va, format);
+   result = YA_SP_SPRINTF_DECORATE(vdprintf)(fd, format, va);
+   va_end(va);
+   return result;
+}
+
+#ifdef YA_SP_MPSC
+// =======================================================================
+//   a lock-free ring shared by many formatting threads and written out by one
+
+#if !defined(__GNUC__) && !defined(__clang__)
+#error "YA_SP_MPSC needs gcc or clang (for __atomic builtins)"
+#endif
+// a record is a 4 byte word then the text (and room for a trailing 0), padded to a multiple of 4 bytes. The word is 0 until the record is
+//  ready, then the length of the text, or YA_S__MPSC_SKIP plus the bytes to skip for space that was taken across the end of the ring.
+//  Space is zeroed again as it is written out, so the word of the next record is always 0 until it is ready.
+#define YA_S__MPSC_SKIP 0x80000000u
+#define YA_S__MPSC_IOV 128 // records per writev()
+#ifdef _WIN32
+struct iovec {
+   void *iov_base;
+   size_t iov_len;
+};
+#endif
+
+#define ya_s__mpsc_word(r, pos) ((uint32_t *)((r)->mem + ((pos) & ((r)->size - 1))))
+
+YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(mpsc_init)(ya_s_mpsc *r, int fd, void *mem, unsigned int size)
+{
+   unsigned int skip = (unsigned int)(-(uintptr_t)mem & 3); // the record words are aligned
+   memset(r, 0, sizeof(*r));
+   r->mem = (char *)mem + skip;
+   r->fd = fd;
+   size = (size > skip) ? size - skip : 0;
+   while (size & (size - 1)) // round down to a power of 2
+      size &= size - 1;
+   r->size = size;
+   memset(r->mem, 0, size);
+}
+
+// write all n records in iov, returns 0 or -1
+static int ya_s__mpsc_writev(int fd, struct iovec *iov, int n)
+{
+#ifdef _WIN32
+   int i;
+   for (i = 0; i < n; ++i)
+      if (ya_s__write_all(fd, (char const *)iov[i].iov_base, (int)iov[i].iov_len))
+         return -1;
+#else
+   while (n) {
+      int w = (int)writev(fd, iov, n);
+      if (w <= 0) {
+         if (w < 0 && errno == EINTR)
+            continue;
+         return -1;
+      }
+      while (n && (size_t)w >= iov->iov_len) { // skip what was written
+         w -= (int)iov->iov_len;
+         ++iov;
+         --n;
+      }
+      if (n) {
+         iov->iov_base = (char *)iov->iov_base + w;
+         iov->iov_len -= (size_t)w;
+      }
+   }
+#endif
+   return 0;
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(mpsc_write)(ya_s_mpsc *r)
+{
+   struct iovec iov[YA_S__MPSC_IOV];
+   uint32_t tail, pos;
+   int total = 0;
+   if (__atomic_exchange_n(&r->writing, 1, __ATOMIC_ACQUIRE))
+      return 0; // another thread is writing
+   tail = r->tail;
+   for (;;) {
+      int n = 0, len = 0;
+      pos = tail;
+      while ((n < YA_S__MPSC_IOV) && (pos - tail < r->size)) { // a skip can jump past space in this batch, which is not zeroed yet
+         uint32_t w = __atomic_load_n(ya_s__mpsc_word(r, pos), __ATOMIC_ACQUIRE);
+         if (w == 0) // not ready yet
+            break;
+         if (w & YA_S__MPSC_SKIP) {
+            pos += w & ~YA_S__MPSC_SKIP;
+            continue;
+         }
+         iov[n].iov_base = (char *)ya_s__mpsc_word(r, pos) + 4;
+         iov[n].iov_len = w;
+         ++n;
+         len += (int)w;
+         pos += (w + 8) & ~3u;
+      }
+      if (pos == tail)
+         break;
+      if (n && !r->err && ya_s__mpsc_writev(r->fd, iov, n))
+         r->err = 1;
+      total += len;
+      while (tail != pos) { // zero the space written (in at most 2 pieces), then hand it back
+         uint32_t off = tail & (r->size - 1);
+         uint32_t run = r->size - off;
+         if (run > pos - tail)
+            run = pos - tail;
+         memset(r->mem + off, 0, run);
+         tail += run;
+      }
+      __atomic_store_n(&r->tail, tail, __ATOMIC_RELEASE);
+   }
+   __atomic_store_n(&r->writing, 0, __ATOMIC_RELEASE);
+   return r->err ? -1 : total;
+}
+
+// wait until the space up to end is free, writing the ring out in this thread if no other thread is
+static void ya_s__mpsc_wait(ya_s_mpsc *r, uint32_t end)
+{
+   while (end - __atomic_load_n(&r->tail, __ATOMIC_ACQUIRE) > r->size) {
+      if (YA_SP_SPRINTF_DECORATE(mpsc_write)(r) <= 0) {
+#ifndef _WIN32
+         sched_yield(); // waiting for a record another thread has not finished, or for the thread that is writing
+#endif
+      }
+   }
+}
+
+// take the space for a record of need bytes, returns its position
+static uint32_t ya_s__mpsc_take(ya_s_mpsc *r, uint32_t need)
+{
+   for (;;) {
+      uint32_t pos = __atomic_fetch_add(&r->head, need, __ATOMIC_RELAXED);
+      uint32_t to_end = r->size - (pos & (r->size - 1));
+      ya_s__mpsc_wait(r, pos + ((need < to_end) ? need : to_end));
+      if (need <= to_end)
+         return pos;
+      // the space runs across the end of the ring: skip it all and try again
+      __atomic_store_n(ya_s__mpsc_word(r, pos), YA_S__MPSC_SKIP | need, __ATOMIC_RELEASE);
+   }
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vmpsc_printf)(ya_s_mpsc *r, const char *format, va_list va)
+{
+   uint32_t pos, need;
+   int len, size;
+   char local[YA_SP_SPRINTF_MIN];
+   char *buf;
+   va_list ap;
+   buf = ya_s__io_take(local, &size);
+   va_copy(ap, va);
+   len = YA_SP_SPRINTF_DECORATE(vsnprintf)(buf, size, format, ap);
+   va_end(ap);
+   need = ((uint32_t)len + 8) & ~3u; // the word, the text and a trailing 0
+   if (r->err || len <= 0 || need > r->size / 2) { // a record must fit in half the ring so it can always be placed without skipping most of it
+      ya_s__io_give(buf);
+      return (r->err || len > 0) ? -1 : len;
+   }
+   pos = ya_s__mpsc_take(r, need);
+   if (len < size)
+      memcpy((char *)ya_s__mpsc_word(r, pos) + 4, buf, (size_t)len);
+   else // it did not fit in buf, so format it again straight into the ring
+      YA_SP_SPRINTF_DECORATE(vsnprintf)((char *)ya_s__mpsc_word(r, pos) + 4, len + 1, format, va);
+   ya_s__io_give(buf);
+   __atomic_store_n(ya_s__mpsc_word(r, pos), (uint32_t)len, __ATOMIC_RELEASE);
+   return len;
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(mpsc_printf)(ya_s_mpsc *r, const char *format, ...)
+{
+   int result;
+   va_list va;
+   va_start(va, format);
+   result = YA_SP_SPRINTF_DECORATE(vmpsc_printf)(r, format, va);
+   va_end(va);
+   return result;
+}
+#undef ya_s__mpsc_word
+#endif // YA_SP_MPSC
+
+#ifdef YA_SP_LOG
+// =======================================================================
+//   capturing log records to a binary file, for ya_decode to format later
+
+#define YA_S__LOG_FILE_HDR 16
+#define YA_S__LOG_IDS 4096 // format string ids are 0..YA_S__LOG_IDS-1 (a power of 2)
+#define YA_S__LOG_DEF 0x80000000u // id bit marking a record that defines a format string
+
+// format strings written out by the current ya_s_log_capture() call, open addressing on the pointer. The id of a format string is its slot.
+static char const *ya_s__log_fmts[YA_S__LOG_IDS];
+
+// magic, byte order, and the sizes and options that decide how the arguments were packed
+static void ya_s__log_file_header(unsigned char h[YA_S__LOG_FILE_HDR])
+{
+   uint32_t order = 0x01020304;
+   memcpy(h, "YASLOG02", 8);
+   memcpy(h + 8, &order, 4);
+   h[12] = (unsigned char)sizeof(void *);
+   h[13] = (unsigned char)sizeof(long double);
+   h[14] = 0
+#ifdef YA_SP_SPRINTF_LD
+      | 1
+#endif
+#ifdef YA_SP_SPRINTF_Q
+      | 2
+#endif
+#ifdef YA_SP_SPRINTF_NOFLOAT
+      | 4
+#endif
+      ;
+   h[15] = 0;
+}
+
+// append n bytes at p to b, writing out b's buffer when they do not fit
+static void ya_s__dbuf_put(ya_s_dbuf *b, void const *p, int n)
+{
+   if (b->err)
+      return;
+   if (n > b->size - b->len) {
+      if (ya_s__write_all(b->fd, b->buf, b->len)) {
+         b->err = 1;
+         return;
+      }
+      b->len = 0;
+      if (n > b->size) {
+         if (ya_s__write_all(b->fd, (char const *)p, n))
+            b->err = 1;
+         return;
+      }
+   }
+   memcpy(b->buf + b->len, p, (size_t)n);
+   b->len += n;
+}
 
-      YA_SP_SPRINTF_DECORATE( vsprintfcb )( ya_s__clamp_callback, &c, ya_s__clamp_callback(0,&c,0), fmt, va );
+static void ya_s__log_put_rec(ya_s_dbuf *b, uint32_t id, void const *p, uint32_t n)
+{
+   uint32_t h[2];
+   h[0] = n + 8;
+   h[1] = id;
+   ya_s__dbuf_put(b, h, 8);
+   ya_s__dbuf_put(b, p, (int)n);
+}
 
-      // zero-terminate
-      l = (int)( c.buf - buf );
-      if ( l >= count ) // should never be greater, only equal (or less) than count
-         l = count - 1;
-      buf[l] = 0;
+// the file's id for fmt, writing out its text (with its nul) the 1st time it is seen by this ya_s_log_capture() call.
+// If the 16 slots fmt can go in are all taken, the 1st one is taken over and the id it had now means fmt.
+static uint32_t ya_s__log_id(ya_s_dbuf *b, char const *fmt)
+{
+   uint32_t h = (uint32_t)(((uintptr_t)fmt * 0x9E3779B97F4A7C15ULL) >> 32) & (YA_S__LOG_IDS - 1);
+   uint32_t probe, i = h;
+   for (probe = 0; probe < 16; ++probe, i = (i + 1) & (YA_S__LOG_IDS - 1)) {
+      if (ya_s__log_fmts[i] == fmt)
+         return i;
+      if (ya_s__log_fmts[i] == NULL)
+         break;
    }
-
-   return c.length;
+   if (probe == 16)
+      i = h;
+   ya_s__log_fmts[i] = fmt;
+   ya_s__log_put_rec(b, YA_S__LOG_DEF | i, fmt, (uint32_t)strlen(fmt) + 1);
+   return i;
 }
 
-YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(snprintf)(char *buf, int count, char const *fmt, ...)
+static void ya_s__log_capture_one(void *user, char const *fmt, char const *a, char const *e)
 {
-   int result;
-   va_list va;
-   va_start(va, fmt);
+   ya_s_dbuf *b = (ya_s_dbuf *)user;
+   uint32_t id = ya_s__log_id(b, fmt);
+   ya_s__log_put_rec(b, id, a, (uint32_t)(e - a));
+}
 
-   result = YA_SP_SPRINTF_DECORATE(vsnprintf)(buf, count, fmt, va);
-   va_end(va);
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(log_capture_start)(ya_s_dbuf *b)
+{
+   unsigned char h[YA_S__LOG_FILE_HDR];
+   memset(ya_s__log_fmts, 0, sizeof(ya_s__log_fmts));
+   ya_s__log_file_header(h);
+   ya_s__dbuf_put(b, h, YA_S__LOG_FILE_HDR);
+   return b->err ? -1 : 0;
+}
 
-   return result;
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(log_capture)(ya_s_dbuf *b)
+{
+   int n;
+   memset(ya_s__log_fmts, 0, sizeof(ya_s__log_fmts)); // the text at a format string pointer may change once its records have been drained
+   n = ya_s__log_consume(ya_s__log_capture_one, b);
+   if (YA_SP_SPRINTF_DECORATE(dbuf_flush)(b))
+      return -1;
+   return n;
 }
 
-YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vsprintf)(char *buf, char const *fmt, va_list va)
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(log_capture_check)(void const *p, size_t len)
 {
-   return YA_SP_SPRINTF_DECORATE(vsprintfcb)(0, 0, buf, fmt, va);
+   unsigned char h[YA_S__LOG_FILE_HDR];
+   ya_s__log_file_header(h);
+   if ((len < YA_S__LOG_FILE_HDR) || memcmp(p, h, YA_S__LOG_FILE_HDR))
+      return -1;
+   return YA_S__LOG_FILE_HDR;
 }
+#endif // YA_SP_LOG
 
-/* add definitions for fprintf() etc
-*/
-typedef struct ya_s__fcontext {
-   int length;
-   FILE *fp;
+// =======================================================================
+//   asprintf() into a string grown while it is formatted
+
+typedef struct ya_s__acontext {
+   ya_s_arena const *arena; // NULL for realloc()
+   char *buf; // NULL while the output still fits in tmp
+   size_t size; // of buf
+   size_t len; // chars so far
+   int err; // out of memory
    char tmp[YA_SP_SPRINTF_MIN];
-} ya_s__fcontext;
+} ya_s__acontext;
 
-static char * ya_s__f_callback( const char * buf, void * user, int len ) // actually write to required stream
+static char *ya_s__a_grow(ya_s__acontext *c, size_t newsize)
 {
-   ya_s__fcontext * c = (ya_s__fcontext*)user;
-   c->length += len;
-   if(len)
-   		fwrite(buf,sizeof(char),len,c->fp); // actually write to stream specified
-   return c->tmp; // use the buffer in the struct
+   char *p;
+   size_t old = c->buf ? c->size : 0;
+#ifndef YA_SP_NO_MALLOC
+   if (c->arena == NULL)
+      p = (char *)realloc(c->buf, newsize);
+   else
+#endif
+      p = (char *)c->arena->grow(c->arena->user, c->buf, old, newsize);
+   if (p == NULL)
+      return 0;
+   if (c->buf == NULL)
+      memcpy(p, c->tmp, c->len);
+   c->buf = p;
+   c->size = newsize;
+   return p;
 }
 
-// vfprintf() : write to stream (file)
-YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vfprintf)(FILE *stream, const char *format, va_list va)
+static char *ya_s__a_reserve(void *user, int want, int *avail)
+{
+   ya_s__acontext *c = (ya_s__acontext *)user;
+   size_t n;
+   if (c->buf == NULL) {
+      if (c->len + want < YA_SP_SPRINTF_MIN) { // short strings are only allocated once, at their final size
+         *avail = (int)(YA_SP_SPRINTF_MIN - 1 - c->len);
+         return c->tmp + c->len;
+      }
+      n = 2 * YA_SP_SPRINTF_MIN;
+   } else {
+      if (c->len + want < c->size) {
+         n = c->size - 1 - c->len;
+         *avail = (n > INT_MAX) ? INT_MAX : (int)n;
+         return c->buf + c->len;
+      }
+      n = 2 * c->size; // grow geometrically so a long string is only copied a few times
+   }
+   if (n < c->len + want + 1)
+      n = c->len + want + 1;
+   if ((ya_s__a_grow(c, n) == NULL) && ((n == c->len + want + 1) || (ya_s__a_grow(c, c->len + want + 1) == NULL))) { // try just what is needed before giving up (an arena may be nearly full)
+      c->err = 1;
+      return 0;
+   }
+   n = c->size - 1 - c->len; // always room for the trailing 0
+   *avail = (n > INT_MAX) ? INT_MAX : (int)n;
+   return c->buf + c->len;
+}
+
+static void ya_s__a_commit(void *user, int len)
 {
-    ya_s__fcontext c;
-    c.fp=stream;
-    c.length = 0;
-    YA_SP_SPRINTF_DECORATE(vsprintfcb)( ya_s__f_callback, &c, ya_s__f_callback(0,&c,0), format, va );
-   return c.length;	
+   ((ya_s__acontext *)user)->len += len;
 }
 
-// as above but to stdout
-YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vprintf)(const char *format, va_list va)
-{ return YA_SP_SPRINTF_DECORATE(vfprintf)(stdout,format,va);
+static int ya_s__vasprintf(ya_s_arena const *arena, char **strp, const char *format, va_list va)
+{
+   ya_s__acontext c;
+   ya_s_sink sink;
+   c.arena = arena;
+   c.buf = NULL;
+   c.size = 0;
+   c.len = 0;
+   c.err = 0;
+   sink.reserve = ya_s__a_reserve;
+   sink.commit = ya_s__a_commit;
+   sink.flush = NULL;
+   sink.user = &c;
+   YA_SP_SPRINTF_DECORATE(vsprintfsink)(&sink, format, va);
+   // allocate a string still in tmp at its exact size, or give back the unused end of buf
+   if ((c.err == 0) && ((c.buf == NULL) || (c.size > c.len + 1))) {
+      char *p = c.buf;
+      if ((ya_s__a_grow(&c, c.len + 1) == NULL) && (p == NULL))
+         c.err = 1;
+   }
+   if (c.err) {
+#ifndef YA_SP_NO_MALLOC
+      if (arena == NULL)
+         free(c.buf);
+      else
+#endif
+      if (c.buf)
+         arena->grow(arena->user, c.buf, c.size, 0); // hand back what was used (a bump arena takes it back if it is still the last block)
+      *strp = NULL;
+      return -1;
+   }
+   c.buf[c.len] = 0;
+   *strp = c.buf;
+   return (int)c.len;
 }
 
-// fprintf() : write to stream (file)
-YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(fprintf)(FILE *stream, const char *format, ...)
+#ifndef YA_SP_NO_MALLOC
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vasprintf)(char **strp, const char *format, va_list va)
+{
+   return ya_s__vasprintf(NULL, strp, format, va);
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(asprintf)(char **strp, const char *format, ...)
 {
    int result;
    va_list va;
    va_start(va, format);
-   result = YA_SP_SPRINTF_DECORATE(vfprintf)(stream, format, va);
+   result = ya_s__vasprintf(NULL, strp, format, va);
    va_end(va);
-   return result;	
+   return result;
 }
+#endif
 
-// printf(): like fprintf() but to stdout
-YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(printf) (const char *format, ...)
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(vasprintf_arena)(ya_s_arena const *arena, char **strp, const char *format, va_list va)
+{
+   return ya_s__vasprintf(arena, strp, format, va);
+}
+
+YA_S__PUBLICDEF int YA_SP_SPRINTF_DECORATE(asprintf_arena)(ya_s_arena const *arena, char **strp, const char *format, ...)
 {
    int result;
    va_list va;
    va_start(va, format);
-   result = YA_SP_SPRINTF_DECORATE(vprintf)(format, va);
+   result = ya_s__vasprintf(arena, strp, format, va);
    va_end(va);
    return result;
 }
 
+YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(bump_init)(ya_s_bump *b, void *mem, size_t size)
+{
+   b->mem = (char *)mem;
+   b->size = size;
+   b->used = 0;
+}
+
+YA_S__PUBLICDEF void *YA_SP_SPRINTF_DECORATE(bump_grow)(void *user, void *ptr, size_t oldsize, size_t newsize)
+{
+   ya_s_bump *b = (ya_s_bump *)user;
+   char *p = (char *)ptr;
+   if (p && (p + oldsize == b->mem + b->used)) { // the last block is resized where it is
+      if (newsize > b->size - (size_t)(p - b->mem))
+         return NULL;
+      b->used = (size_t)(p - b->mem) + newsize;
+      return p;
+   }
+   if (newsize > b->size - b->used)
+      return NULL;
+   p = b->mem + b->used;
+   b->used += newsize;
+   if (ptr)
+      memcpy(p, ptr, (oldsize < newsize) ? oldsize : newsize);
+   return p;
+}
+
+YA_S__PUBLICDEF void YA_SP_SPRINTF_DECORATE(bump_reset)(ya_s_bump *b)
+{
+   b->used = 0;
+}
+
 // =======================================================================
 //   low level float utility functions
 
 #ifndef YA_SP_SPRINTF_NOFLOAT
 
 #ifdef YA_SP_SPRINTF_LD
-// version using long doubles for constants to give higher accuracy
- static const long double ldblpowersOf10[] =  /* positive powers of 10 array for long double from 0 to +4932 */
+#ifndef YA_S__LD_EXACT
+// 10^p for long doubles is built from two short tables: 10^p = 10^(+/-56k) * 10^j. The tables are rounded to long double, for the usual 64 bit mantissa
+//  the float tables hold the relative rounding error of each entry so the product can be corrected (see ya_s__raise_to_power10() below).
+//  This is under 5KB against about 158KB for a table with every power of 10, so far less of it needs to be in the cache.
+ static const long double ya_s__ldbl_pow10_fine[56] = /* 10^j for j = 0 to 55 */
+  {
+   1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L,
+   1e10L, 1e11L, 1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L,
+   1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L, 1e28L, 1e29L,
+   1e30L, 1e31L, 1e32L, 1e33L, 1e34L, 1e35L, 1e36L, 1e37L, 1e38L, 1e39L,
+   1e40L, 1e41L, 1e42L, 1e43L, 1e44L, 1e45L, 1e46L, 1e47L, 1e48L, 1e49L,
+   1e50L, 1e51L, 1e52L, 1e53L, 1e54L, 1e55L
+  };
+
+ static const float ya_s__ldbl_pow10_fine_rel[56] = /* (10^j - ya_s__ldbl_pow10_fine[j]) / ya_s__ldbl_pow10_fine[j], 0 while 10^j is exact */
+  {
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+   0.0f, 0.0f, 0.0f, 0.0f, 2.68435457e-20f, 2.68435457e-20f, -2.4696062e-20f, 1.65356248e-20f,
+   -5.45460829e-21f, 2.9729763e-20f, -1.2491483e-20f, 2.1285514e-20f, 2.1285514e-20f, 6.87399529e-21f, 6.87399529e-21f, 6.87399529e-21f,
+   2.16313902e-20f, 3.34373061e-20f, -4.34162506e-21f, 2.58815201e-20f, -1.03862543e-20f, -1.03862543e-20f, -1.03862543e-20f, 2.67519467e-20f,
+   -3.26691752e-20f, 1.48677233e-20f, -3.58383012e-20f, -3.58383012e-20f, 2.9065411e-20f, 2.9065411e-20f, -3.32421528e-20f, -1.14528648e-23f
+  };
+
+ static const long double ya_s__ldbl_pow10_pos[89] = /* 10^(56k) for k = 0 to 88 */
+  {
+   1e0L, 1e56L, 1e112L, 1e168L, 1e224L, 1e280L, 1e336L, 1e392L, 1e448L, 1e504L,
+   1e560L, 1e616L, 1e672L, 1e728L, 1e784L, 1e840L, 1e896L, 1e952L, 1e1008L, 1e1064L,
+   1e1120L, 1e1176L, 1e1232L, 1e1288L, 1e1344L, 1e1400L, 1e1456L, 1e1512L, 1e1568L, 1e1624L,
+   1e1680L, 1e1736L, 1e1792L, 1e1848L, 1e1904L, 1e1960L, 1e2016L, 1e2072L, 1e2128L, 1e2184L,
+   1e2240L, 1e2296L, 1e2352L, 1e2408L, 1e2464L, 1e2520L, 1e2576L, 1e2632L, 1e2688L, 1e2744L,
+   1e2800L, 1e2856L, 1e2912L, 1e2968L, 1e3024L, 1e3080L, 1e3136L, 1e3192L, 1e3248L, 1e3304L,
+   1e3360L, 1e3416L, 1e3472L, 1e3528L, 1e3584L, 1e3640L, 1e3696L, 1e3752L, 1e3808L, 1e3864L,
+   1e3920L, 1e3976L, 1e4032L, 1e4088L, 1e4144L, 1e4200L, 1e4256L, 1e4312L, 1e4368L, 1e4424L,
+   1e4480L, 1e4536L, 1e4592L, 1e4648L, 1e4704L, 1e4760L, 1e4816L, 1e4872L, 1e4928L
+  };
+
+ static const float ya_s__ldbl_pow10_pos_rel[89] = /* relative rounding error of ya_s__ldbl_pow10_pos[k] as above */
+  {
+   0.0f, -2.65960135e-20f, 1.58317522e-21f, -4.4361189e-20f, -4.90907621e-20f, -1.42052987e-20f, 1.25269872e-20f, 1.04233522e-20f,
+   -3.19446877e-20f, -2.30797624e-20f, 3.5351024e-20f, 9.83780584e-22f, 2.88199613e-20f, 2.26115459e-20f, 9.3478647e-21f, 1.90900183e-20f,
+   -3.75642556e-20f, -1.04862227e-20f, 7.52655032e-21f, -8.48147702e-21f, -2.79590117e-20f, 1.03553772e-20f, 3.50084549e-20f, 3.20783743e-20f,
+   -1.73604046e-20f, -9.15696531e-21f, -7.03702823e-21f, -1.82949733e-20f, -1.21928391e-21f, -1.38115429e-20f, -2.84285239e-20f, -1.81940524e-20f,
+   1.03048012e-20f, -2.08281089e-20f, 1.95889597e-21f, 2.62587678e-20f, -3.04737054e-20f, 5.28090036e-21f, 5.18479005e-20f, 1.1711606e-20f,
+   1.17795568e-20f, -3.72659471e-20f, -3.72267885e-20f, 2.39924625e-20f, 4.58263132e-20f, 3.20403725e-20f, 2.8443481e-20f, -2.55377652e-20f,
+   -5.13671688e-21f, 1.91108384e-20f, -3.75436568e-20f, -1.85625933e-21f, 3.68350732e-20f, 3.8671873e-20f, 1.9253582e-20f, 5.1807069e-21f,
+   2.47097541e-20f, -2.00450274e-20f, -2.11140477e-21f, 7.04366748e-21f, 4.99774852e-21f, -8.44570469e-21f, -1.32727244e-20f, 1.70180779e-20f,
+   -2.60404002e-20f, 2.75658812e-20f, -7.05752114e-21f, -1.29883447e-20f, -2.18652715e-21f, 2.68600473e-20f, -1.18386913e-20f, 2.2901757e-20f,
+   -5.79577667e-21f, 5.10446855e-20f, 1.37317121e-21f, -2.14973401e-20f, 3.28933803e-21f, 1.79676328e-20f, -3.0832272e-20f, -3.59841823e-20f,
+   -4.2899745e-20f, -2.46564365e-20f, 3.37999375e-20f, -4.32928206e-20f, -3.10606966e-20f, 2.98306694e-20f, -4.00518849e-20f, -3.600808e-20f,
+   2.73624981e-20f
+  };
+
+ static const long double ya_s__ldbl_pow10_neg[89] = /* 10^(-56k) for k = 0 to 88 */
   {
-   1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L, 
-   1e10L, 1e11L, 1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L, 
-   1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L, 1e28L, 1e29L, 
-   1e30L, 1e31L, 1e32L, 1e33L, 1e34L, 1e35L, 1e36L, 1e37L, 1e38L, 1e39L, 
-   1e40L, 1e41L, 1e42L, 1e43L, 1e44L, 1e45L, 1e46L, 1e47L, 1e48L, 1e49L, 
-   1e50L, 1e51L, 1e52L, 1e53L, 1e54L, 1e55L, 1e56L, 1e57L, 1e58L, 1e59L, 
-   1e60L, 1e61L, 1e62L, 1e63L, 1e64L, 1e65L, 1e66L, 1e67L, 1e68L, 1e69L, 
-   1e70L, 1e71L, 1e72L, 1e73L, 1e74L, 1e75L, 1e76L, 1e77L, 1e78L, 1e79L, 
-   1e80L, 1e81L, 1e82L, 1e83L, 1e84L, 1e85L, 1e86L, 1e87L, 1e88L, 1e89L, 
-   1e90L, 1e91L, 1e92L, 1e93L, 1e94L, 1e95L, 1e96L, 1e97L, 1e98L, 1e99L, 
-   1e100L, 1e101L, 1e102L, 1e103L, 1e104L, 1e105L, 1e106L, 1e107L, 1e108L, 1e109L, 
-   1e110L, 1e111L, 1e112L, 1e113L, 1e114L, 1e115L, 1e116L, 1e117L, 1e118L, 1e119L, 
-   1e120L, 1e121L, 1e122L, 1e123L, 1e124L, 1e125L, 1e126L, 1e127L, 1e128L, 1e129L, 
-   1e130L, 1e131L, 1e132L, 1e133L, 1e134L, 1e135L, 1e136L, 1e137L, 1e138L, 1e139L, 
-   1e140L, 1e141L, 1e142L, 1e143L, 1e144L, 1e145L, 1e146L, 1e147L, 1e148L, 1e149L, 
-   1e150L, 1e151L, 1e152L, 1e153L, 1e154L, 1e155L, 1e156L, 1e157L, 1e158L, 1e159L, 
-   1e160L, 1e161L, 1e162L, 1e163L, 1e164L, 1e165L, 1e166L, 1e167L, 1e168L, 1e169L, 
-   1e170L, 1e171L, 1e172L, 1e173L, 1e174L, 1e175L, 1e176L, 1e177L, 1e178L, 1e179L, 
-   1e180L, 1e181L, 1e182L, 1e183L, 1e184L, 1e185L, 1e186L, 1e187L, 1e188L, 1e189L, 
-   1e190L, 1e191L, 1e192L, 1e193L, 1e194L, 1e195L, 1e196L, 1e197L, 1e198L, 1e199L, 
-   1e200L, 1e201L, 1e202L, 1e203L, 1e204L, 1e205L, 1e206L, 1e207L, 1e208L, 1e209L, 
-   1e210L, 1e211L, 1e212L, 1e213L, 1e214L, 1e215L, 1e216L, 1e217L, 1e218L, 1e219L, 
-   1e220L, 1e221L, 1e222L, 1e223L, 1e224L, 1e225L, 1e226L, 1e227L, 1e228L, 1e229L, 
-   1e230L, 1e231L, 1e232L, 1e233L, 1e234L, 1e235L, 1e236L, 1e237L, 1e238L, 1e239L, 
-   1e240L, 1e241L, 1e242L, 1e243L, 1e244L, 1e245L, 1e246L, 1e247L, 1e248L, 1e249L, 
-   1e250L, 1e251L, 1e252L, 1e253L, 1e254L, 1e255L, 1e256L, 1e257L, 1e258L, 1e259L, 
-   1e260L, 1e261L, 1e262L, 1e263L, 1e264L, 1e265L, 1e266L, 1e267L, 1e268L, 1e269L, 
-   1e270L, 1e271L, 1e272L, 1e273L, 1e274L, 1e275L, 1e276L, 1e277L, 1e278L, 1e279L, 
-   1e280L, 1e281L, 1e282L, 1e283L, 1e284L, 1e285L, 1e286L, 1e287L, 1e288L, 1e289L, 
-   1e290L, 1e291L, 1e292L, 1e293L, 1e294L, 1e295L, 1e296L, 1e297L, 1e298L, 1e299L, 
-   1e300L, 1e301L, 1e302L, 1e303L, 1e304L, 1e305L, 1e306L, 1e307L, 1e308L, 1e309L, 
-   1e310L, 1e311L, 1e312L, 1e313L, 1e314L, 1e315L, 1e316L, 1e317L, 1e318L, 1e319L, 
-   1e320L, 1e321L, 1e322L, 1e323L, 1e324L, 1e325L, 1e326L, 1e327L, 1e328L, 1e329L, 
-   1e330L, 1e331L, 1e332L, 1e333L, 1e334L, 1e335L, 1e336L, 1e337L, 1e338L, 1e339L, 
-   1e340L, 1e341L, 1e342L, 1e343L, 1e344L, 1e345L, 1e346L, 1e347L, 1e348L, 1e349L, 
-   1e350L, 1e351L, 1e352L, 1e353L, 1e354L, 1e355L, 1e356L, 1e357L, 1e358L, 1e359L, 
-   1e360L, 1e361L, 1e362L, 1e363L, 1e364L, 1e365L, 1e366L, 1e367L, 1e368L, 1e369L, 
-   1e370L, 1e371L, 1e372L, 1e373L, 1e374L, 1e375L, 1e376L, 1e377L, 1e378L, 1e379L, 
-   1e380L, 1e381L, 1e382L, 1e383L, 1e384L, 1e385L, 1e386L, 1e387L, 1e388L, 1e389L, 
-   1e390L, 1e391L, 1e392L, 1e393L, 1e394L, 1e395L, 1e396L, 1e397L, 1e398L, 1e399L, 
-   1e400L, 1e401L, 1e402L, 1e403L, 1e404L, 1e405L, 1e406L, 1e407L, 1e408L, 1e409L, 
-   1e410L, 1e411L, 1e412L, 1e413L, 1e414L, 1e415L, 1e416L, 1e417L, 1e418L, 1e419L, 
-   1e420L, 1e421L, 1e422L, 1e423L, 1e424L, 1e425L, 1e426L, 1e427L, 1e428L, 1e429L, 
-   1e430L, 1e431L, 1e432L, 1e433L, 1e434L, 1e435L, 1e436L, 1e437L, 1e438L, 1e439L, 
-   1e440L, 1e441L, 1e442L, 1e443L, 1e444L, 1e445L, 1e446L, 1e447L, 1e448L, 1e449L, 
-   1e450L, 1e451L, 1e452L, 1e453L, 1e454L, 1e455L, 1e456L, 1e457L, 1e458L, 1e459L, 
-   1e460L, 1e461L, 1e462L, 1e463L, 1e464L, 1e465L, 1e466L, 1e467L, 1e468L, 1e469L, 
-   1e470L, 1e471L, 1e472L, 1e473L, 1e474L, 1e475L, 1e476L, 1e477L, 1e478L, 1e479L, 
-   1e480L, 1e481L, 1e482L, 1e483L, 1e484L, 1e485L, 1e486L, 1e487L, 1e488L, 1e489L, 
-   1e490L, 1e491L, 1e492L, 1e493L, 1e494L, 1e495L, 1e496L, 1e497L, 1e498L, 1e499L, 
-   1e500L, 1e501L, 1e502L, 1e503L, 1e504L, 1e505L, 1e506L, 1e507L, 1e508L, 1e509L, 
-   1e510L, 1e511L, 1e512L, 1e513L, 1e514L, 1e515L, 1e516L, 1e517L, 1e518L, 1e519L, 
-   1e520L, 1e521L, 1e522L, 1e523L, 1e524L, 1e525L, 1e526L, 1e527L, 1e528L, 1e529L, 
-   1e530L, 1e531L, 1e532L, 1e533L, 1e534L, 1e535L, 1e536L, 1e537L, 1e538L, 1e539L, 
-   1e540L, 1e541L, 1e542L, 1e543L, 1e544L, 1e545L, 1e546L, 1e547L, 1e548L, 1e549L, 
-   1e550L, 1e551L, 1e552L, 1e553L, 1e554L, 1e555L, 1e556L, 1e557L, 1e558L, 1e559L, 
-   1e560L, 1e561L, 1e562L, 1e563L, 1e564L, 1e565L, 1e566L, 1e567L, 1e568L, 1e569L, 
-   1e570L, 1e571L, 1e572L, 1e573L, 1e574L, 1e575L, 1e576L, 1e577L, 1e578L, 1e579L, 
-   1e580L, 1e581L, 1e582L, 1e583L, 1e584L, 1e585L, 1e586L, 1e587L, 1e588L, 1e589L, 
-   1e590L, 1e591L, 1e592L, 1e593L, 1e594L, 1e595L, 1e596L, 1e597L, 1e598L, 1e599L, 
-   1e600L, 1e601L, 1e602L, 1e603L, 1e604L, 1e605L, 1e606L, 1e607L, 1e608L, 1e609L, 
-   1e610L, 1e611L, 1e612L, 1e613L, 1e614L, 1e615L, 1e616L, 1e617L, 1e618L, 1e619L, 
-   1e620L, 1e621L, 1e622L, 1e623L, 1e624L, 1e625L, 1e626L, 1e627L, 1e628L, 1e629L, 
-   1e630L, 1e631L, 1e632L, 1e633L, 1e634L, 1e635L, 1e636L, 1e637L, 1e638L, 1e639L, 
-   1e640L, 1e641L, 1e642L, 1e643L, 1e644L, 1e645L, 1e646L, 1e647L, 1e648L, 1e649L, 
-   1e650L, 1e651L, 1e652L, 1e653L, 1e654L, 1e655L, 1e656L, 1e657L, 1e658L, 1e659L, 
-   1e660L, 1e661L, 1e662L, 1e663L, 1e664L, 1e665L, 1e666L, 1e667L, 1e668L, 1e669L, 
-   1e670L, 1e671L, 1e672L, 1e673L, 1e674L, 1e675L, 1e676L, 1e677L, 1e678L, 1e679L, 
-   1e680L, 1e681L, 1e682L, 1e683L, 1e684L, 1e685L, 1e686L, 1e687L, 1e688L, 1e689L, 
-   1e690L, 1e691L, 1e692L, 1e693L, 1e694L, 1e695L, 1e696L, 1e697L, 1e698L, 1e699L, 
-   1e700L, 1e701L, 1e702L, 1e703L, 1e704L, 1e705L, 1e706L, 1e707L, 1e708L, 1e709L, 
-   1e710L, 1e711L, 1e712L, 1e713L, 1e714L, 1e715L, 1e716L, 1e717L, 1e718L, 1e719L, 
-   1e720L, 1e721L, 1e722L, 1e723L, 1e724L, 1e725L, 1e726L, 1e727L, 1e728L, 1e729L, 
-   1e730L, 1e731L, 1e732L, 1e733L, 1e734L, 1e735L, 1e736L, 1e737L, 1e738L, 1e739L, 
-   1e740L, 1e741L, 1e742L, 1e743L, 1e744L, 1e745L, 1e746L, 1e747L, 1e748L, 1e749L, 
-   1e750L, 1e751L, 1e752L, 1e753L, 1e754L, 1e755L, 1e756L, 1e757L, 1e758L, 1e759L, 
-   1e760L, 1e761L, 1e762L, 1e763L, 1e764L, 1e765L, 1e766L, 1e767L, 1e768L, 1e769L, 
-   1e770L, 1e771L, 1e772L, 1e773L, 1e774L, 1e775L, 1e776L, 1e777L, 1e778L, 1e779L, 
-   1e780L, 1e781L, 1e782L, 1e783L, 1e784L, 1e785L, 1e786L, 1e787L, 1e788L, 1e789L, 
-   1e790L, 1e791L, 1e792L, 1e793L, 1e794L, 1e795L, 1e796L, 1e797L, 1e798L, 1e799L, 
-   1e800L, 1e801L, 1e802L, 1e803L, 1e804L, 1e805L, 1e806L, 1e807L, 1e808L, 1e809L, 
-   1e810L, 1e811L, 1e812L, 1e813L, 1e814L, 1e815L, 1e816L, 1e817L, 1e818L, 1e819L, 
-   1e820L, 1e821L, 1e822L, 1e823L, 1e824L, 1e825L, 1e826L, 1e827L, 1e828L, 1e829L, 
-   1e830L, 1e831L, 1e832L, 1e833L, 1e834L, 1e835L, 1e836L, 1e837L, 1e838L, 1e839L, 
-   1e840L, 1e841L, 1e842L, 1e843L, 1e844L, 1e845L, 1e846L, 1e847L, 1e848L, 1e849L, 
-   1e850L, 1e851L, 1e852L, 1e853L, 1e854L, 1e855L, 1e856L, 1e857L, 1e858L, 1e859L, 
-   1e860L, 1e861L, 1e862L, 1e863L, 1e864L, 1e865L, 1e866L, 1e867L, 1e868L, 1e869L, 
-   1e870L, 1e871L, 1e872L, 1e873L, 1e874L, 1e875L, 1e876L, 1e877L, 1e878L, 1e879L, 
-   1e880L, 1e881L, 1e882L, 1e883L, 1e884L, 1e885L, 1e886L, 1e887L, 1e888L, 1e889L, 
-   1e890L, 1e891L, 1e892L, 1e893L, 1e894L, 1e895L, 1e896L, 1e897L, 1e898L, 1e899L, 
-   1e900L, 1e901L, 1e902L, 1e903L, 1e904L, 1e905L, 1e906L, 1e907L, 1e908L, 1e909L, 
-   1e910L, 1e911L, 1e912L, 1e913L, 1e914L, 1e915L, 1e916L, 1e917L, 1e918L, 1e919L, 
-   1e920L, 1e921L, 1e922L, 1e923L, 1e924L, 1e925L, 1e926L, 1e927L, 1e928L, 1e929L, 
-   1e930L, 1e931L, 1e932L, 1e933L, 1e934L, 1e935L, 1e936L, 1e937L, 1e938L, 1e939L, 
-   1e940L, 1e941L, 1e942L, 1e943L, 1e944L, 1e945L, 1e946L, 1e947L, 1e948L, 1e949L, 
-   1e950L, 1e951L, 1e952L, 1e953L, 1e954L, 1e955L, 1e956L, 1e957L, 1e958L, 1e959L, 
-   1e960L, 1e961L, 1e962L, 1e963L, 1e964L, 1e965L, 1e966L, 1e967L, 1e968L, 1e969L, 
-   1e970L, 1e971L, 1e972L, 1e973L, 1e974L, 1e975L, 1e976L, 1e977L, 1e978L, 1e979L, 
-   1e980L, 1e981L, 1e982L, 1e983L, 1e984L, 1e985L, 1e986L, 1e987L, 1e988L, 1e989L, 
-   1e990L, 1e991L, 1e992L, 1e993L, 1e994L, 1e995L, 1e996L, 1e997L, 1e998L, 1e999L, 
-   1e1000L, 1e1001L, 1e1002L, 1e1003L, 1e1004L, 1e1005L, 1e1006L, 1e1007L, 1e1008L, 1e1009L, 
-   1e1010L, 1e1011L, 1e1012L, 1e1013L, 1e1014L, 1e1015L, 1e1016L, 1e1017L, 1e1018L, 1e1019L, 
-   1e1020L, 1e1021L, 1e1022L, 1e1023L, 1e1024L, 1e1025L, 1e1026L, 1e1027L, 1e1028L, 1e1029L, 
-   1e1030L, 1e1031L, 1e1032L, 1e1033L, 1e1034L, 1e1035L, 1e1036L, 1e1037L, 1e1038L, 1e1039L, 
-   1e1040L, 1e1041L, 1e1042L, 1e1043L, 1e1044L, 1e1045L, 1e1046L, 1e1047L, 1e1048L, 1e1049L, 
-   1e1050L, 1e1051L, 1e1052L, 1e1053L, 1e1054L, 1e1055L, 1e1056L, 1e1057L, 1e1058L, 1e1059L, 
-   1e1060L, 1e1061L, 1e1062L, 1e1063L, 1e1064L, 1e1065L, 1e1066L, 1e1067L, 1e1068L, 1e1069L, 
-   1e1070L, 1e1071L, 1e1072L, 1e1073L, 1e1074L, 1e1075L, 1e1076L, 1e1077L, 1e1078L, 1e1079L, 
-   1e1080L, 1e1081L, 1e1082L, 1e1083L, 1e1084L, 1e1085L, 1e1086L, 1e1087L, 1e1088L, 1e1089L, 
-   1e1090L, 1e1091L, 1e1092L, 1e1093L, 1e1094L, 1e1095L, 1e1096L, 1e1097L, 1e1098L, 1e1099L, 
-   1e1100L, 1e1101L, 1e1102L, 1e1103L, 1e1104L, 1e1105L, 1e1106L, 1e1107L, 1e1108L, 1e1109L, 
-   1e1110L, 1e1111L, 1e1112L, 1e1113L, 1e1114L, 1e1115L, 1e1116L, 1e1117L, 1e1118L, 1e1119L, 
-   1e1120L, 1e1121L, 1e1122L, 1e1123L, 1e1124L, 1e1125L, 1e1126L, 1e1127L, 1e1128L, 1e1129L, 
-   1e1130L, 1e1131L, 1e1132L, 1e1133L, 1e1134L, 1e1135L, 1e1136L, 1e1137L, 1e1138L, 1e1139L, 
-   1e1140L, 1e1141L, 1e1142L, 1e1143L, 1e1144L, 1e1145L, 1e1146L, 1e1147L, 1e1148L, 1e1149L, 
-   1e1150L, 1e1151L, 1e1152L, 1e1153L, 1e1154L, 1e1155L, 1e1156L, 1e1157L, 1e1158L, 1e1159L, 
-   1e1160L, 1e1161L, 1e1162L, 1e1163L, 1e1164L, 1e1165L, 1e1166L, 1e1167L, 1e1168L, 1e1169L, 
-   1e1170L, 1e1171L, 1e1172L, 1e1173L, 1e1174L, 1e1175L, 1e1176L, 1e1177L, 1e1178L, 1e1179L, 
-   1e1180L, 1e1181L, 1e1182L, 1e1183L, 1e1184L, 1e1185L, 1e1186L, 1e1187L, 1e1188L, 1e1189L, 
-   1e1190L, 1e1191L, 1e1192L, 1e1193L, 1e1194L, 1e1195L, 1e1196L, 1e1197L, 1e1198L, 1e1199L, 
-   1e1200L, 1e1201L, 1e1202L, 1e1203L, 1e1204L, 1e1205L, 1e1206L, 1e1207L, 1e1208L, 1e1209L, 
-   1e1210L, 1e1211L, 1e1212L, 1e1213L, 1e1214L, 1e1215L, 1e1216L, 1e1217L, 1e1218L, 1e1219L, 
-   1e1220L, 1e1221L, 1e1222L, 1e1223L, 1e1224L, 1e1225L, 1e1226L, 1e1227L, 1e1228L, 1e1229L, 
-   1e1230L, 1e1231L, 1e1232L, 1e1233L, 1e1234L, 1e1235L, 1e1236L, 1e1237L, 1e1238L, 1e1239L, 
-   1e1240L, 1e1241L, 1e1242L, 1e1243L, 1e1244L, 1e1245L, 1e1246L, 1e1247L, 1e1248L, 1e1249L, 
-   1e1250L, 1e1251L, 1e1252L, 1e1253L, 1e1254L, 1e1255L, 1e1256L, 1e1257L, 1e1258L, 1e1259L, 
-   1e1260L, 1e1261L, 1e1262L, 1e1263L, 1e1264L, 1e1265L, 1e1266L, 1e1267L, 1e1268L, 1e1269L, 
-   1e1270L, 1e1271L, 1e1272L, 1e1273L, 1e1274L, 1e1275L, 1e1276L, 1e1277L, 1e1278L, 1e1279L, 
-   1e1280L, 1e1281L, 1e1282L, 1e1283L, 1e1284L, 1e1285L, 1e1286L, 1e1287L, 1e1288L, 1e1289L, 
-   1e1290L, 1e1291L, 1e1292L, 1e1293L, 1e1294L, 1e1295L, 1e1296L, 1e1297L, 1e1298L, 1e1299L, 
-   1e1300L, 1e1301L, 1e1302L, 1e1303L, 1e1304L, 1e1305L, 1e1306L, 1e1307L, 1e1308L, 1e1309L, 
-   1e1310L, 1e1311L, 1e1312L, 1e1313L, 1e1314L, 1e1315L, 1e1316L, 1e1317L, 1e1318L, 1e1319L, 
-   1e1320L, 1e1321L, 1e1322L, 1e1323L, 1e1324L, 1e1325L, 1e1326L, 1e1327L, 1e1328L, 1e1329L, 
-   1e1330L, 1e1331L, 1e1332L, 1e1333L, 1e1334L, 1e1335L, 1e1336L, 1e1337L, 1e1338L, 1e1339L, 
-   1e1340L, 1e1341L, 1e1342L, 1e1343L, 1e1344L, 1e1345L, 1e1346L, 1e1347L, 1e1348L, 1e1349L, 
-   1e1350L, 1e1351L, 1e1352L, 1e1353L, 1e1354L, 1e1355L, 1e1356L, 1e1357L, 1e1358L, 1e1359L, 
-   1e1360L, 1e1361L, 1e1362L, 1e1363L, 1e1364L, 1e1365L, 1e1366L, 1e1367L, 1e1368L, 1e1369L, 
-   1e1370L, 1e1371L, 1e1372L, 1e1373L, 1e1374L, 1e1375L, 1e1376L, 1e1377L, 1e1378L, 1e1379L, 
-   1e1380L, 1e1381L, 1e1382L, 1e1383L, 1e1384L, 1e1385L, 1e1386L, 1e1387L, 1e1388L, 1e1389L, 
-   1e1390L, 1e1391L, 1e1392L, 1e1393L, 1e1394L, 1e1395L, 1e1396L, 1e1397L, 1e1398L, 1e1399L, 
-   1e1400L, 1e1401L, 1e1402L, 1e1403L, 1e1404L, 1e1405L, 1e1406L, 1e1407L, 1e1408L, 1e1409L, 
-   1e1410L, 1e1411L, 1e1412L, 1e1413L, 1e1414L, 1e1415L, 1e1416L, 1e1417L, 1e1418L, 1e1419L, 
-   1e1420L, 1e1421L, 1e1422L, 1e1423L, 1e1424L, 1e1425L, 1e1426L, 1e1427L, 1e1428L, 1e1429L, 
-   1e1430L, 1e1431L, 1e1432L, 1e1433L, 1e1434L, 1e1435L, 1e1436L, 1e1437L, 1e1438L, 1e1439L, 
-   1e1440L, 1e1441L, 1e1442L, 1e1443L, 1e1444L, 1e1445L, 1e1446L, 1e1447L, 1e1448L, 1e1449L, 
-   1e1450L, 1e1451L, 1e1452L, 1e1453L, 1e1454L, 1e1455L, 1e1456L, 1e1457L, 1e1458L, 1e1459L, 
-   1e1460L, 1e1461L, 1e1462L, 1e1463L, 1e1464L, 1e1465L, 1e1466L, 1e1467L, 1e1468L, 1e1469L, 
-   1e1470L, 1e1471L, 1e1472L, 1e1473L, 1e1474L, 1e1475L, 1e1476L, 1e1477L, 1e1478L, 1e1479L, 
-   1e1480L, 1e1481L, 1e1482L, 1e1483L, 1e1484L, 1e1485L, 1e1486L, 1e1487L, 1e1488L, 1e1489L, 
-   1e1490L, 1e1491L, 1e1492L, 1e1493L, 1e1494L, 1e1495L, 1e1496L, 1e1497L, 1e1498L, 1e1499L, 
-   1e1500L, 1e1501L, 1e1502L, 1e1503L, 1e1504L, 1e1505L, 1e1506L, 1e1507L, 1e1508L, 1e1509L, 
-   1e1510L, 1e1511L, 1e1512L, 1e1513L, 1e1514L, 1e1515L, 1e1516L, 1e1517L, 1e1518L, 1e1519L, 
-   1e1520L, 1e1521L, 1e1522L, 1e1523L, 1e1524L, 1e1525L, 1e1526L, 1e1527L, 1e1528L, 1e1529L, 
-   1e1530L, 1e1531L, 1e1532L, 1e1533L, 1e1534L, 1e1535L, 1e1536L, 1e1537L, 1e1538L, 1e1539L, 
-   1e1540L, 1e1541L, 1e1542L, 1e1543L, 1e1544L, 1e1545L, 1e1546L, 1e1547L, 1e1548L, 1e1549L, 
-   1e1550L, 1e1551L, 1e1552L, 1e1553L, 1e1554L, 1e1555L, 1e1556L, 1e1557L, 1e1558L, 1e1559L, 
-   1e1560L, 1e1561L, 1e1562L, 1e1563L, 1e1564L, 1e1565L, 1e1566L, 1e1567L, 1e1568L, 1e1569L, 
-   1e1570L, 1e1571L, 1e1572L, 1e1573L, 1e1574L, 1e1575L, 1e1576L, 1e1577L, 1e1578L, 1e1579L, 
-   1e1580L, 1e1581L, 1e1582L, 1e1583L, 1e1584L, 1e1585L, 1e1586L, 1e1587L, 1e1588L, 1e1589L, 
-   1e1590L, 1e1591L, 1e1592L, 1e1593L, 1e1594L, 1e1595L, 1e1596L, 1e1597L, 1e1598L, 1e1599L, 
-   1e1600L, 1e1601L, 1e1602L, 1e1603L, 1e1604L, 1e1605L, 1e1606L, 1e1607L, 1e1608L, 1e1609L, 
-   1e1610L, 1e1611L, 1e1612L, 1e1613L, 1e1614L, 1e1615L, 1e1616L, 1e1617L, 1e1618L, 1e1619L, 
-   1e1620L, 1e1621L, 1e1622L, 1e1623L, 1e1624L, 1e1625L, 1e1626L, 1e1627L, 1e1628L, 1e1629L, 
-   1e1630L, 1e1631L, 1e1632L, 1e1633L, 1e1634L, 1e1635L, 1e1636L, 1e1637L, 1e1638L, 1e1639L, 
-   1e1640L, 1e1641L, 1e1642L, 1e1643L, 1e1644L, 1e1645L, 1e1646L, 1e1647L, 1e1648L, 1e1649L, 
-   1e1650L, 1e1651L, 1e1652L, 1e1653L, 1e1654L, 1e1655L, 1e1656L, 1e1657L, 1e1658L, 1e1659L, 
-   1e1660L, 1e1661L, 1e1662L, 1e1663L, 1e1664L, 1e1665L, 1e1666L, 1e1667L, 1e1668L, 1e1669L, 
-   1e1670L, 1e1671L, 1e1672L, 1e1673L, 1e1674L, 1e1675L, 1e1676L, 1e1677L, 1e1678L, 1e1679L, 
-   1e1680L, 1e1681L, 1e1682L, 1e1683L, 1e1684L, 1e1685L, 1e1686L, 1e1687L, 1e1688L, 1e1689L, 
-   1e1690L, 1e1691L, 1e1692L, 1e1693L, 1e1694L, 1e1695L, 1e1696L, 1e1697L, 1e1698L, 1e1699L, 
-   1e1700L, 1e1701L, 1e1702L, 1e1703L, 1e1704L, 1e1705L, 1e1706L, 1e1707L, 1e1708L, 1e1709L, 
-   1e1710L, 1e1711L, 1e1712L, 1e1713L, 1e1714L, 1e1715L, 1e1716L, 1e1717L, 1e1718L, 1e1719L, 
-   1e1720L, 1e1721L, 1e1722L, 1e1723L, 1e1724L, 1e1725L, 1e1726L, 1e1727L, 1e1728L, 1e1729L, 
-   1e1730L, 1e1731L, 1e1732L, 1e1733L, 1e1734L, 1e1735L, 1e1736L, 1e1737L, 1e1738L, 1e1739L, 
-   1e1740L, 1e1741L, 1e1742L, 1e1743L, 1e1744L, 1e1745L, 1e1746L, 1e1747L, 1e1748L, 1e1749L, 
-   1e1750L, 1e1751L, 1e1752L, 1e1753L, 1e1754L, 1e1755L, 1e1756L, 1e1757L, 1e1758L, 1e1759L, 
-   1e1760L, 1e1761L, 1e1762L, 1e1763L, 1e1764L, 1e1765L, 1e1766L, 1e1767L, 1e1768L, 1e1769L, 
-   1e1770L, 1e1771L, 1e1772L, 1e1773L, 1e1774L, 1e1775L, 1e1776L, 1e1777L, 1e1778L, 1e1779L, 
-   1e1780L, 1e1781L, 1e1782L, 1e1783L, 1e1784L, 1e1785L, 1e1786L, 1e1787L, 1e1788L, 1e1789L, 
-   1e1790L, 1e1791L, 1e1792L, 1e1793L, 1e1794L, 1e1795L, 1e1796L, 1e1797L, 1e1798L, 1e1799L, 
-   1e1800L, 1e1801L, 1e1802L, 1e1803L, 1e1804L, 1e1805L, 1e1806L, 1e1807L, 1e1808L, 1e1809L, 
-   1e1810L, 1e1811L, 1e1812L, 1e1813L, 1e1814L, 1e1815L, 1e1816L, 1e1817L, 1e1818L, 1e1819L, 
-   1e1820L, 1e1821L, 1e1822L, 1e1823L, 1e1824L, 1e1825L, 1e1826L, 1e1827L, 1e1828L, 1e1829L, 
-   1e1830L, 1e1831L, 1e1832L, 1e1833L, 1e1834L, 1e1835L, 1e1836L, 1e1837L, 1e1838L, 1e1839L, 
-   1e1840L, 1e1841L, 1e1842L, 1e1843L, 1e1844L, 1e1845L, 1e1846L, 1e1847L, 1e1848L, 1e1849L, 
-   1e1850L, 1e1851L, 1e1852L, 1e1853L, 1e1854L, 1e1855L, 1e1856L, 1e1857L, 1e1858L, 1e1859L, 
-   1e1860L, 1e1861L, 1e1862L, 1e1863L, 1e1864L, 1e1865L, 1e1866L, 1e1867L, 1e1868L, 1e1869L, 
-   1e1870L, 1e1871L, 1e1872L, 1e1873L, 1e1874L, 1e1875L, 1e1876L, 1e1877L, 1e1878L, 1e1879L, 
-   1e1880L, 1e1881L, 1e1882L, 1e1883L, 1e1884L, 1e1885L, 1e1886L, 1e1887L, 1e1888L, 1e1889L, 
-   1e1890L, 1e1891L, 1e1892L, 1e1893L, 1e1894L, 1e1895L, 1e1896L, 1e1897L, 1e1898L, 1e1899L, 
-   1e1900L, 1e1901L, 1e1902L, 1e1903L, 1e1904L, 1e1905L, 1e1906L, 1e1907L, 1e1908L, 1e1909L, 
-   1e1910L, 1e1911L, 1e1912L, 1e1913L, 1e1914L, 1e1915L, 1e1916L, 1e1917L, 1e1918L, 1e1919L, 
-   1e1920L, 1e1921L, 1e1922L, 1e1923L, 1e1924L, 1e1925L, 1e1926L, 1e1927L, 1e1928L, 1e1929L, 
-   1e1930L, 1e1931L, 1e1932L, 1e1933L, 1e1934L, 1e1935L, 1e1936L, 1e1937L, 1e1938L, 1e1939L, 
-   1e1940L, 1e1941L, 1e1942L, 1e1943L, 1e1944L, 1e1945L, 1e1946L, 1e1947L, 1e1948L, 1e1949L, 
-   1e1950L, 1e1951L, 1e1952L, 1e1953L, 1e1954L, 1e1955L, 1e1956L, 1e1957L, 1e1958L, 1e1959L, 
-   1e1960L, 1e1961L, 1e1962L, 1e1963L, 1e1964L, 1e1965L, 1e1966L, 1e1967L, 1e1968L, 1e1969L, 
-   1e1970L, 1e1971L, 1e1972L, 1e1973L, 1e1974L, 1e1975L, 1e1976L, 1e1977L, 1e1978L, 1e1979L, 
-   1e1980L, 1e1981L, 1e1982L, 1e1983L, 1e1984L, 1e1985L, 1e1986L, 1e1987L, 1e1988L, 1e1989L, 
-   1e1990L, 1e1991L, 1e1992L, 1e1993L, 1e1994L, 1e1995L, 1e1996L, 1e1997L, 1e1998L, 1e1999L, 
-   1e2000L, 1e2001L, 1e2002L, 1e2003L, 1e2004L, 1e2005L, 1e2006L, 1e2007L, 1e2008L, 1e2009L, 
-   1e2010L, 1e2011L, 1e2012L, 1e2013L, 1e2014L, 1e2015L, 1e2016L, 1e2017L, 1e2018L, 1e2019L, 
-   1e2020L, 1e2021L, 1e2022L, 1e2023L, 1e2024L, 1e2025L, 1e2026L, 1e2027L, 1e2028L, 1e2029L, 
-   1e2030L, 1e2031L, 1e2032L, 1e2033L, 1e2034L, 1e2035L, 1e2036L, 1e2037L, 1e2038L, 1e2039L, 
-   1e2040L, 1e2041L, 1e2042L, 1e2043L, 1e2044L, 1e2045L, 1e2046L, 1e2047L, 1e2048L, 1e2049L, 
-   1e2050L, 1e2051L, 1e2052L, 1e2053L, 1e2054L, 1e2055L, 1e2056L, 1e2057L, 1e2058L, 1e2059L, 
-   1e2060L, 1e2061L, 1e2062L, 1e2063L, 1e2064L, 1e2065L, 1e2066L, 1e2067L, 1e2068L, 1e2069L, 
-   1e2070L, 1e2071L, 1e2072L, 1e2073L, 1e2074L, 1e2075L, 1e2076L, 1e2077L, 1e2078L, 1e2079L, 
-   1e2080L, 1e2081L, 1e2082L, 1e2083L, 1e2084L, 1e2085L, 1e2086L, 1e2087L, 1e2088L, 1e2089L, 
-   1e2090L, 1e2091L, 1e2092L, 1e2093L, 1e2094L, 1e2095L, 1e2096L, 1e2097L, 1e2098L, 1e2099L, 
-   1e2100L, 1e2101L, 1e2102L, 1e2103L, 1e2104L, 1e2105L, 1e2106L, 1e2107L, 1e2108L, 1e2109L, 
-   1e2110L, 1e2111L, 1e2112L, 1e2113L, 1e2114L, 1e2115L, 1e2116L, 1e2117L, 1e2118L, 1e2119L, 
-   1e2120L, 1e2121L, 1e2122L, 1e2123L, 1e2124L, 1e2125L, 1e2126L, 1e2127L, 1e2128L, 1e2129L, 
-   1e2130L, 1e2131L, 1e2132L, 1e2133L, 1e2134L, 1e2135L, 1e2136L, 1e2137L, 1e2138L, 1e2139L, 
-   1e2140L, 1e2141L, 1e2142L, 1e2143L, 1e2144L, 1e2145L, 1e2146L, 1e2147L, 1e2148L, 1e2149L, 
-   1e2150L, 1e2151L, 1e2152L, 1e2153L, 1e2154L, 1e2155L, 1e2156L, 1e2157L, 1e2158L, 1e2159L, 
-   1e2160L, 1e2161L, 1e2162L, 1e2163L, 1e2164L, 1e2165L, 1e2166L, 1e2167L, 1e2168L, 1e2169L, 
-   1e2170L, 1e2171L, 1e2172L, 1e2173L, 1e2174L, 1e2175L, 1e2176L, 1e2177L, 1e2178L, 1e2179L, 
-   1e2180L, 1e2181L, 1e2182L, 1e2183L, 1e2184L, 1e2185L, 1e2186L, 1e2187L, 1e2188L, 1e2189L, 
-   1e2190L, 1e2191L, 1e2192L, 1e2193L, 1e2194L, 1e2195L, 1e2196L, 1e2197L, 1e2198L, 1e2199L, 
-   1e2200L, 1e2201L, 1e2202L, 1e2203L, 1e2204L, 1e2205L, 1e2206L, 1e2207L, 1e2208L, 1e2209L, 
-   1e2210L, 1e2211L, 1e2212L, 1e2213L, 1e2214L, 1e2215L, 1e2216L, 1e2217L, 1e2218L, 1e2219L, 
-   1e2220L, 1e2221L, 1e2222L, 1e2223L, 1e2224L, 1e2225L, 1e2226L, 1e2227L, 1e2228L, 1e2229L, 
-   1e2230L, 1e2231L, 1e2232L, 1e2233L, 1e2234L, 1e2235L, 1e2236L, 1e2237L, 1e2238L, 1e2239L, 
-   1e2240L, 1e2241L, 1e2242L, 1e2243L, 1e2244L, 1e2245L, 1e2246L, 1e2247L, 1e2248L, 1e2249L, 
-   1e2250L, 1e2251L, 1e2252L, 1e2253L, 1e2254L, 1e2255L, 1e2256L, 1e2257L, 1e2258L, 1e2259L, 
-   1e2260L, 1e2261L, 1e2262L, 1e2263L, 1e2264L, 1e2265L, 1e2266L, 1e2267L, 1e2268L, 1e2269L, 
-   1e2270L, 1e2271L, 1e2272L, 1e2273L, 1e2274L, 1e2275L, 1e2276L, 1e2277L, 1e2278L, 1e2279L, 
-   1e2280L, 1e2281L, 1e2282L, 1e2283L, 1e2284L, 1e2285L, 1e2286L, 1e2287L, 1e2288L, 1e2289L, 
-   1e2290L, 1e2291L, 1e2292L, 1e2293L, 1e2294L, 1e2295L, 1e2296L, 1e2297L, 1e2298L, 1e2299L, 
-   1e2300L, 1e2301L, 1e2302L, 1e2303L, 1e2304L, 1e2305L, 1e2306L, 1e2307L, 1e2308L, 1e2309L, 
-   1e2310L, 1e2311L, 1e2312L, 1e2313L, 1e2314L, 1e2315L, 1e2316L, 1e2317L, 1e2318L, 1e2319L, 
-   1e2320L, 1e2321L, 1e2322L, 1e2323L, 1e2324L, 1e2325L, 1e2326L, 1e2327L, 1e2328L, 1e2329L, 
-   1e2330L, 1e2331L, 1e2332L, 1e2333L, 1e2334L, 1e2335L, 1e2336L, 1e2337L, 1e2338L, 1e2339L, 
-   1e2340L, 1e2341L, 1e2342L, 1e2343L, 1e2344L, 1e2345L, 1e2346L, 1e2347L, 1e2348L, 1e2349L, 
-   1e2350L, 1e2351L, 1e2352L, 1e2353L, 1e2354L, 1e2355L, 1e2356L, 1e2357L, 1e2358L, 1e2359L, 
-   1e2360L, 1e2361L, 1e2362L, 1e2363L, 1e2364L, 1e2365L, 1e2366L, 1e2367L, 1e2368L, 1e2369L, 
-   1e2370L, 1e2371L, 1e2372L, 1e2373L, 1e2374L, 1e2375L, 1e2376L, 1e2377L, 1e2378L, 1e2379L, 
-   1e2380L, 1e2381L, 1e2382L, 1e2383L, 1e2384L, 1e2385L, 1e2386L, 1e2387L, 1e2388L, 1e2389L, 
-   1e2390L, 1e2391L, 1e2392L, 1e2393L, 1e2394L, 1e2395L, 1e2396L, 1e2397L, 1e2398L, 1e2399L, 
-   1e2400L, 1e2401L, 1e2402L, 1e2403L, 1e2404L, 1e2405L, 1e2406L, 1e2407L, 1e2408L, 1e2409L, 
-   1e2410L, 1e2411L, 1e2412L, 1e2413L, 1e2414L, 1e2415L, 1e2416L, 1e2417L, 1e2418L, 1e2419L, 
-   1e2420L, 1e2421L, 1e2422L, 1e2423L, 1e2424L, 1e2425L, 1e2426L, 1e2427L, 1e2428L, 1e2429L, 
-   1e2430L, 1e2431L, 1e2432L, 1e2433L, 1e2434L, 1e2435L, 1e2436L, 1e2437L, 1e2438L, 1e2439L, 
-   1e2440L, 1e2441L, 1e2442L, 1e2443L, 1e2444L, 1e2445L, 1e2446L, 1e2447L, 1e2448L, 1e2449L, 
-   1e2450L, 1e2451L, 1e2452L, 1e2453L, 1e2454L, 1e2455L, 1e2456L, 1e2457L, 1e2458L, 1e2459L, 
-   1e2460L, 1e2461L, 1e2462L, 1e2463L, 1e2464L, 1e2465L, 1e2466L, 1e2467L, 1e2468L, 1e2469L, 
-   1e2470L, 1e2471L, 1e2472L, 1e2473L, 1e2474L, 1e2475L, 1e2476L, 1e2477L, 1e2478L, 1e2479L, 
-   1e2480L, 1e2481L, 1e2482L, 1e2483L, 1e2484L, 1e2485L, 1e2486L, 1e2487L, 1e2488L, 1e2489L, 
-   1e2490L, 1e2491L, 1e2492L, 1e2493L, 1e2494L, 1e2495L, 1e2496L, 1e2497L, 1e2498L, 1e2499L, 
-   1e2500L, 1e2501L, 1e2502L, 1e2503L, 1e2504L, 1e2505L, 1e2506L, 1e2507L, 1e2508L, 1e2509L, 
-   1e2510L, 1e2511L, 1e2512L, 1e2513L, 1e2514L, 1e2515L, 1e2516L, 1e2517L, 1e2518L, 1e2519L, 
-   1e2520L, 1e2521L, 1e2522L, 1e2523L, 1e2524L, 1e2525L, 1e2526L, 1e2527L, 1e2528L, 1e2529L, 
-   1e2530L, 1e2531L, 1e2532L, 1e2533L, 1e2534L, 1e2535L, 1e2536L, 1e2537L, 1e2538L, 1e2539L, 
-   1e2540L, 1e2541L, 1e2542L, 1e2543L, 1e2544L, 1e2545L, 1e2546L, 1e2547L, 1e2548L, 1e2549L, 
-   1e2550L, 1e2551L, 1e2552L, 1e2553L, 1e2554L, 1e2555L, 1e2556L, 1e2557L, 1e2558L, 1e2559L, 
-   1e2560L, 1e2561L, 1e2562L, 1e2563L, 1e2564L, 1e2565L, 1e2566L, 1e2567L, 1e2568L, 1e2569L, 
-   1e2570L, 1e2571L, 1e2572L, 1e2573L, 1e2574L, 1e2575L, 1e2576L, 1e2577L, 1e2578L, 1e2579L, 
-   1e2580L, 1e2581L, 1e2582L, 1e2583L, 1e2584L, 1e2585L, 1e2586L, 1e2587L, 1e2588L, 1e2589L, 
-   1e2590L, 1e2591L, 1e2592L, 1e2593L, 1e2594L, 1e2595L, 1e2596L, 1e2597L, 1e2598L, 1e2599L, 
-   1e2600L, 1e2601L, 1e2602L, 1e2603L, 1e2604L, 1e2605L, 1e2606L, 1e2607L, 1e2608L, 1e2609L, 
-   1e2610L, 1e2611L, 1e2612L, 1e2613L, 1e2614L, 1e2615L, 1e2616L, 1e2617L, 1e2618L, 1e2619L, 
-   1e2620L, 1e2621L, 1e2622L, 1e2623L, 1e2624L, 1e2625L, 1e2626L, 1e2627L, 1e2628L, 1e2629L, 
-   1e2630L, 1e2631L, 1e2632L, 1e2633L, 1e2634L, 1e2635L, 1e2636L, 1e2637L, 1e2638L, 1e2639L, 
-   1e2640L, 1e2641L, 1e2642L, 1e2643L, 1e2644L, 1e2645L, 1e2646L, 1e2647L, 1e2648L, 1e2649L, 
-   1e2650L, 1e2651L, 1e2652L, 1e2653L, 1e2654L, 1e2655L, 1e2656L, 1e2657L, 1e2658L, 1e2659L, 
-   1e2660L, 1e2661L, 1e2662L, 1e2663L, 1e2664L, 1e2665L, 1e2666L, 1e2667L, 1e2668L, 1e2669L, 
-   1e2670L, 1e2671L, 1e2672L, 1e2673L, 1e2674L, 1e2675L, 1e2676L, 1e2677L, 1e2678L, 1e2679L, 
-   1e2680L, 1e2681L, 1e2682L, 1e2683L, 1e2684L, 1e2685L, 1e2686L, 1e2687L, 1e2688L, 1e2689L, 
-   1e2690L, 1e2691L, 1e2692L, 1e2693L, 1e2694L, 1e2695L, 1e2696L, 1e2697L, 1e2698L, 1e2699L, 
-   1e2700L, 1e2701L, 1e2702L, 1e2703L, 1e2704L, 1e2705L, 1e2706L, 1e2707L, 1e2708L, 1e2709L, 
-   1e2710L, 1e2711L, 1e2712L, 1e2713L, 1e2714L, 1e2715L, 1e2716L, 1e2717L, 1e2718L, 1e2719L, 
-   1e2720L, 1e2721L, 1e2722L, 1e2723L, 1e2724L, 1e2725L, 1e2726L, 1e2727L, 1e2728L, 1e2729L, 
-   1e2730L, 1e2731L, 1e2732L, 1e2733L, 1e2734L, 1e2735L, 1e2736L, 1e2737L, 1e2738L, 1e2739L, 
-   1e2740L, 1e2741L, 1e2742L, 1e2743L, 1e2744L, 1e2745L, 1e2746L, 1e2747L, 1e2748L, 1e2749L, 
-   1e2750L, 1e2751L, 1e2752L, 1e2753L, 1e2754L, 1e2755L, 1e2756L, 1e2757L, 1e2758L, 1e2759L, 
-   1e2760L, 1e2761L, 1e2762L, 1e2763L, 1e2764L, 1e2765L, 1e2766L, 1e2767L, 1e2768L, 1e2769L, 
-   1e2770L, 1e2771L, 1e2772L, 1e2773L, 1e2774L, 1e2775L, 1e2776L, 1e2777L, 1e2778L, 1e2779L, 
-   1e2780L, 1e2781L, 1e2782L, 1e2783L, 1e2784L, 1e2785L, 1e2786L, 1e2787L, 1e2788L, 1e2789L, 
-   1e2790L, 1e2791L, 1e2792L, 1e2793L, 1e2794L, 1e2795L, 1e2796L, 1e2797L, 1e2798L, 1e2799L, 
-   1e2800L, 1e2801L, 1e2802L, 1e2803L, 1e2804L, 1e2805L, 1e2806L, 1e2807L, 1e2808L, 1e2809L, 
-   1e2810L, 1e2811L, 1e2812L, 1e2813L, 1e2814L, 1e2815L, 1e2816L, 1e2817L, 1e2818L, 1e2819L, 
-   1e2820L, 1e2821L, 1e2822L, 1e2823L, 1e2824L, 1e2825L, 1e2826L, 1e2827L, 1e2828L, 1e2829L, 
-   1e2830L, 1e2831L, 1e2832L, 1e2833L, 1e2834L, 1e2835L, 1e2836L, 1e2837L, 1e2838L, 1e2839L, 
-   1e2840L, 1e2841L, 1e2842L, 1e2843L, 1e2844L, 1e2845L, 1e2846L, 1e2847L, 1e2848L, 1e2849L, 
-   1e2850L, 1e2851L, 1e2852L, 1e2853L, 1e2854L, 1e2855L, 1e2856L, 1e2857L, 1e2858L, 1e2859L, 
-   1e2860L, 1e2861L, 1e2862L, 1e2863L, 1e2864L, 1e2865L, 1e2866L, 1e2867L, 1e2868L, 1e2869L, 
-   1e2870L, 1e2871L, 1e2872L, 1e2873L, 1e2874L, 1e2875L, 1e2876L, 1e2877L, 1e2878L, 1e2879L, 
-   1e2880L, 1e2881L, 1e2882L, 1e2883L, 1e2884L, 1e2885L, 1e2886L, 1e2887L, 1e2888L, 1e2889L, 
-   1e2890L, 1e2891L, 1e2892L, 1e2893L, 1e2894L, 1e2895L, 1e2896L, 1e2897L, 1e2898L, 1e2899L, 
-   1e2900L, 1e2901L, 1e2902L, 1e2903L, 1e2904L, 1e2905L, 1e2906L, 1e2907L, 1e2908L, 1e2909L, 
-   1e2910L, 1e2911L, 1e2912L, 1e2913L, 1e2914L, 1e2915L, 1e2916L, 1e2917L, 1e2918L, 1e2919L, 
-   1e2920L, 1e2921L, 1e2922L, 1e2923L, 1e2924L, 1e2925L, 1e2926L, 1e2927L, 1e2928L, 1e2929L, 
-   1e2930L, 1e2931L, 1e2932L, 1e2933L, 1e2934L, 1e2935L, 1e2936L, 1e2937L, 1e2938L, 1e2939L, 
-   1e2940L, 1e2941L, 1e2942L, 1e2943L, 1e2944L, 1e2945L, 1e2946L, 1e2947L, 1e2948L, 1e2949L, 
-   1e2950L, 1e2951L, 1e2952L, 1e2953L, 1e2954L, 1e2955L, 1e2956L, 1e2957L, 1e2958L, 1e2959L, 
-   1e2960L, 1e2961L, 1e2962L, 1e2963L, 1e2964L, 1e2965L, 1e2966L, 1e2967L, 1e2968L, 1e2969L, 
-   1e2970L, 1e2971L, 1e2972L, 1e2973L, 1e2974L, 1e2975L, 1e2976L, 1e2977L, 1e2978L, 1e2979L, 
-   1e2980L, 1e2981L, 1e2982L, 1e2983L, 1e2984L, 1e2985L, 1e2986L, 1e2987L, 1e2988L, 1e2989L, 
-   1e2990L, 1e2991L, 1e2992L, 1e2993L, 1e2994L, 1e2995L, 1e2996L, 1e2997L, 1e2998L, 1e2999L, 
-   1e3000L, 1e3001L, 1e3002L, 1e3003L, 1e3004L, 1e3005L, 1e3006L, 1e3007L, 1e3008L, 1e3009L, 
-   1e3010L, 1e3011L, 1e3012L, 1e3013L, 1e3014L, 1e3015L, 1e3016L, 1e3017L, 1e3018L, 1e3019L, 
-   1e3020L, 1e3021L, 1e3022L, 1e3023L, 1e3024L, 1e3025L, 1e3026L, 1e3027L, 1e3028L, 1e3029L, 
-   1e3030L, 1e3031L, 1e3032L, 1e3033L, 1e3034L, 1e3035L, 1e3036L, 1e3037L, 1e3038L, 1e3039L, 
-   1e3040L, 1e3041L, 1e3042L, 1e3043L, 1e3044L, 1e3045L, 1e3046L, 1e3047L, 1e3048L, 1e3049L, 
-   1e3050L, 1e3051L, 1e3052L, 1e3053L, 1e3054L, 1e3055L, 1e3056L, 1e3057L, 1e3058L, 1e3059L, 
-   1e3060L, 1e3061L, 1e3062L, 1e3063L, 1e3064L, 1e3065L, 1e3066L, 1e3067L, 1e3068L, 1e3069L, 
-   1e3070L, 1e3071L, 1e3072L, 1e3073L, 1e3074L, 1e3075L, 1e3076L, 1e3077L, 1e3078L, 1e3079L, 
-   1e3080L, 1e3081L, 1e3082L, 1e3083L, 1e3084L, 1e3085L, 1e3086L, 1e3087L, 1e3088L, 1e3089L, 
-   1e3090L, 1e3091L, 1e3092L, 1e3093L, 1e3094L, 1e3095L, 1e3096L, 1e3097L, 1e3098L, 1e3099L, 
-   1e3100L, 1e3101L, 1e3102L, 1e3103L, 1e3104L, 1e3105L, 1e3106L, 1e3107L, 1e3108L, 1e3109L, 
-   1e3110L, 1e3111L, 1e3112L, 1e3113L, 1e3114L, 1e3115L, 1e3116L, 1e3117L, 1e3118L, 1e3119L, 
-   1e3120L, 1e3121L, 1e3122L, 1e3123L, 1e3124L, 1e3125L, 1e3126L, 1e3127L, 1e3128L, 1e3129L, 
-   1e3130L, 1e3131L, 1e3132L, 1e3133L, 1e3134L, 1e3135L, 1e3136L, 1e3137L, 1e3138L, 1e3139L, 
-   1e3140L, 1e3141L, 1e3142L, 1e3143L, 1e3144L, 1e3145L, 1e3146L, 1e3147L, 1e3148L, 1e3149L, 
-   1e3150L, 1e3151L, 1e3152L, 1e3153L, 1e3154L, 1e3155L, 1e3156L, 1e3157L, 1e3158L, 1e3159L, 
-   1e3160L, 1e3161L, 1e3162L, 1e3163L, 1e3164L, 1e3165L, 1e3166L, 1e3167L, 1e3168L, 1e3169L, 
-   1e3170L, 1e3171L, 1e3172L, 1e3173L, 1e3174L, 1e3175L, 1e3176L, 1e3177L, 1e3178L, 1e3179L, 
-   1e3180L, 1e3181L, 1e3182L, 1e3183L, 1e3184L, 1e3185L, 1e3186L, 1e3187L, 1e3188L, 1e3189L, 
-   1e3190L, 1e3191L, 1e3192L, 1e3193L, 1e3194L, 1e3195L, 1e3196L, 1e3197L, 1e3198L, 1e3199L, 
-   1e3200L, 1e3201L, 1e3202L, 1e3203L, 1e3204L, 1e3205L, 1e3206L, 1e3207L, 1e3208L, 1e3209L, 
-   1e3210L, 1e3211L, 1e3212L, 1e3213L, 1e3214L, 1e3215L, 1e3216L, 1e3217L, 1e3218L, 1e3219L, 
-   1e3220L, 1e3221L, 1e3222L, 1e3223L, 1e3224L, 1e3225L, 1e3226L, 1e3227L, 1e3228L, 1e3229L, 
-   1e3230L, 1e3231L, 1e3232L, 1e3233L, 1e3234L, 1e3235L, 1e3236L, 1e3237L, 1e3238L, 1e3239L, 
-   1e3240L, 1e3241L, 1e3242L, 1e3243L, 1e3244L, 1e3245L, 1e3246L, 1e3247L, 1e3248L, 1e3249L, 
-   1e3250L, 1e3251L, 1e3252L, 1e3253L, 1e3254L, 1e3255L, 1e3256L, 1e3257L, 1e3258L, 1e3259L, 
-   1e3260L, 1e3261L, 1e3262L, 1e3263L, 1e3264L, 1e3265L, 1e3266L, 1e3267L, 1e3268L, 1e3269L, 
-   1e3270L, 1e3271L, 1e3272L, 1e3273L, 1e3274L, 1e3275L, 1e3276L, 1e3277L, 1e3278L, 1e3279L, 
-   1e3280L, 1e3281L, 1e3282L, 1e3283L, 1e3284L, 1e3285L, 1e3286L, 1e3287L, 1e3288L, 1e3289L, 
-   1e3290L, 1e3291L, 1e3292L, 1e3293L, 1e3294L, 1e3295L, 1e3296L, 1e3297L, 1e3298L, 1e3299L, 
-   1e3300L, 1e3301L, 1e3302L, 1e3303L, 1e3304L, 1e3305L, 1e3306L, 1e3307L, 1e3308L, 1e3309L, 
-   1e3310L, 1e3311L, 1e3312L, 1e3313L, 1e3314L, 1e3315L, 1e3316L, 1e3317L, 1e3318L, 1e3319L, 
-   1e3320L, 1e3321L, 1e3322L, 1e3323L, 1e3324L, 1e3325L, 1e3326L, 1e3327L, 1e3328L, 1e3329L, 
-   1e3330L, 1e3331L, 1e3332L, 1e3333L, 1e3334L, 1e3335L, 1e3336L, 1e3337L, 1e3338L, 1e3339L, 
-   1e3340L, 1e3341L, 1e3342L, 1e3343L, 1e3344L, 1e3345L, 1e3346L, 1e3347L, 1e3348L, 1e3349L, 
-   1e3350L, 1e3351L, 1e3352L, 1e3353L, 1e3354L, 1e3355L, 1e3356L, 1e3357L, 1e3358L, 1e3359L, 
-   1e3360L, 1e3361L, 1e3362L, 1e3363L, 1e3364L, 1e3365L, 1e3366L, 1e3367L, 1e3368L, 1e3369L, 
-   1e3370L, 1e3371L, 1e3372L, 1e3373L, 1e3374L, 1e3375L, 1e3376L, 1e3377L, 1e3378L, 1e3379L, 
-   1e3380L, 1e3381L, 1e3382L, 1e3383L, 1e3384L, 1e3385L, 1e3386L, 1e3387L, 1e3388L, 1e3389L, 
-   1e3390L, 1e3391L, 1e3392L, 1e3393L, 1e3394L, 1e3395L, 1e3396L, 1e3397L, 1e3398L, 1e3399L, 
-   1e3400L, 1e3401L, 1e3402L, 1e3403L, 1e3404L, 1e3405L, 1e3406L, 1e3407L, 1e3408L, 1e3409L, 
-   1e3410L, 1e3411L, 1e3412L, 1e3413L, 1e3414L, 1e3415L, 1e3416L, 1e3417L, 1e3418L, 1e3419L, 
-   1e3420L, 1e3421L, 1e3422L, 1e3423L, 1e3424L, 1e3425L, 1e3426L, 1e3427L, 1e3428L, 1e3429L, 
-   1e3430L, 1e3431L, 1e3432L, 1e3433L, 1e3434L, 1e3435L, 1e3436L, 1e3437L, 1e3438L, 1e3439L, 
-   1e3440L, 1e3441L, 1e3442L, 1e3443L, 1e3444L, 1e3445L, 1e3446L, 1e3447L, 1e3448L, 1e3449L, 
-   1e3450L, 1e3451L, 1e3452L, 1e3453L, 1e3454L, 1e3455L, 1e3456L, 1e3457L, 1e3458L, 1e3459L, 
-   1e3460L, 1e3461L, 1e3462L, 1e3463L, 1e3464L, 1e3465L, 1e3466L, 1e3467L, 1e3468L, 1e3469L, 
-   1e3470L, 1e3471L, 1e3472L, 1e3473L, 1e3474L, 1e3475L, 1e3476L, 1e3477L, 1e3478L, 1e3479L, 
-   1e3480L, 1e3481L, 1e3482L, 1e3483L, 1e3484L, 1e3485L, 1e3486L, 1e3487L, 1e3488L, 1e3489L, 
-   1e3490L, 1e3491L, 1e3492L, 1e3493L, 1e3494L, 1e3495L, 1e3496L, 1e3497L, 1e3498L, 1e3499L, 
-   1e3500L, 1e3501L, 1e3502L, 1e3503L, 1e3504L, 1e3505L, 1e3506L, 1e3507L, 1e3508L, 1e3509L, 
-   1e3510L, 1e3511L, 1e3512L, 1e3513L, 1e3514L, 1e3515L, 1e3516L, 1e3517L, 1e3518L, 1e3519L, 
-   1e3520L, 1e3521L, 1e3522L, 1e3523L, 1e3524L, 1e3525L, 1e3526L, 1e3527L, 1e3528L, 1e3529L, 
-   1e3530L, 1e3531L, 1e3532L, 1e3533L, 1e3534L, 1e3535L, 1e3536L, 1e3537L, 1e3538L, 1e3539L, 
-   1e3540L, 1e3541L, 1e3542L, 1e3543L, 1e3544L, 1e3545L, 1e3546L, 1e3547L, 1e3548L, 1e3549L, 
-   1e3550L, 1e3551L, 1e3552L, 1e3553L, 1e3554L, 1e3555L, 1e3556L, 1e3557L, 1e3558L, 1e3559L, 
-   1e3560L, 1e3561L, 1e3562L, 1e3563L, 1e3564L, 1e3565L, 1e3566L, 1e3567L, 1e3568L, 1e3569L, 
-   1e3570L, 1e3571L, 1e3572L, 1e3573L, 1e3574L, 1e3575L, 1e3576L, 1e3577L, 1e3578L, 1e3579L, 
-   1e3580L, 1e3581L, 1e3582L, 1e3583L, 1e3584L, 1e3585L, 1e3586L, 1e3587L, 1e3588L, 1e3589L, 
-   1e3590L, 1e3591L, 1e3592L, 1e3593L, 1e3594L, 1e3595L, 1e3596L, 1e3597L, 1e3598L, 1e3599L, 
-   1e3600L, 1e3601L, 1e3602L, 1e3603L, 1e3604L, 1e3605L, 1e3606L, 1e3607L, 1e3608L, 1e3609L, 
-   1e3610L, 1e3611L, 1e3612L, 1e3613L, 1e3614L, 1e3615L, 1e3616L, 1e3617L, 1e3618L, 1e3619L, 
-   1e3620L, 1e3621L, 1e3622L, 1e3623L, 1e3624L, 1e3625L, 1e3626L, 1e3627L, 1e3628L, 1e3629L, 
-   1e3630L, 1e3631L, 1e3632L, 1e3633L, 1e3634L, 1e3635L, 1e3636L, 1e3637L, 1e3638L, 1e3639L, 
-   1e3640L, 1e3641L, 1e3642L, 1e3643L, 1e3644L, 1e3645L, 1e3646L, 1e3647L, 1e3648L, 1e3649L, 
-   1e3650L, 1e3651L, 1e3652L, 1e3653L, 1e3654L, 1e3655L, 1e3656L, 1e3657L, 1e3658L, 1e3659L, 
-   1e3660L, 1e3661L, 1e3662L, 1e3663L, 1e3664L, 1e3665L, 1e3666L, 1e3667L, 1e3668L, 1e3669L, 
-   1e3670L, 1e3671L, 1e3672L, 1e3673L, 1e3674L, 1e3675L, 1e3676L, 1e3677L, 1e3678L, 1e3679L, 
-   1e3680L, 1e3681L, 1e3682L, 1e3683L, 1e3684L, 1e3685L, 1e3686L, 1e3687L, 1e3688L, 1e3689L, 
-   1e3690L, 1e3691L, 1e3692L, 1e3693L, 1e3694L, 1e3695L, 1e3696L, 1e3697L, 1e3698L, 1e3699L, 
-   1e3700L, 1e3701L, 1e3702L, 1e3703L, 1e3704L, 1e3705L, 1e3706L, 1e3707L, 1e3708L, 1e3709L, 
-   1e3710L, 1e3711L, 1e3712L, 1e3713L, 1e3714L, 1e3715L, 1e3716L, 1e3717L, 1e3718L, 1e3719L, 
-   1e3720L, 1e3721L, 1e3722L, 1e3723L, 1e3724L, 1e3725L, 1e3726L, 1e3727L, 1e3728L, 1e3729L, 
-   1e3730L, 1e3731L, 1e3732L, 1e3733L, 1e3734L, 1e3735L, 1e3736L, 1e3737L, 1e3738L, 1e3739L, 
-   1e3740L, 1e3741L, 1e3742L, 1e3743L, 1e3744L, 1e3745L, 1e3746L, 1e3747L, 1e3748L, 1e3749L, 
-   1e3750L, 1e3751L, 1e3752L, 1e3753L, 1e3754L, 1e3755L, 1e3756L, 1e3757L, 1e3758L, 1e3759L, 
-   1e3760L, 1e3761L, 1e3762L, 1e3763L, 1e3764L, 1e3765L, 1e3766L, 1e3767L, 1e3768L, 1e3769L, 
-   1e3770L, 1e3771L, 1e3772L, 1e3773L, 1e3774L, 1e3775L, 1e3776L, 1e3777L, 1e3778L, 1e3779L, 
-   1e3780L, 1e3781L, 1e3782L, 1e3783L, 1e3784L, 1e3785L, 1e3786L, 1e3787L, 1e3788L, 1e3789L, 
-   1e3790L, 1e3791L, 1e3792L, 1e3793L, 1e3794L, 1e3795L, 1e3796L, 1e3797L, 1e3798L, 1e3799L, 
-   1e3800L, 1e3801L, 1e3802L, 1e3803L, 1e3804L, 1e3805L, 1e3806L, 1e3807L, 1e3808L, 1e3809L, 
-   1e3810L, 1e3811L, 1e3812L, 1e3813L, 1e3814L, 1e3815L, 1e3816L, 1e3817L, 1e3818L, 1e3819L, 
-   1e3820L, 1e3821L, 1e3822L, 1e3823L, 1e3824L, 1e3825L, 1e3826L, 1e3827L, 1e3828L, 1e3829L, 
-   1e3830L, 1e3831L, 1e3832L, 1e3833L, 1e3834L, 1e3835L, 1e3836L, 1e3837L, 1e3838L, 1e3839L, 
-   1e3840L, 1e3841L, 1e3842L, 1e3843L, 1e3844L, 1e3845L, 1e3846L, 1e3847L, 1e3848L, 1e3849L, 
-   1e3850L, 1e3851L, 1e3852L, 1e3853L, 1e3854L, 1e3855L, 1e3856L, 1e3857L, 1e3858L, 1e3859L, 
-   1e3860L, 1e3861L, 1e3862L, 1e3863L, 1e3864L, 1e3865L, 1e3866L, 1e3867L, 1e3868L, 1e3869L, 
-   1e3870L, 1e3871L, 1e3872L, 1e3873L, 1e3874L, 1e3875L, 1e3876L, 1e3877L, 1e3878L, 1e3879L, 
-   1e3880L, 1e3881L, 1e3882L, 1e3883L, 1e3884L, 1e3885L, 1e3886L, 1e3887L, 1e3888L, 1e3889L, 
-   1e3890L, 1e3891L, 1e3892L, 1e3893L, 1e3894L, 1e3895L, 1e3896L, 1e3897L, 1e3898L, 1e3899L, 
-   1e3900L, 1e3901L, 1e3902L, 1e3903L, 1e3904L, 1e3905L, 1e3906L, 1e3907L, 1e3908L, 1e3909L, 
-   1e3910L, 1e3911L, 1e3912L, 1e3913L, 1e3914L, 1e3915L, 1e3916L, 1e3917L, 1e3918L, 1e3919L, 
-   1e3920L, 1e3921L, 1e3922L, 1e3923L, 1e3924L, 1e3925L, 1e3926L, 1e3927L, 1e3928L, 1e3929L, 
-   1e3930L, 1e3931L, 1e3932L, 1e3933L, 1e3934L, 1e3935L, 1e3936L, 1e3937L, 1e3938L, 1e3939L, 
-   1e3940L, 1e3941L, 1e3942L, 1e3943L, 1e3944L, 1e3945L, 1e3946L, 1e3947L, 1e3948L, 1e3949L, 
-   1e3950L, 1e3951L, 1e3952L, 1e3953L, 1e3954L, 1e3955L, 1e3956L, 1e3957L, 1e3958L, 1e3959L, 
-   1e3960L, 1e3961L, 1e3962L, 1e3963L, 1e3964L, 1e3965L, 1e3966L, 1e3967L, 1e3968L, 1e3969L, 
-   1e3970L, 1e3971L, 1e3972L, 1e3973L, 1e3974L, 1e3975L, 1e3976L, 1e3977L, 1e3978L, 1e3979L, 
-   1e3980L, 1e3981L, 1e3982L, 1e3983L, 1e3984L, 1e3985L, 1e3986L, 1e3987L, 1e3988L, 1e3989L, 
-   1e3990L, 1e3991L, 1e3992L, 1e3993L, 1e3994L, 1e3995L, 1e3996L, 1e3997L, 1e3998L, 1e3999L, 
-   1e4000L, 1e4001L, 1e4002L, 1e4003L, 1e4004L, 1e4005L, 1e4006L, 1e4007L, 1e4008L, 1e4009L, 
-   1e4010L, 1e4011L, 1e4012L, 1e4013L, 1e4014L, 1e4015L, 1e4016L, 1e4017L, 1e4018L, 1e4019L, 
-   1e4020L, 1e4021L, 1e4022L, 1e4023L, 1e4024L, 1e4025L, 1e4026L, 1e4027L, 1e4028L, 1e4029L, 
-   1e4030L, 1e4031L, 1e4032L, 1e4033L, 1e4034L, 1e4035L, 1e4036L, 1e4037L, 1e4038L, 1e4039L, 
-   1e4040L, 1e4041L, 1e4042L, 1e4043L, 1e4044L, 1e4045L, 1e4046L, 1e4047L, 1e4048L, 1e4049L, 
-   1e4050L, 1e4051L, 1e4052L, 1e4053L, 1e4054L, 1e4055L, 1e4056L, 1e4057L, 1e4058L, 1e4059L, 
-   1e4060L, 1e4061L, 1e4062L, 1e4063L, 1e4064L, 1e4065L, 1e4066L, 1e4067L, 1e4068L, 1e4069L, 
-   1e4070L, 1e4071L, 1e4072L, 1e4073L, 1e4074L, 1e4075L, 1e4076L, 1e4077L, 1e4078L, 1e4079L, 
-   1e4080L, 1e4081L, 1e4082L, 1e4083L, 1e4084L, 1e4085L, 1e4086L, 1e4087L, 1e4088L, 1e4089L, 
-   1e4090L, 1e4091L, 1e4092L, 1e4093L, 1e4094L, 1e4095L, 1e4096L, 1e4097L, 1e4098L, 1e4099L, 
-   1e4100L, 1e4101L, 1e4102L, 1e4103L, 1e4104L, 1e4105L, 1e4106L, 1e4107L, 1e4108L, 1e4109L, 
-   1e4110L, 1e4111L, 1e4112L, 1e4113L, 1e4114L, 1e4115L, 1e4116L, 1e4117L, 1e4118L, 1e4119L, 
-   1e4120L, 1e4121L, 1e4122L, 1e4123L, 1e4124L, 1e4125L, 1e4126L, 1e4127L, 1e4128L, 1e4129L, 
-   1e4130L, 1e4131L, 1e4132L, 1e4133L, 1e4134L, 1e4135L, 1e4136L, 1e4137L, 1e4138L, 1e4139L, 
-   1e4140L, 1e4141L, 1e4142L, 1e4143L, 1e4144L, 1e4145L, 1e4146L, 1e4147L, 1e4148L, 1e4149L, 
-   1e4150L, 1e4151L, 1e4152L, 1e4153L, 1e4154L, 1e4155L, 1e4156L, 1e4157L, 1e4158L, 1e4159L, 
-   1e4160L, 1e4161L, 1e4162L, 1e4163L, 1e4164L, 1e4165L, 1e4166L, 1e4167L, 1e4168L, 1e4169L, 
-   1e4170L, 1e4171L, 1e4172L, 1e4173L, 1e4174L, 1e4175L, 1e4176L, 1e4177L, 1e4178L, 1e4179L, 
-   1e4180L, 1e4181L, 1e4182L, 1e4183L, 1e4184L, 1e4185L, 1e4186L, 1e4187L, 1e4188L, 1e4189L, 
-   1e4190L, 1e4191L, 1e4192L, 1e4193L, 1e4194L, 1e4195L, 1e4196L, 1e4197L, 1e4198L, 1e4199L, 
-   1e4200L, 1e4201L, 1e4202L, 1e4203L, 1e4204L, 1e4205L, 1e4206L, 1e4207L, 1e4208L, 1e4209L, 
-   1e4210L, 1e4211L, 1e4212L, 1e4213L, 1e4214L, 1e4215L, 1e4216L, 1e4217L, 1e4218L, 1e4219L, 
-   1e4220L, 1e4221L, 1e4222L, 1e4223L, 1e4224L, 1e4225L, 1e4226L, 1e4227L, 1e4228L, 1e4229L, 
-   1e4230L, 1e4231L, 1e4232L, 1e4233L, 1e4234L, 1e4235L, 1e4236L, 1e4237L, 1e4238L, 1e4239L, 
-   1e4240L, 1e4241L, 1e4242L, 1e4243L, 1e4244L, 1e4245L, 1e4246L, 1e4247L, 1e4248L, 1e4249L, 
-   1e4250L, 1e4251L, 1e4252L, 1e4253L, 1e4254L, 1e4255L, 1e4256L, 1e4257L, 1e4258L, 1e4259L, 
-   1e4260L, 1e4261L, 1e4262L, 1e4263L, 1e4264L, 1e4265L, 1e4266L, 1e4267L, 1e4268L, 1e4269L, 
-   1e4270L, 1e4271L, 1e4272L, 1e4273L, 1e4274L, 1e4275L, 1e4276L, 1e4277L, 1e4278L, 1e4279L, 
-   1e4280L, 1e4281L, 1e4282L, 1e4283L, 1e4284L, 1e4285L, 1e4286L, 1e4287L, 1e4288L, 1e4289L, 
-   1e4290L, 1e4291L, 1e4292L, 1e4293L, 1e4294L, 1e4295L, 1e4296L, 1e4297L, 1e4298L, 1e4299L, 
-   1e4300L, 1e4301L, 1e4302L, 1e4303L, 1e4304L, 1e4305L, 1e4306L, 1e4307L, 1e4308L, 1e4309L, 
-   1e4310L, 1e4311L, 1e4312L, 1e4313L, 1e4314L, 1e4315L, 1e4316L, 1e4317L, 1e4318L, 1e4319L, 
-   1e4320L, 1e4321L, 1e4322L, 1e4323L, 1e4324L, 1e4325L, 1e4326L, 1e4327L, 1e4328L, 1e4329L, 
-   1e4330L, 1e4331L, 1e4332L, 1e4333L, 1e4334L, 1e4335L, 1e4336L, 1e4337L, 1e4338L, 1e4339L, 
-   1e4340L, 1e4341L, 1e4342L, 1e4343L, 1e4344L, 1e4345L, 1e4346L, 1e4347L, 1e4348L, 1e4349L, 
-   1e4350L, 1e4351L, 1e4352L, 1e4353L, 1e4354L, 1e4355L, 1e4356L, 1e4357L, 1e4358L, 1e4359L, 
-   1e4360L, 1e4361L, 1e4362L, 1e4363L, 1e4364L, 1e4365L, 1e4366L, 1e4367L, 1e4368L, 1e4369L, 
-   1e4370L, 1e4371L, 1e4372L, 1e4373L, 1e4374L, 1e4375L, 1e4376L, 1e4377L, 1e4378L, 1e4379L, 
-   1e4380L, 1e4381L, 1e4382L, 1e4383L, 1e4384L, 1e4385L, 1e4386L, 1e4387L, 1e4388L, 1e4389L, 
-   1e4390L, 1e4391L, 1e4392L, 1e4393L, 1e4394L, 1e4395L, 1e4396L, 1e4397L, 1e4398L, 1e4399L, 
-   1e4400L, 1e4401L, 1e4402L, 1e4403L, 1e4404L, 1e4405L, 1e4406L, 1e4407L, 1e4408L, 1e4409L, 
-   1e4410L, 1e4411L, 1e4412L, 1e4413L, 1e4414L, 1e4415L, 1e4416L, 1e4417L, 1e4418L, 1e4419L, 
-   1e4420L, 1e4421L, 1e4422L, 1e4423L, 1e4424L, 1e4425L, 1e4426L, 1e4427L, 1e4428L, 1e4429L, 
-   1e4430L, 1e4431L, 1e4432L, 1e4433L, 1e4434L, 1e4435L, 1e4436L, 1e4437L, 1e4438L, 1e4439L, 
-   1e4440L, 1e4441L, 1e4442L, 1e4443L, 1e4444L, 1e4445L, 1e4446L, 1e4447L, 1e4448L, 1e4449L, 
-   1e4450L, 1e4451L, 1e4452L, 1e4453L, 1e4454L, 1e4455L, 1e4456L, 1e4457L, 1e4458L, 1e4459L, 
-   1e4460L, 1e4461L, 1e4462L, 1e4463L, 1e4464L, 1e4465L, 1e4466L, 1e4467L, 1e4468L, 1e4469L, 
-   1e4470L, 1e4471L, 1e4472L, 1e4473L, 1e4474L, 1e4475L, 1e4476L, 1e4477L, 1e4478L, 1e4479L, 
-   1e4480L, 1e4481L, 1e4482L, 1e4483L, 1e4484L, 1e4485L, 1e4486L, 1e4487L, 1e4488L, 1e4489L, 
-   1e4490L, 1e4491L, 1e4492L, 1e4493L, 1e4494L, 1e4495L, 1e4496L, 1e4497L, 1e4498L, 1e4499L, 
-   1e4500L, 1e4501L, 1e4502L, 1e4503L, 1e4504L, 1e4505L, 1e4506L, 1e4507L, 1e4508L, 1e4509L, 
-   1e4510L, 1e4511L, 1e4512L, 1e4513L, 1e4514L, 1e4515L, 1e4516L, 1e4517L, 1e4518L, 1e4519L, 
-   1e4520L, 1e4521L, 1e4522L, 1e4523L, 1e4524L, 1e4525L, 1e4526L, 1e4527L, 1e4528L, 1e4529L, 
-   1e4530L, 1e4531L, 1e4532L, 1e4533L, 1e4534L, 1e4535L, 1e4536L, 1e4537L, 1e4538L, 1e4539L, 
-   1e4540L, 1e4541L, 1e4542L, 1e4543L, 1e4544L, 1e4545L, 1e4546L, 1e4547L, 1e4548L, 1e4549L, 
-   1e4550L, 1e4551L, 1e4552L, 1e4553L, 1e4554L, 1e4555L, 1e4556L, 1e4557L, 1e4558L, 1e4559L, 
-   1e4560L, 1e4561L, 1e4562L, 1e4563L, 1e4564L, 1e4565L, 1e4566L, 1e4567L, 1e4568L, 1e4569L, 
-   1e4570L, 1e4571L, 1e4572L, 1e4573L, 1e4574L, 1e4575L, 1e4576L, 1e4577L, 1e4578L, 1e4579L, 
-   1e4580L, 1e4581L, 1e4582L, 1e4583L, 1e4584L, 1e4585L, 1e4586L, 1e4587L, 1e4588L, 1e4589L, 
-   1e4590L, 1e4591L, 1e4592L, 1e4593L, 1e4594L, 1e4595L, 1e4596L, 1e4597L, 1e4598L, 1e4599L, 
-   1e4600L, 1e4601L, 1e4602L, 1e4603L, 1e4604L, 1e4605L, 1e4606L, 1e4607L, 1e4608L, 1e4609L, 
-   1e4610L, 1e4611L, 1e4612L, 1e4613L, 1e4614L, 1e4615L, 1e4616L, 1e4617L, 1e4618L, 1e4619L, 
-   1e4620L, 1e4621L, 1e4622L, 1e4623L, 1e4624L, 1e4625L, 1e4626L, 1e4627L, 1e4628L, 1e4629L, 
-   1e4630L, 1e4631L, 1e4632L, 1e4633L, 1e4634L, 1e4635L, 1e4636L, 1e4637L, 1e4638L, 1e4639L, 
-   1e4640L, 1e4641L, 1e4642L, 1e4643L, 1e4644L, 1e4645L, 1e4646L, 1e4647L, 1e4648L, 1e4649L, 
-   1e4650L, 1e4651L, 1e4652L, 1e4653L, 1e4654L, 1e4655L, 1e4656L, 1e4657L, 1e4658L, 1e4659L, 
-   1e4660L, 1e4661L, 1e4662L, 1e4663L, 1e4664L, 1e4665L, 1e4666L, 1e4667L, 1e4668L, 1e4669L, 
-   1e4670L, 1e4671L, 1e4672L, 1e4673L, 1e4674L, 1e4675L, 1e4676L, 1e4677L, 1e4678L, 1e4679L, 
-   1e4680L, 1e4681L, 1e4682L, 1e4683L, 1e4684L, 1e4685L, 1e4686L, 1e4687L, 1e4688L, 1e4689L, 
-   1e4690L, 1e4691L, 1e4692L, 1e4693L, 1e4694L, 1e4695L, 1e4696L, 1e4697L, 1e4698L, 1e4699L, 
-   1e4700L, 1e4701L, 1e4702L, 1e4703L, 1e4704L, 1e4705L, 1e4706L, 1e4707L, 1e4708L, 1e4709L, 
-   1e4710L, 1e4711L, 1e4712L, 1e4713L, 1e4714L, 1e4715L, 1e4716L, 1e4717L, 1e4718L, 1e4719L, 
-   1e4720L, 1e4721L, 1e4722L, 1e4723L, 1e4724L, 1e4725L, 1e4726L, 1e4727L, 1e4728L, 1e4729L, 
-   1e4730L, 1e4731L, 1e4732L, 1e4733L, 1e4734L, 1e4735L, 1e4736L, 1e4737L, 1e4738L, 1e4739L, 
-   1e4740L, 1e4741L, 1e4742L, 1e4743L, 1e4744L, 1e4745L, 1e4746L, 1e4747L, 1e4748L, 1e4749L, 
-   1e4750L, 1e4751L, 1e4752L, 1e4753L, 1e4754L, 1e4755L, 1e4756L, 1e4757L, 1e4758L, 1e4759L, 
-   1e4760L, 1e4761L, 1e4762L, 1e4763L, 1e4764L, 1e4765L, 1e4766L, 1e4767L, 1e4768L, 1e4769L, 
-   1e4770L, 1e4771L, 1e4772L, 1e4773L, 1e4774L, 1e4775L, 1e4776L, 1e4777L, 1e4778L, 1e4779L, 
-   1e4780L, 1e4781L, 1e4782L, 1e4783L, 1e4784L, 1e4785L, 1e4786L, 1e4787L, 1e4788L, 1e4789L, 
-   1e4790L, 1e4791L, 1e4792L, 1e4793L, 1e4794L, 1e4795L, 1e4796L, 1e4797L, 1e4798L, 1e4799L, 
-   1e4800L, 1e4801L, 1e4802L, 1e4803L, 1e4804L, 1e4805L, 1e4806L, 1e4807L, 1e4808L, 1e4809L, 
-   1e4810L, 1e4811L, 1e4812L, 1e4813L, 1e4814L, 1e4815L, 1e4816L, 1e4817L, 1e4818L, 1e4819L, 
-   1e4820L, 1e4821L, 1e4822L, 1e4823L, 1e4824L, 1e4825L, 1e4826L, 1e4827L, 1e4828L, 1e4829L, 
-   1e4830L, 1e4831L, 1e4832L, 1e4833L, 1e4834L, 1e4835L, 1e4836L, 1e4837L, 1e4838L, 1e4839L, 
-   1e4840L, 1e4841L, 1e4842L, 1e4843L, 1e4844L, 1e4845L, 1e4846L, 1e4847L, 1e4848L, 1e4849L, 
-   1e4850L, 1e4851L, 1e4852L, 1e4853L, 1e4854L, 1e4855L, 1e4856L, 1e4857L, 1e4858L, 1e4859L, 
-   1e4860L, 1e4861L, 1e4862L, 1e4863L, 1e4864L, 1e4865L, 1e4866L, 1e4867L, 1e4868L, 1e4869L, 
-   1e4870L, 1e4871L, 1e4872L, 1e4873L, 1e4874L, 1e4875L, 1e4876L, 1e4877L, 1e4878L, 1e4879L, 
-   1e4880L, 1e4881L, 1e4882L, 1e4883L, 1e4884L, 1e4885L, 1e4886L, 1e4887L, 1e4888L, 1e4889L, 
-   1e4890L, 1e4891L, 1e4892L, 1e4893L, 1e4894L, 1e4895L, 1e4896L, 1e4897L, 1e4898L, 1e4899L, 
-   1e4900L, 1e4901L, 1e4902L, 1e4903L, 1e4904L, 1e4905L, 1e4906L, 1e4907L, 1e4908L, 1e4909L, 
-   1e4910L, 1e4911L, 1e4912L, 1e4913L, 1e4914L, 1e4915L, 1e4916L, 1e4917L, 1e4918L, 1e4919L, 
-   1e4920L, 1e4921L, 1e4922L, 1e4923L, 1e4924L, 1e4925L, 1e4926L, 1e4927L, 1e4928L, 1e4929L, 
-   1e4930L, 1e4931L, 1e4932L
+   1e0L, 1e-56L, 1e-112L, 1e-168L, 1e-224L, 1e-280L, 1e-336L, 1e-392L, 1e-448L, 1e-504L,
+   1e-560L, 1e-616L, 1e-672L, 1e-728L, 1e-784L, 1e-840L, 1e-896L, 1e-952L, 1e-1008L, 1e-1064L,
+   1e-1120L, 1e-1176L, 1e-1232L, 1e-1288L, 1e-1344L, 1e-1400L, 1e-1456L, 1e-1512L, 1e-1568L, 1e-1624L,
+   1e-1680L, 1e-1736L, 1e-1792L, 1e-1848L, 1e-1904L, 1e-1960L, 1e-2016L, 1e-2072L, 1e-2128L, 1e-2184L,
+   1e-2240L, 1e-2296L, 1e-2352L, 1e-2408L, 1e-2464L, 1e-2520L, 1e-2576L, 1e-2632L, 1e-2688L, 1e-2744L,
+   1e-2800L, 1e-2856L, 1e-2912L, 1e-2968L, 1e-3024L, 1e-3080L, 1e-3136L, 1e-3192L, 1e-3248L, 1e-3304L,
+   1e-3360L, 1e-3416L, 1e-3472L, 1e-3528L, 1e-3584L, 1e-3640L, 1e-3696L, 1e-3752L, 1e-3808L, 1e-3864L,
+   1e-3920L, 1e-3976L, 1e-4032L, 1e-4088L, 1e-4144L, 1e-4200L, 1e-4256L, 1e-4312L, 1e-4368L, 1e-4424L,
+   1e-4480L, 1e-4536L, 1e-4592L, 1e-4648L, 1e-4704L, 1e-4760L, 1e-4816L, 1e-4872L, 1e-4928L
   };
 
-static const long double ldblnegpowersOf10[] =  /* negative powers of 10 array for long double from 0 to -4950 (min denormalised) */
+ static const float ya_s__ldbl_pow10_neg_rel[89] = /* relative rounding error of ya_s__ldbl_pow10_neg[k] as above */
   {
-   1e0L, 1e-1L, 1e-2L, 1e-3L, 1e-4L, 1e-5L, 1e-6L, 1e-7L, 1e-8L, 1e-9L, 
-   1e-10L, 1e-11L, 1e-12L, 1e-13L, 1e-14L, 1e-15L, 1e-16L, 1e-17L, 1e-18L, 1e-19L, 
-   1e-20L, 1e-21L, 1e-22L, 1e-23L, 1e-24L, 1e-25L, 1e-26L, 1e-27L, 1e-28L, 1e-29L, 
-   1e-30L, 1e-31L, 1e-32L, 1e-33L, 1e-34L, 1e-35L, 1e-36L, 1e-37L, 1e-38L, 1e-39L, 
-   1e-40L, 1e-41L, 1e-42L, 1e-43L, 1e-44L, 1e-45L, 1e-46L, 1e-47L, 1e-48L, 1e-49L, 
-   1e-50L, 1e-51L, 1e-52L, 1e-53L, 1e-54L, 1e-55L, 1e-56L, 1e-57L, 1e-58L, 1e-59L, 
-   1e-60L, 1e-61L, 1e-62L, 1e-63L, 1e-64L, 1e-65L, 1e-66L, 1e-67L, 1e-68L, 1e-69L, 
-   1e-70L, 1e-71L, 1e-72L, 1e-73L, 1e-74L, 1e-75L, 1e-76L, 1e-77L, 1e-78L, 1e-79L, 
-   1e-80L, 1e-81L, 1e-82L, 1e-83L, 1e-84L, 1e-85L, 1e-86L, 1e-87L, 1e-88L, 1e-89L, 
-   1e-90L, 1e-91L, 1e-92L, 1e-93L, 1e-94L, 1e-95L, 1e-96L, 1e-97L, 1e-98L, 1e-99L, 
-   1e-100L, 1e-101L, 1e-102L, 1e-103L, 1e-104L, 1e-105L, 1e-106L, 1e-107L, 1e-108L, 1e-109L, 
-   1e-110L, 1e-111L, 1e-112L, 1e-113L, 1e-114L, 1e-115L, 1e-116L, 1e-117L, 1e-118L, 1e-119L, 
-   1e-120L, 1e-121L, 1e-122L, 1e-123L, 1e-124L, 1e-125L, 1e-126L, 1e-127L, 1e-128L, 1e-129L, 
-   1e-130L, 1e-131L, 1e-132L, 1e-133L, 1e-134L, 1e-135L, 1e-136L, 1e-137L, 1e-138L, 1e-139L, 
-   1e-140L, 1e-141L, 1e-142L, 1e-143L, 1e-144L, 1e-145L, 1e-146L, 1e-147L, 1e-148L, 1e-149L, 
-   1e-150L, 1e-151L, 1e-152L, 1e-153L, 1e-154L, 1e-155L, 1e-156L, 1e-157L, 1e-158L, 1e-159L, 
-   1e-160L, 1e-161L, 1e-162L, 1e-163L, 1e-164L, 1e-165L, 1e-166L, 1e-167L, 1e-168L, 1e-169L, 
-   1e-170L, 1e-171L, 1e-172L, 1e-173L, 1e-174L, 1e-175L, 1e-176L, 1e-177L, 1e-178L, 1e-179L, 
-   1e-180L, 1e-181L, 1e-182L, 1e-183L, 1e-184L, 1e-185L, 1e-186L, 1e-187L, 1e-188L, 1e-189L, 
-   1e-190L, 1e-191L, 1e-192L, 1e-193L, 1e-194L, 1e-195L, 1e-196L, 1e-197L, 1e-198L, 1e-199L, 
-   1e-200L, 1e-201L, 1e-202L, 1e-203L, 1e-204L, 1e-205L, 1e-206L, 1e-207L, 1e-208L, 1e-209L, 
-   1e-210L, 1e-211L, 1e-212L, 1e-213L, 1e-214L, 1e-215L, 1e-216L, 1e-217L, 1e-218L, 1e-219L, 
-   1e-220L, 1e-221L, 1e-222L, 1e-223L, 1e-224L, 1e-225L, 1e-226L, 1e-227L, 1e-228L, 1e-229L, 
-   1e-230L, 1e-231L, 1e-232L, 1e-233L, 1e-234L, 1e-235L, 1e-236L, 1e-237L, 1e-238L, 1e-239L, 
-   1e-240L, 1e-241L, 1e-242L, 1e-243L, 1e-244L, 1e-245L, 1e-246L, 1e-247L, 1e-248L, 1e-249L, 
-   1e-250L, 1e-251L, 1e-252L, 1e-253L, 1e-254L, 1e-255L, 1e-256L, 1e-257L, 1e-258L, 1e-259L, 
-   1e-260L, 1e-261L, 1e-262L, 1e-263L, 1e-264L, 1e-265L, 1e-266L, 1e-267L, 1e-268L, 1e-269L, 
-   1e-270L, 1e-271L, 1e-272L, 1e-273L, 1e-274L, 1e-275L, 1e-276L, 1e-277L, 1e-278L, 1e-279L, 
-   1e-280L, 1e-281L, 1e-282L, 1e-283L, 1e-284L, 1e-285L, 1e-286L, 1e-287L, 1e-288L, 1e-289L, 
-   1e-290L, 1e-291L, 1e-292L, 1e-293L, 1e-294L, 1e-295L, 1e-296L, 1e-297L, 1e-298L, 1e-299L, 
-   1e-300L, 1e-301L, 1e-302L, 1e-303L, 1e-304L, 1e-305L, 1e-306L, 1e-307L, 1e-308L, 1e-309L, 
-   1e-310L, 1e-311L, 1e-312L, 1e-313L, 1e-314L, 1e-315L, 1e-316L, 1e-317L, 1e-318L, 1e-319L, 
-   1e-320L, 1e-321L, 1e-322L, 1e-323L, 1e-324L, 1e-325L, 1e-326L, 1e-327L, 1e-328L, 1e-329L, 
-   1e-330L, 1e-331L, 1e-332L, 1e-333L, 1e-334L, 1e-335L, 1e-336L, 1e-337L, 1e-338L, 1e-339L, 
-   1e-340L, 1e-341L, 1e-342L, 1e-343L, 1e-344L, 1e-345L, 1e-346L, 1e-347L, 1e-348L, 1e-349L, 
-   1e-350L, 1e-351L, 1e-352L, 1e-353L, 1e-354L, 1e-355L, 1e-356L, 1e-357L, 1e-358L, 1e-359L, 
-   1e-360L, 1e-361L, 1e-362L, 1e-363L, 1e-364L, 1e-365L, 1e-366L, 1e-367L, 1e-368L, 1e-369L, 
-   1e-370L, 1e-371L, 1e-372L, 1e-373L, 1e-374L, 1e-375L, 1e-376L, 1e-377L, 1e-378L, 1e-379L, 
-   1e-380L, 1e-381L, 1e-382L, 1e-383L, 1e-384L, 1e-385L, 1e-386L, 1e-387L, 1e-388L, 1e-389L, 
-   1e-390L, 1e-391L, 1e-392L, 1e-393L, 1e-394L, 1e-395L, 1e-396L, 1e-397L, 1e-398L, 1e-399L, 
-   1e-400L, 1e-401L, 1e-402L, 1e-403L, 1e-404L, 1e-405L, 1e-406L, 1e-407L, 1e-408L, 1e-409L, 
-   1e-410L, 1e-411L, 1e-412L, 1e-413L, 1e-414L, 1e-415L, 1e-416L, 1e-417L, 1e-418L, 1e-419L, 
-   1e-420L, 1e-421L, 1e-422L, 1e-423L, 1e-424L, 1e-425L, 1e-426L, 1e-427L, 1e-428L, 1e-429L, 
-   1e-430L, 1e-431L, 1e-432L, 1e-433L, 1e-434L, 1e-435L, 1e-436L, 1e-437L, 1e-438L, 1e-439L, 
-   1e-440L, 1e-441L, 1e-442L, 1e-443L, 1e-444L, 1e-445L, 1e-446L, 1e-447L, 1e-448L, 1e-449L, 
-   1e-450L, 1e-451L, 1e-452L, 1e-453L, 1e-454L, 1e-455L, 1e-456L, 1e-457L, 1e-458L, 1e-459L, 
-   1e-460L, 1e-461L, 1e-462L, 1e-463L, 1e-464L, 1e-465L, 1e-466L, 1e-467L, 1e-468L, 1e-469L, 
-   1e-470L, 1e-471L, 1e-472L, 1e-473L, 1e-474L, 1e-475L, 1e-476L, 1e-477L, 1e-478L, 1e-479L, 
-   1e-480L, 1e-481L, 1e-482L, 1e-483L, 1e-484L, 1e-485L, 1e-486L, 1e-487L, 1e-488L, 1e-489L, 
-   1e-490L, 1e-491L, 1e-492L, 1e-493L, 1e-494L, 1e-495L, 1e-496L, 1e-497L, 1e-498L, 1e-499L, 
-   1e-500L, 1e-501L, 1e-502L, 1e-503L, 1e-504L, 1e-505L, 1e-506L, 1e-507L, 1e-508L, 1e-509L, 
-   1e-510L, 1e-511L, 1e-512L, 1e-513L, 1e-514L, 1e-515L, 1e-516L, 1e-517L, 1e-518L, 1e-519L, 
-   1e-520L, 1e-521L, 1e-522L, 1e-523L, 1e-524L, 1e-525L, 1e-526L, 1e-527L, 1e-528L, 1e-529L, 
-   1e-530L, 1e-531L, 1e-532L, 1e-533L, 1e-534L, 1e-535L, 1e-536L, 1e-537L, 1e-538L, 1e-539L, 
-   1e-540L, 1e-541L, 1e-542L, 1e-543L, 1e-544L, 1e-545L, 1e-546L, 1e-547L, 1e-548L, 1e-549L, 
-   1e-550L, 1e-551L, 1e-552L, 1e-553L, 1e-554L, 1e-555L, 1e-556L, 1e-557L, 1e-558L, 1e-559L, 
-   1e-560L, 1e-561L, 1e-562L, 1e-563L, 1e-564L, 1e-565L, 1e-566L, 1e-567L, 1e-568L, 1e-569L, 
-   1e-570L, 1e-571L, 1e-572L, 1e-573L, 1e-574L, 1e-575L, 1e-576L, 1e-577L, 1e-578L, 1e-579L, 
-   1e-580L, 1e-581L, 1e-582L, 1e-583L, 1e-584L, 1e-585L, 1e-586L, 1e-587L, 1e-588L, 1e-589L, 
-   1e-590L, 1e-591L, 1e-592L, 1e-593L, 1e-594L, 1e-595L, 1e-596L, 1e-597L, 1e-598L, 1e-599L, 
-   1e-600L, 1e-601L, 1e-602L, 1e-603L, 1e-604L, 1e-605L, 1e-606L, 1e-607L, 1e-608L, 1e-609L, 
-   1e-610L, 1e-611L, 1e-612L, 1e-613L, 1e-614L, 1e-615L, 1e-616L, 1e-617L, 1e-618L, 1e-619L, 
-   1e-620L, 1e-621L, 1e-622L, 1e-623L, 1e-624L, 1e-625L, 1e-626L, 1e-627L, 1e-628L, 1e-629L, 
-   1e-630L, 1e-631L, 1e-632L, 1e-633L, 1e-634L, 1e-635L, 1e-636L, 1e-637L, 1e-638L, 1e-639L, 
-   1e-640L, 1e-641L, 1e-642L, 1e-643L, 1e-644L, 1e-645L, 1e-646L, 1e-647L, 1e-648L, 1e-649L, 
-   1e-650L, 1e-651L, 1e-652L, 1e-653L, 1e-654L, 1e-655L, 1e-656L, 1e-657L, 1e-658L, 1e-659L, 
-   1e-660L, 1e-661L, 1e-662L, 1e-663L, 1e-664L, 1e-665L, 1e-666L, 1e-667L, 1e-668L, 1e-669L, 
-   1e-670L, 1e-671L, 1e-672L, 1e-673L, 1e-674L, 1e-675L, 1e-676L, 1e-677L, 1e-678L, 1e-679L, 
-   1e-680L, 1e-681L, 1e-682L, 1e-683L, 1e-684L, 1e-685L, 1e-686L, 1e-687L, 1e-688L, 1e-689L, 
-   1e-690L, 1e-691L, 1e-692L, 1e-693L, 1e-694L, 1e-695L, 1e-696L, 1e-697L, 1e-698L, 1e-699L, 
-   1e-700L, 1e-701L, 1e-702L, 1e-703L, 1e-704L, 1e-705L, 1e-706L, 1e-707L, 1e-708L, 1e-709L, 
-   1e-710L, 1e-711L, 1e-712L, 1e-713L, 1e-714L, 1e-715L, 1e-716L, 1e-717L, 1e-718L, 1e-719L, 
-   1e-720L, 1e-721L, 1e-722L, 1e-723L, 1e-724L, 1e-725L, 1e-726L, 1e-727L, 1e-728L, 1e-729L, 
-   1e-730L, 1e-731L, 1e-732L, 1e-733L, 1e-734L, 1e-735L, 1e-736L, 1e-737L, 1e-738L, 1e-739L, 
-   1e-740L, 1e-741L, 1e-742L, 1e-743L, 1e-744L, 1e-745L, 1e-746L, 1e-747L, 1e-748L, 1e-749L, 
-   1e-750L, 1e-751L, 1e-752L, 1e-753L, 1e-754L, 1e-755L, 1e-756L, 1e-757L, 1e-758L, 1e-759L, 
-   1e-760L, 1e-761L, 1e-762L, 1e-763L, 1e-764L, 1e-765L, 1e-766L, 1e-767L, 1e-768L, 1e-769L, 
-   1e-770L, 1e-771L, 1e-772L, 1e-773L, 1e-774L, 1e-775L, 1e-776L, 1e-777L, 1e-778L, 1e-779L, 
-   1e-780L, 1e-781L, 1e-782L, 1e-783L, 1e-784L, 1e-785L, 1e-786L, 1e-787L, 1e-788L, 1e-789L, 
-   1e-790L, 1e-791L, 1e-792L, 1e-793L, 1e-794L, 1e-795L, 1e-796L, 1e-797L, 1e-798L, 1e-799L, 
-   1e-800L, 1e-801L, 1e-802L, 1e-803L, 1e-804L, 1e-805L, 1e-806L, 1e-807L, 1e-808L, 1e-809L, 
-   1e-810L, 1e-811L, 1e-812L, 1e-813L, 1e-814L, 1e-815L, 1e-816L, 1e-817L, 1e-818L, 1e-819L, 
-   1e-820L, 1e-821L, 1e-822L, 1e-823L, 1e-824L, 1e-825L, 1e-826L, 1e-827L, 1e-828L, 1e-829L, 
-   1e-830L, 1e-831L, 1e-832L, 1e-833L, 1e-834L, 1e-835L, 1e-836L, 1e-837L, 1e-838L, 1e-839L, 
-   1e-840L, 1e-841L, 1e-842L, 1e-843L, 1e-844L, 1e-845L, 1e-846L, 1e-847L, 1e-848L, 1e-849L, 
-   1e-850L, 1e-851L, 1e-852L, 1e-853L, 1e-854L, 1e-855L, 1e-856L, 1e-857L, 1e-858L, 1e-859L, 
-   1e-860L, 1e-861L, 1e-862L, 1e-863L, 1e-864L, 1e-865L, 1e-866L, 1e-867L, 1e-868L, 1e-869L, 
-   1e-870L, 1e-871L, 1e-872L, 1e-873L, 1e-874L, 1e-875L, 1e-876L, 1e-877L, 1e-878L, 1e-879L, 
-   1e-880L, 1e-881L, 1e-882L, 1e-883L, 1e-884L, 1e-885L, 1e-886L, 1e-887L, 1e-888L, 1e-889L, 
-   1e-890L, 1e-891L, 1e-892L, 1e-893L, 1e-894L, 1e-895L, 1e-896L, 1e-897L, 1e-898L, 1e-899L, 
-   1e-900L, 1e-901L, 1e-902L, 1e-903L, 1e-904L, 1e-905L, 1e-906L, 1e-907L, 1e-908L, 1e-909L, 
-   1e-910L, 1e-911L, 1e-912L, 1e-913L, 1e-914L, 1e-915L, 1e-916L, 1e-917L, 1e-918L, 1e-919L, 
-   1e-920L, 1e-921L, 1e-922L, 1e-923L, 1e-924L, 1e-925L, 1e-926L, 1e-927L, 1e-928L, 1e-929L, 
-   1e-930L, 1e-931L, 1e-932L, 1e-933L, 1e-934L, 1e-935L, 1e-936L, 1e-937L, 1e-938L, 1e-939L, 
-   1e-940L, 1e-941L, 1e-942L, 1e-943L, 1e-944L, 1e-945L, 1e-946L, 1e-947L, 1e-948L, 1e-949L, 
-   1e-950L, 1e-951L, 1e-952L, 1e-953L, 1e-954L, 1e-955L, 1e-956L, 1e-957L, 1e-958L, 1e-959L, 
-   1e-960L, 1e-961L, 1e-962L, 1e-963L, 1e-964L, 1e-965L, 1e-966L, 1e-967L, 1e-968L, 1e-969L, 
-   1e-970L, 1e-971L, 1e-972L, 1e-973L, 1e-974L, 1e-975L, 1e-976L, 1e-977L, 1e-978L, 1e-979L, 
-   1e-980L, 1e-981L, 1e-982L, 1e-983L, 1e-984L, 1e-985L, 1e-986L, 1e-987L, 1e-988L, 1e-989L, 
-   1e-990L, 1e-991L, 1e-992L, 1e-993L, 1e-994L, 1e-995L, 1e-996L, 1e-997L, 1e-998L, 1e-999L, 
-   1e-1000L, 1e-1001L, 1e-1002L, 1e-1003L, 1e-1004L, 1e-1005L, 1e-1006L, 1e-1007L, 1e-1008L, 1e-1009L, 
-   1e-1010L, 1e-1011L, 1e-1012L, 1e-1013L, 1e-1014L, 1e-1015L, 1e-1016L, 1e-1017L, 1e-1018L, 1e-1019L, 
-   1e-1020L, 1e-1021L, 1e-1022L, 1e-1023L, 1e-1024L, 1e-1025L, 1e-1026L, 1e-1027L, 1e-1028L, 1e-1029L, 
-   1e-1030L, 1e-1031L, 1e-1032L, 1e-1033L, 1e-1034L, 1e-1035L, 1e-1036L, 1e-1037L, 1e-1038L, 1e-1039L, 
-   1e-1040L, 1e-1041L, 1e-1042L, 1e-1043L, 1e-1044L, 1e-1045L, 1e-1046L, 1e-1047L, 1e-1048L, 1e-1049L, 
-   1e-1050L, 1e-1051L, 1e-1052L, 1e-1053L, 1e-1054L, 1e-1055L, 1e-1056L, 1e-1057L, 1e-1058L, 1e-1059L, 
-   1e-1060L, 1e-1061L, 1e-1062L, 1e-1063L, 1e-1064L, 1e-1065L, 1e-1066L, 1e-1067L, 1e-1068L, 1e-1069L, 
-   1e-1070L, 1e-1071L, 1e-1072L, 1e-1073L, 1e-1074L, 1e-1075L, 1e-1076L, 1e-1077L, 1e-1078L, 1e-1079L, 
-   1e-1080L, 1e-1081L, 1e-1082L, 1e-1083L, 1e-1084L, 1e-1085L, 1e-1086L, 1e-1087L, 1e-1088L, 1e-1089L, 
-   1e-1090L, 1e-1091L, 1e-1092L, 1e-1093L, 1e-1094L, 1e-1095L, 1e-1096L, 1e-1097L, 1e-1098L, 1e-1099L, 
-   1e-1100L, 1e-1101L, 1e-1102L, 1e-1103L, 1e-1104L, 1e-1105L, 1e-1106L, 1e-1107L, 1e-1108L, 1e-1109L, 
-   1e-1110L, 1e-1111L, 1e-1112L, 1e-1113L, 1e-1114L, 1e-1115L, 1e-1116L, 1e-1117L, 1e-1118L, 1e-1119L, 
-   1e-1120L, 1e-1121L, 1e-1122L, 1e-1123L, 1e-1124L, 1e-1125L, 1e-1126L, 1e-1127L, 1e-1128L, 1e-1129L, 
-   1e-1130L, 1e-1131L, 1e-1132L, 1e-1133L, 1e-1134L, 1e-1135L, 1e-1136L, 1e-1137L, 1e-1138L, 1e-1139L, 
-   1e-1140L, 1e-1141L, 1e-1142L, 1e-1143L, 1e-1144L, 1e-1145L, 1e-1146L, 1e-1147L, 1e-1148L, 1e-1149L, 
-   1e-1150L, 1e-1151L, 1e-1152L, 1e-1153L, 1e-1154L, 1e-1155L, 1e-1156L, 1e-1157L, 1e-1158L, 1e-1159L, 
-   1e-1160L, 1e-1161L, 1e-1162L, 1e-1163L, 1e-1164L, 1e-1165L, 1e-1166L, 1e-1167L, 1e-1168L, 1e-1169L, 
-   1e-1170L, 1e-1171L, 1e-1172L, 1e-1173L, 1e-1174L, 1e-1175L, 1e-1176L, 1e-1177L, 1e-1178L, 1e-1179L, 
-   1e-1180L, 1e-1181L, 1e-1182L, 1e-1183L, 1e-1184L, 1e-1185L, 1e-1186L, 1e-1187L, 1e-1188L, 1e-1189L, 
-   1e-1190L, 1e-1191L, 1e-1192L, 1e-1193L, 1e-1194L, 1e-1195L, 1e-1196L, 1e-1197L, 1e-1198L, 1e-1199L, 
-   1e-1200L, 1e-1201L, 1e-1202L, 1e-1203L, 1e-1204L, 1e-1205L, 1e-1206L, 1e-1207L, 1e-1208L, 1e-1209L, 
-   1e-1210L, 1e-1211L, 1e-1212L, 1e-1213L, 1e-1214L, 1e-1215L, 1e-1216L, 1e-1217L, 1e-1218L, 1e-1219L, 
-   1e-1220L, 1e-1221L, 1e-1222L, 1e-1223L, 1e-1224L, 1e-1225L, 1e-1226L, 1e-1227L, 1e-1228L, 1e-1229L, 
-   1e-1230L, 1e-1231L, 1e-1232L, 1e-1233L, 1e-1234L, 1e-1235L, 1e-1236L, 1e-1237L, 1e-1238L, 1e-1239L, 
-   1e-1240L, 1e-1241L, 1e-1242L, 1e-1243L, 1e-1244L, 1e-1245L, 1e-1246L, 1e-1247L, 1e-1248L, 1e-1249L, 
-   1e-1250L, 1e-1251L, 1e-1252L, 1e-1253L, 1e-1254L, 1e-1255L, 1e-1256L, 1e-1257L, 1e-1258L, 1e-1259L, 
-   1e-1260L, 1e-1261L, 1e-1262L, 1e-1263L, 1e-1264L, 1e-1265L, 1e-1266L, 1e-1267L, 1e-1268L, 1e-1269L, 
-   1e-1270L, 1e-1271L, 1e-1272L, 1e-1273L, 1e-1274L, 1e-1275L, 1e-1276L, 1e-1277L, 1e-1278L, 1e-1279L, 
-   1e-1280L, 1e-1281L, 1e-1282L, 1e-1283L, 1e-1284L, 1e-1285L, 1e-1286L, 1e-1287L, 1e-1288L, 1e-1289L, 
-   1e-1290L, 1e-1291L, 1e-1292L, 1e-1293L, 1e-1294L, 1e-1295L, 1e-1296L, 1e-1297L, 1e-1298L, 1e-1299L, 
-   1e-1300L, 1e-1301L, 1e-1302L, 1e-1303L, 1e-1304L, 1e-1305L, 1e-1306L, 1e-1307L, 1e-1308L, 1e-1309L, 
-   1e-1310L, 1e-1311L, 1e-1312L, 1e-1313L, 1e-1314L, 1e-1315L, 1e-1316L, 1e-1317L, 1e-1318L, 1e-1319L, 
-   1e-1320L, 1e-1321L, 1e-1322L, 1e-1323L, 1e-1324L, 1e-1325L, 1e-1326L, 1e-1327L, 1e-1328L, 1e-1329L, 
-   1e-1330L, 1e-1331L, 1e-1332L, 1e-1333L, 1e-1334L, 1e-1335L, 1e-1336L, 1e-1337L, 1e-1338L, 1e-1339L, 
-   1e-1340L, 1e-1341L, 1e-1342L, 1e-1343L, 1e-1344L, 1e-1345L, 1e-1346L, 1e-1347L, 1e-1348L, 1e-1349L, 
-   1e-1350L, 1e-1351L, 1e-1352L, 1e-1353L, 1e-1354L, 1e-1355L, 1e-1356L, 1e-1357L, 1e-1358L, 1e-1359L, 
-   1e-1360L, 1e-1361L, 1e-1362L, 1e-1363L, 1e-1364L, 1e-1365L, 1e-1366L, 1e-1367L, 1e-1368L, 1e-1369L, 
-   1e-1370L, 1e-1371L, 1e-1372L, 1e-1373L, 1e-1374L, 1e-1375L, 1e-1376L, 1e-1377L, 1e-1378L, 1e-1379L, 
-   1e-1380L, 1e-1381L, 1e-1382L, 1e-1383L, 1e-1384L, 1e-1385L, 1e-1386L, 1e-1387L, 1e-1388L, 1e-1389L, 
-   1e-1390L, 1e-1391L, 1e-1392L, 1e-1393L, 1e-1394L, 1e-1395L, 1e-1396L, 1e-1397L, 1e-1398L, 1e-1399L, 
-   1e-1400L, 1e-1401L, 1e-1402L, 1e-1403L, 1e-1404L, 1e-1405L, 1e-1406L, 1e-1407L, 1e-1408L, 1e-1409L, 
-   1e-1410L, 1e-1411L, 1e-1412L, 1e-1413L, 1e-1414L, 1e-1415L, 1e-1416L, 1e-1417L, 1e-1418L, 1e-1419L, 
-   1e-1420L, 1e-1421L, 1e-1422L, 1e-1423L, 1e-1424L, 1e-1425L, 1e-1426L, 1e-1427L, 1e-1428L, 1e-1429L, 
-   1e-1430L, 1e-1431L, 1e-1432L, 1e-1433L, 1e-1434L, 1e-1435L, 1e-1436L, 1e-1437L, 1e-1438L, 1e-1439L, 
-   1e-1440L, 1e-1441L, 1e-1442L, 1e-1443L, 1e-1444L, 1e-1445L, 1e-1446L, 1e-1447L, 1e-1448L, 1e-1449L, 
-   1e-1450L, 1e-1451L, 1e-1452L, 1e-1453L, 1e-1454L, 1e-1455L, 1e-1456L, 1e-1457L, 1e-1458L, 1e-1459L, 
-   1e-1460L, 1e-1461L, 1e-1462L, 1e-1463L, 1e-1464L, 1e-1465L, 1e-1466L, 1e-1467L, 1e-1468L, 1e-1469L, 
-   1e-1470L, 1e-1471L, 1e-1472L, 1e-1473L, 1e-1474L, 1e-1475L, 1e-1476L, 1e-1477L, 1e-1478L, 1e-1479L, 
-   1e-1480L, 1e-1481L, 1e-1482L, 1e-1483L, 1e-1484L, 1e-1485L, 1e-1486L, 1e-1487L, 1e-1488L, 1e-1489L, 
-   1e-1490L, 1e-1491L, 1e-1492L, 1e-1493L, 1e-1494L, 1e-1495L, 1e-1496L, 1e-1497L, 1e-1498L, 1e-1499L, 
-   1e-1500L, 1e-1501L, 1e-1502L, 1e-1503L, 1e-1504L, 1e-1505L, 1e-1506L, 1e-1507L, 1e-1508L, 1e-1509L, 
-   1e-1510L, 1e-1511L, 1e-1512L, 1e-1513L, 1e-1514L, 1e-1515L, 1e-1516L, 1e-1517L, 1e-1518L, 1e-1519L, 
-   1e-1520L, 1e-1521L, 1e-1522L, 1e-1523L, 1e-1524L, 1e-1525L, 1e-1526L, 1e-1527L, 1e-1528L, 1e-1529L, 
-   1e-1530L, 1e-1531L, 1e-1532L, 1e-1533L, 1e-1534L, 1e-1535L, 1e-1536L, 1e-1537L, 1e-1538L, 1e-1539L, 
-   1e-1540L, 1e-1541L, 1e-1542L, 1e-1543L, 1e-1544L, 1e-1545L, 1e-1546L, 1e-1547L, 1e-1548L, 1e-1549L, 
-   1e-1550L, 1e-1551L, 1e-1552L, 1e-1553L, 1e-1554L, 1e-1555L, 1e-1556L, 1e-1557L, 1e-1558L, 1e-1559L, 
-   1e-1560L, 1e-1561L, 1e-1562L, 1e-1563L, 1e-1564L, 1e-1565L, 1e-1566L, 1e-1567L, 1e-1568L, 1e-1569L, 
-   1e-1570L, 1e-1571L, 1e-1572L, 1e-1573L, 1e-1574L, 1e-1575L, 1e-1576L, 1e-1577L, 1e-1578L, 1e-1579L, 
-   1e-1580L, 1e-1581L, 1e-1582L, 1e-1583L, 1e-1584L, 1e-1585L, 1e-1586L, 1e-1587L, 1e-1588L, 1e-1589L, 
-   1e-1590L, 1e-1591L, 1e-1592L, 1e-1593L, 1e-1594L, 1e-1595L, 1e-1596L, 1e-1597L, 1e-1598L, 1e-1599L, 
-   1e-1600L, 1e-1601L, 1e-1602L, 1e-1603L, 1e-1604L, 1e-1605L, 1e-1606L, 1e-1607L, 1e-1608L, 1e-1609L, 
-   1e-1610L, 1e-1611L, 1e-1612L, 1e-1613L, 1e-1614L, 1e-1615L, 1e-1616L, 1e-1617L, 1e-1618L, 1e-1619L, 
-   1e-1620L, 1e-1621L, 1e-1622L, 1e-1623L, 1e-1624L, 1e-1625L, 1e-1626L, 1e-1627L, 1e-1628L, 1e-1629L, 
-   1e-1630L, 1e-1631L, 1e-1632L, 1e-1633L, 1e-1634L, 1e-1635L, 1e-1636L, 1e-1637L, 1e-1638L, 1e-1639L, 
-   1e-1640L, 1e-1641L, 1e-1642L, 1e-1643L, 1e-1644L, 1e-1645L, 1e-1646L, 1e-1647L, 1e-1648L, 1e-1649L, 
-   1e-1650L, 1e-1651L, 1e-1652L, 1e-1653L, 1e-1654L, 1e-1655L, 1e-1656L, 1e-1657L, 1e-1658L, 1e-1659L, 
-   1e-1660L, 1e-1661L, 1e-1662L, 1e-1663L, 1e-1664L, 1e-1665L, 1e-1666L, 1e-1667L, 1e-1668L, 1e-1669L, 
-   1e-1670L, 1e-1671L, 1e-1672L, 1e-1673L, 1e-1674L, 1e-1675L, 1e-1676L, 1e-1677L, 1e-1678L, 1e-1679L, 
-   1e-1680L, 1e-1681L, 1e-1682L, 1e-1683L, 1e-1684L, 1e-1685L, 1e-1686L, 1e-1687L, 1e-1688L, 1e-1689L, 
-   1e-1690L, 1e-1691L, 1e-1692L, 1e-1693L, 1e-1694L, 1e-1695L, 1e-1696L, 1e-1697L, 1e-1698L, 1e-1699L, 
-   1e-1700L, 1e-1701L, 1e-1702L, 1e-1703L, 1e-1704L, 1e-1705L, 1e-1706L, 1e-1707L, 1e-1708L, 1e-1709L, 
-   1e-1710L, 1e-1711L, 1e-1712L, 1e-1713L, 1e-1714L, 1e-1715L, 1e-1716L, 1e-1717L, 1e-1718L, 1e-1719L, 
-   1e-1720L, 1e-1721L, 1e-1722L, 1e-1723L, 1e-1724L, 1e-1725L, 1e-1726L, 1e-1727L, 1e-1728L, 1e-1729L, 
-   1e-1730L, 1e-1731L, 1e-1732L, 1e-1733L, 1e-1734L, 1e-1735L, 1e-1736L, 1e-1737L, 1e-1738L, 1e-1739L, 
-   1e-1740L, 1e-1741L, 1e-1742L, 1e-1743L, 1e-1744L, 1e-1745L, 1e-1746L, 1e-1747L, 1e-1748L, 1e-1749L, 
-   1e-1750L, 1e-1751L, 1e-1752L, 1e-1753L, 1e-1754L, 1e-1755L, 1e-1756L, 1e-1757L, 1e-1758L, 1e-1759L, 
-   1e-1760L, 1e-1761L, 1e-1762L, 1e-1763L, 1e-1764L, 1e-1765L, 1e-1766L, 1e-1767L, 1e-1768L, 1e-1769L, 
-   1e-1770L, 1e-1771L, 1e-1772L, 1e-1773L, 1e-1774L, 1e-1775L, 1e-1776L, 1e-1777L, 1e-1778L, 1e-1779L, 
-   1e-1780L, 1e-1781L, 1e-1782L, 1e-1783L, 1e-1784L, 1e-1785L, 1e-1786L, 1e-1787L, 1e-1788L, 1e-1789L, 
-   1e-1790L, 1e-1791L, 1e-1792L, 1e-1793L, 1e-1794L, 1e-1795L, 1e-1796L, 1e-1797L, 1e-1798L, 1e-1799L, 
-   1e-1800L, 1e-1801L, 1e-1802L, 1e-1803L, 1e-1804L, 1e-1805L, 1e-1806L, 1e-1807L, 1e-1808L, 1e-1809L, 
-   1e-1810L, 1e-1811L, 1e-1812L, 1e-1813L, 1e-1814L, 1e-1815L, 1e-1816L, 1e-1817L, 1e-1818L, 1e-1819L, 
-   1e-1820L, 1e-1821L, 1e-1822L, 1e-1823L, 1e-1824L, 1e-1825L, 1e-1826L, 1e-1827L, 1e-1828L, 1e-1829L, 
-   1e-1830L, 1e-1831L, 1e-1832L, 1e-1833L, 1e-1834L, 1e-1835L, 1e-1836L, 1e-1837L, 1e-1838L, 1e-1839L, 
-   1e-1840L, 1e-1841L, 1e-1842L, 1e-1843L, 1e-1844L, 1e-1845L, 1e-1846L, 1e-1847L, 1e-1848L, 1e-1849L, 
-   1e-1850L, 1e-1851L, 1e-1852L, 1e-1853L, 1e-1854L, 1e-1855L, 1e-1856L, 1e-1857L, 1e-1858L, 1e-1859L, 
-   1e-1860L, 1e-1861L, 1e-1862L, 1e-1863L, 1e-1864L, 1e-1865L, 1e-1866L, 1e-1867L, 1e-1868L, 1e-1869L, 
-   1e-1870L, 1e-1871L, 1e-1872L, 1e-1873L, 1e-1874L, 1e-1875L, 1e-1876L, 1e-1877L, 1e-1878L, 1e-1879L, 
-   1e-1880L, 1e-1881L, 1e-1882L, 1e-1883L, 1e-1884L, 1e-1885L, 1e-1886L, 1e-1887L, 1e-1888L, 1e-1889L, 
-   1e-1890L, 1e-1891L, 1e-1892L, 1e-1893L, 1e-1894L, 1e-1895L, 1e-1896L, 1e-1897L, 1e-1898L, 1e-1899L, 
-   1e-1900L, 1e-1901L, 1e-1902L, 1e-1903L, 1e-1904L, 1e-1905L, 1e-1906L, 1e-1907L, 1e-1908L, 1e-1909L, 
-   1e-1910L, 1e-1911L, 1e-1912L, 1e-1913L, 1e-1914L, 1e-1915L, 1e-1916L, 1e-1917L, 1e-1918L, 1e-1919L, 
-   1e-1920L, 1e-1921L, 1e-1922L, 1e-1923L, 1e-1924L, 1e-1925L, 1e-1926L, 1e-1927L, 1e-1928L, 1e-1929L, 
-   1e-1930L, 1e-1931L, 1e-1932L, 1e-1933L, 1e-1934L, 1e-1935L, 1e-1936L, 1e-1937L, 1e-1938L, 1e-1939L, 
-   1e-1940L, 1e-1941L, 1e-1942L, 1e-1943L, 1e-1944L, 1e-1945L, 1e-1946L, 1e-1947L, 1e-1948L, 1e-1949L, 
-   1e-1950L, 1e-1951L, 1e-1952L, 1e-1953L, 1e-1954L, 1e-1955L, 1e-1956L, 1e-1957L, 1e-1958L, 1e-1959L, 
-   1e-1960L, 1e-1961L, 1e-1962L, 1e-1963L, 1e-1964L, 1e-1965L, 1e-1966L, 1e-1967L, 1e-1968L, 1e-1969L, 
-   1e-1970L, 1e-1971L, 1e-1972L, 1e-1973L, 1e-1974L, 1e-1975L, 1e-1976L, 1e-1977L, 1e-1978L, 1e-1979L, 
-   1e-1980L, 1e-1981L, 1e-1982L, 1e-1983L, 1e-1984L, 1e-1985L, 1e-1986L, 1e-1987L, 1e-1988L, 1e-1989L, 
-   1e-1990L, 1e-1991L, 1e-1992L, 1e-1993L, 1e-1994L, 1e-1995L, 1e-1996L, 1e-1997L, 1e-1998L, 1e-1999L, 
-   1e-2000L, 1e-2001L, 1e-2002L, 1e-2003L, 1e-2004L, 1e-2005L, 1e-2006L, 1e-2007L, 1e-2008L, 1e-2009L, 
-   1e-2010L, 1e-2011L, 1e-2012L, 1e-2013L, 1e-2014L, 1e-2015L, 1e-2016L, 1e-2017L, 1e-2018L, 1e-2019L, 
-   1e-2020L, 1e-2021L, 1e-2022L, 1e-2023L, 1e-2024L, 1e-2025L, 1e-2026L, 1e-2027L, 1e-2028L, 1e-2029L, 
-   1e-2030L, 1e-2031L, 1e-2032L, 1e-2033L, 1e-2034L, 1e-2035L, 1e-2036L, 1e-2037L, 1e-2038L, 1e-2039L, 
-   1e-2040L, 1e-2041L, 1e-2042L, 1e-2043L, 1e-2044L, 1e-2045L, 1e-2046L, 1e-2047L, 1e-2048L, 1e-2049L, 
-   1e-2050L, 1e-2051L, 1e-2052L, 1e-2053L, 1e-2054L, 1e-2055L, 1e-2056L, 1e-2057L, 1e-2058L, 1e-2059L, 
-   1e-2060L, 1e-2061L, 1e-2062L, 1e-2063L, 1e-2064L, 1e-2065L, 1e-2066L, 1e-2067L, 1e-2068L, 1e-2069L, 
-   1e-2070L, 1e-2071L, 1e-2072L, 1e-2073L, 1e-2074L, 1e-2075L, 1e-2076L, 1e-2077L, 1e-2078L, 1e-2079L, 
-   1e-2080L, 1e-2081L, 1e-2082L, 1e-2083L, 1e-2084L, 1e-2085L, 1e-2086L, 1e-2087L, 1e-2088L, 1e-2089L, 
-   1e-2090L, 1e-2091L, 1e-2092L, 1e-2093L, 1e-2094L, 1e-2095L, 1e-2096L, 1e-2097L, 1e-2098L, 1e-2099L, 
-   1e-2100L, 1e-2101L, 1e-2102L, 1e-2103L, 1e-2104L, 1e-2105L, 1e-2106L, 1e-2107L, 1e-2108L, 1e-2109L, 
-   1e-2110L, 1e-2111L, 1e-2112L, 1e-2113L, 1e-2114L, 1e-2115L, 1e-2116L, 1e-2117L, 1e-2118L, 1e-2119L, 
-   1e-2120L, 1e-2121L, 1e-2122L, 1e-2123L, 1e-2124L, 1e-2125L, 1e-2126L, 1e-2127L, 1e-2128L, 1e-2129L, 
-   1e-2130L, 1e-2131L, 1e-2132L, 1e-2133L, 1e-2134L, 1e-2135L, 1e-2136L, 1e-2137L, 1e-2138L, 1e-2139L, 
-   1e-2140L, 1e-2141L, 1e-2142L, 1e-2143L, 1e-2144L, 1e-2145L, 1e-2146L, 1e-2147L, 1e-2148L, 1e-2149L, 
-   1e-2150L, 1e-2151L, 1e-2152L, 1e-2153L, 1e-2154L, 1e-2155L, 1e-2156L, 1e-2157L, 1e-2158L, 1e-2159L, 
-   1e-2160L, 1e-2161L, 1e-2162L, 1e-2163L, 1e-2164L, 1e-2165L, 1e-2166L, 1e-2167L, 1e-2168L, 1e-2169L, 
-   1e-2170L, 1e-2171L, 1e-2172L, 1e-2173L, 1e-2174L, 1e-2175L, 1e-2176L, 1e-2177L, 1e-2178L, 1e-2179L, 
-   1e-2180L, 1e-2181L, 1e-2182L, 1e-2183L, 1e-2184L, 1e-2185L, 1e-2186L, 1e-2187L, 1e-2188L, 1e-2189L, 
-   1e-2190L, 1e-2191L, 1e-2192L, 1e-2193L, 1e-2194L, 1e-2195L, 1e-2196L, 1e-2197L, 1e-2198L, 1e-2199L, 
-   1e-2200L, 1e-2201L, 1e-2202L, 1e-2203L, 1e-2204L, 1e-2205L, 1e-2206L, 1e-2207L, 1e-2208L, 1e-2209L, 
-   1e-2210L, 1e-2211L, 1e-2212L, 1e-2213L, 1e-2214L, 1e-2215L, 1e-2216L, 1e-2217L, 1e-2218L, 1e-2219L, 
-   1e-2220L, 1e-2221L, 1e-2222L, 1e-2223L, 1e-2224L, 1e-2225L, 1e-2226L, 1e-2227L, 1e-2228L, 1e-2229L, 
-   1e-2230L, 1e-2231L, 1e-2232L, 1e-2233L, 1e-2234L, 1e-2235L, 1e-2236L, 1e-2237L, 1e-2238L, 1e-2239L, 
-   1e-2240L, 1e-2241L, 1e-2242L, 1e-2243L, 1e-2244L, 1e-2245L, 1e-2246L, 1e-2247L, 1e-2248L, 1e-2249L, 
-   1e-2250L, 1e-2251L, 1e-2252L, 1e-2253L, 1e-2254L, 1e-2255L, 1e-2256L, 1e-2257L, 1e-2258L, 1e-2259L, 
-   1e-2260L, 1e-2261L, 1e-2262L, 1e-2263L, 1e-2264L, 1e-2265L, 1e-2266L, 1e-2267L, 1e-2268L, 1e-2269L, 
-   1e-2270L, 1e-2271L, 1e-2272L, 1e-2273L, 1e-2274L, 1e-2275L, 1e-2276L, 1e-2277L, 1e-2278L, 1e-2279L, 
-   1e-2280L, 1e-2281L, 1e-2282L, 1e-2283L, 1e-2284L, 1e-2285L, 1e-2286L, 1e-2287L, 1e-2288L, 1e-2289L, 
-   1e-2290L, 1e-2291L, 1e-2292L, 1e-2293L, 1e-2294L, 1e-2295L, 1e-2296L, 1e-2297L, 1e-2298L, 1e-2299L, 
-   1e-2300L, 1e-2301L, 1e-2302L, 1e-2303L, 1e-2304L, 1e-2305L, 1e-2306L, 1e-2307L, 1e-2308L, 1e-2309L, 
-   1e-2310L, 1e-2311L, 1e-2312L, 1e-2313L, 1e-2314L, 1e-2315L, 1e-2316L, 1e-2317L, 1e-2318L, 1e-2319L, 
-   1e-2320L, 1e-2321L, 1e-2322L, 1e-2323L, 1e-2324L, 1e-2325L, 1e-2326L, 1e-2327L, 1e-2328L, 1e-2329L, 
-   1e-2330L, 1e-2331L, 1e-2332L, 1e-2333L, 1e-2334L, 1e-2335L, 1e-2336L, 1e-2337L, 1e-2338L, 1e-2339L, 
-   1e-2340L, 1e-2341L, 1e-2342L, 1e-2343L, 1e-2344L, 1e-2345L, 1e-2346L, 1e-2347L, 1e-2348L, 1e-2349L, 
-   1e-2350L, 1e-2351L, 1e-2352L, 1e-2353L, 1e-2354L, 1e-2355L, 1e-2356L, 1e-2357L, 1e-2358L, 1e-2359L, 
-   1e-2360L, 1e-2361L, 1e-2362L, 1e-2363L, 1e-2364L, 1e-2365L, 1e-2366L, 1e-2367L, 1e-2368L, 1e-2369L, 
-   1e-2370L, 1e-2371L, 1e-2372L, 1e-2373L, 1e-2374L, 1e-2375L, 1e-2376L, 1e-2377L, 1e-2378L, 1e-2379L, 
-   1e-2380L, 1e-2381L, 1e-2382L, 1e-2383L, 1e-2384L, 1e-2385L, 1e-2386L, 1e-2387L, 1e-2388L, 1e-2389L, 
-   1e-2390L, 1e-2391L, 1e-2392L, 1e-2393L, 1e-2394L, 1e-2395L, 1e-2396L, 1e-2397L, 1e-2398L, 1e-2399L, 
-   1e-2400L, 1e-2401L, 1e-2402L, 1e-2403L, 1e-2404L, 1e-2405L, 1e-2406L, 1e-2407L, 1e-2408L, 1e-2409L, 
-   1e-2410L, 1e-2411L, 1e-2412L, 1e-2413L, 1e-2414L, 1e-2415L, 1e-2416L, 1e-2417L, 1e-2418L, 1e-2419L, 
-   1e-2420L, 1e-2421L, 1e-2422L, 1e-2423L, 1e-2424L, 1e-2425L, 1e-2426L, 1e-2427L, 1e-2428L, 1e-2429L, 
-   1e-2430L, 1e-2431L, 1e-2432L, 1e-2433L, 1e-2434L, 1e-2435L, 1e-2436L, 1e-2437L, 1e-2438L, 1e-2439L, 
-   1e-2440L, 1e-2441L, 1e-2442L, 1e-2443L, 1e-2444L, 1e-2445L, 1e-2446L, 1e-2447L, 1e-2448L, 1e-2449L, 
-   1e-2450L, 1e-2451L, 1e-2452L, 1e-2453L, 1e-2454L, 1e-2455L, 1e-2456L, 1e-2457L, 1e-2458L, 1e-2459L, 
-   1e-2460L, 1e-2461L, 1e-2462L, 1e-2463L, 1e-2464L, 1e-2465L, 1e-2466L, 1e-2467L, 1e-2468L, 1e-2469L, 
-   1e-2470L, 1e-2471L, 1e-2472L, 1e-2473L, 1e-2474L, 1e-2475L, 1e-2476L, 1e-2477L, 1e-2478L, 1e-2479L, 
-   1e-2480L, 1e-2481L, 1e-2482L, 1e-2483L, 1e-2484L, 1e-2485L, 1e-2486L, 1e-2487L, 1e-2488L, 1e-2489L, 
-   1e-2490L, 1e-2491L, 1e-2492L, 1e-2493L, 1e-2494L, 1e-2495L, 1e-2496L, 1e-2497L, 1e-2498L, 1e-2499L, 
-   1e-2500L, 1e-2501L, 1e-2502L, 1e-2503L, 1e-2504L, 1e-2505L, 1e-2506L, 1e-2507L, 1e-2508L, 1e-2509L, 
-   1e-2510L, 1e-2511L, 1e-2512L, 1e-2513L, 1e-2514L, 1e-2515L, 1e-2516L, 1e-2517L, 1e-2518L, 1e-2519L, 
-   1e-2520L, 1e-2521L, 1e-2522L, 1e-2523L, 1e-2524L, 1e-2525L, 1e-2526L, 1e-2527L, 1e-2528L, 1e-2529L, 
-   1e-2530L, 1e-2531L, 1e-2532L, 1e-2533L, 1e-2534L, 1e-2535L, 1e-2536L, 1e-2537L, 1e-2538L, 1e-2539L, 
-   1e-2540L, 1e-2541L, 1e-2542L, 1e-2543L, 1e-2544L, 1e-2545L, 1e-2546L, 1e-2547L, 1e-2548L, 1e-2549L, 
-   1e-2550L, 1e-2551L, 1e-2552L, 1e-2553L, 1e-2554L, 1e-2555L, 1e-2556L, 1e-2557L, 1e-2558L, 1e-2559L, 
-   1e-2560L, 1e-2561L, 1e-2562L, 1e-2563L, 1e-2564L, 1e-2565L, 1e-2566L, 1e-2567L, 1e-2568L, 1e-2569L, 
-   1e-2570L, 1e-2571L, 1e-2572L, 1e-2573L, 1e-2574L, 1e-2575L, 1e-2576L, 1e-2577L, 1e-2578L, 1e-2579L, 
-   1e-2580L, 1e-2581L, 1e-2582L, 1e-2583L, 1e-2584L, 1e-2585L, 1e-2586L, 1e-2587L, 1e-2588L, 1e-2589L, 
-   1e-2590L, 1e-2591L, 1e-2592L, 1e-2593L, 1e-2594L, 1e-2595L, 1e-2596L, 1e-2597L, 1e-2598L, 1e-2599L, 
-   1e-2600L, 1e-2601L, 1e-2602L, 1e-2603L, 1e-2604L, 1e-2605L, 1e-2606L, 1e-2607L, 1e-2608L, 1e-2609L, 
-   1e-2610L, 1e-2611L, 1e-2612L, 1e-2613L, 1e-2614L, 1e-2615L, 1e-2616L, 1e-2617L, 1e-2618L, 1e-2619L, 
-   1e-2620L, 1e-2621L, 1e-2622L, 1e-2623L, 1e-2624L, 1e-2625L, 1e-2626L, 1e-2627L, 1e-2628L, 1e-2629L, 
-   1e-2630L, 1e-2631L, 1e-2632L, 1e-2633L, 1e-2634L, 1e-2635L, 1e-2636L, 1e-2637L, 1e-2638L, 1e-2639L, 
-   1e-2640L, 1e-2641L, 1e-2642L, 1e-2643L, 1e-2644L, 1e-2645L, 1e-2646L, 1e-2647L, 1e-2648L, 1e-2649L, 
-   1e-2650L, 1e-2651L, 1e-2652L, 1e-2653L, 1e-2654L, 1e-2655L, 1e-2656L, 1e-2657L, 1e-2658L, 1e-2659L, 
-   1e-2660L, 1e-2661L, 1e-2662L, 1e-2663L, 1e-2664L, 1e-2665L, 1e-2666L, 1e-2667L, 1e-2668L, 1e-2669L, 
-   1e-2670L, 1e-2671L, 1e-2672L, 1e-2673L, 1e-2674L, 1e-2675L, 1e-2676L, 1e-2677L, 1e-2678L, 1e-2679L, 
-   1e-2680L, 1e-2681L, 1e-2682L, 1e-2683L, 1e-2684L, 1e-2685L, 1e-2686L, 1e-2687L, 1e-2688L, 1e-2689L, 
-   1e-2690L, 1e-2691L, 1e-2692L, 1e-2693L, 1e-2694L, 1e-2695L, 1e-2696L, 1e-2697L, 1e-2698L, 1e-2699L, 
-   1e-2700L, 1e-2701L, 1e-2702L, 1e-2703L, 1e-2704L, 1e-2705L, 1e-2706L, 1e-2707L, 1e-2708L, 1e-2709L, 
-   1e-2710L, 1e-2711L, 1e-2712L, 1e-2713L, 1e-2714L, 1e-2715L, 1e-2716L, 1e-2717L, 1e-2718L, 1e-2719L, 
-   1e-2720L, 1e-2721L, 1e-2722L, 1e-2723L, 1e-2724L, 1e-2725L, 1e-2726L, 1e-2727L, 1e-2728L, 1e-2729L, 
-   1e-2730L, 1e-2731L, 1e-2732L, 1e-2733L, 1e-2734L, 1e-2735L, 1e-2736L, 1e-2737L, 1e-2738L, 1e-2739L, 
-   1e-2740L, 1e-2741L, 1e-2742L, 1e-2743L, 1e-2744L, 1e-2745L, 1e-2746L, 1e-2747L, 1e-2748L, 1e-2749L, 
-   1e-2750L, 1e-2751L, 1e-2752L, 1e-2753L, 1e-2754L, 1e-2755L, 1e-2756L, 1e-2757L, 1e-2758L, 1e-2759L, 
-   1e-2760L, 1e-2761L, 1e-2762L, 1e-2763L, 1e-2764L, 1e-2765L, 1e-2766L, 1e-2767L, 1e-2768L, 1e-2769L, 
-   1e-2770L, 1e-2771L, 1e-2772L, 1e-2773L, 1e-2774L, 1e-2775L, 1e-2776L, 1e-2777L, 1e-2778L, 1e-2779L, 
-   1e-2780L, 1e-2781L, 1e-2782L, 1e-2783L, 1e-2784L, 1e-2785L, 1e-2786L, 1e-2787L, 1e-2788L, 1e-2789L, 
-   1e-2790L, 1e-2791L, 1e-2792L, 1e-2793L, 1e-2794L, 1e-2795L, 1e-2796L, 1e-2797L, 1e-2798L, 1e-2799L, 
-   1e-2800L, 1e-2801L, 1e-2802L, 1e-2803L, 1e-2804L, 1e-2805L, 1e-2806L, 1e-2807L, 1e-2808L, 1e-2809L, 
-   1e-2810L, 1e-2811L, 1e-2812L, 1e-2813L, 1e-2814L, 1e-2815L, 1e-2816L, 1e-2817L, 1e-2818L, 1e-2819L, 
-   1e-2820L, 1e-2821L, 1e-2822L, 1e-2823L, 1e-2824L, 1e-2825L, 1e-2826L, 1e-2827L, 1e-2828L, 1e-2829L, 
-   1e-2830L, 1e-2831L, 1e-2832L, 1e-2833L, 1e-2834L, 1e-2835L, 1e-2836L, 1e-2837L, 1e-2838L, 1e-2839L, 
-   1e-2840L, 1e-2841L, 1e-2842L, 1e-2843L, 1e-2844L, 1e-2845L, 1e-2846L, 1e-2847L, 1e-2848L, 1e-2849L, 
-   1e-2850L, 1e-2851L, 1e-2852L, 1e-2853L, 1e-2854L, 1e-2855L, 1e-2856L, 1e-2857L, 1e-2858L, 1e-2859L, 
-   1e-2860L, 1e-2861L, 1e-2862L, 1e-2863L, 1e-2864L, 1e-2865L, 1e-2866L, 1e-2867L, 1e-2868L, 1e-2869L, 
-   1e-2870L, 1e-2871L, 1e-2872L, 1e-2873L, 1e-2874L, 1e-2875L, 1e-2876L, 1e-2877L, 1e-2878L, 1e-2879L, 
-   1e-2880L, 1e-2881L, 1e-2882L, 1e-2883L, 1e-2884L, 1e-2885L, 1e-2886L, 1e-2887L, 1e-2888L, 1e-2889L, 
-   1e-2890L, 1e-2891L, 1e-2892L, 1e-2893L, 1e-2894L, 1e-2895L, 1e-2896L, 1e-2897L, 1e-2898L, 1e-2899L, 
-   1e-2900L, 1e-2901L, 1e-2902L, 1e-2903L, 1e-2904L, 1e-2905L, 1e-2906L, 1e-2907L, 1e-2908L, 1e-2909L, 
-   1e-2910L, 1e-2911L, 1e-2912L, 1e-2913L, 1e-2914L, 1e-2915L, 1e-2916L, 1e-2917L, 1e-2918L, 1e-2919L, 
-   1e-2920L, 1e-2921L, 1e-2922L, 1e-2923L, 1e-2924L, 1e-2925L, 1e-2926L, 1e-2927L, 1e-2928L, 1e-2929L, 
-   1e-2930L, 1e-2931L, 1e-2932L, 1e-2933L, 1e-2934L, 1e-2935L, 1e-2936L, 1e-2937L, 1e-2938L, 1e-2939L, 
-   1e-2940L, 1e-2941L, 1e-2942L, 1e-2943L, 1e-2944L, 1e-2945L, 1e-2946L, 1e-2947L, 1e-2948L, 1e-2949L, 
-   1e-2950L, 1e-2951L, 1e-2952L, 1e-2953L, 1e-2954L, 1e-2955L, 1e-2956L, 1e-2957L, 1e-2958L, 1e-2959L, 
-   1e-2960L, 1e-2961L, 1e-2962L, 1e-2963L, 1e-2964L, 1e-2965L, 1e-2966L, 1e-2967L, 1e-2968L, 1e-2969L, 
-   1e-2970L, 1e-2971L, 1e-2972L, 1e-2973L, 1e-2974L, 1e-2975L, 1e-2976L, 1e-2977L, 1e-2978L, 1e-2979L, 
-   1e-2980L, 1e-2981L, 1e-2982L, 1e-2983L, 1e-2984L, 1e-2985L, 1e-2986L, 1e-2987L, 1e-2988L, 1e-2989L, 
-   1e-2990L, 1e-2991L, 1e-2992L, 1e-2993L, 1e-2994L, 1e-2995L, 1e-2996L, 1e-2997L, 1e-2998L, 1e-2999L, 
-   1e-3000L, 1e-3001L, 1e-3002L, 1e-3003L, 1e-3004L, 1e-3005L, 1e-3006L, 1e-3007L, 1e-3008L, 1e-3009L, 
-   1e-3010L, 1e-3011L, 1e-3012L, 1e-3013L, 1e-3014L, 1e-3015L, 1e-3016L, 1e-3017L, 1e-3018L, 1e-3019L, 
-   1e-3020L, 1e-3021L, 1e-3022L, 1e-3023L, 1e-3024L, 1e-3025L, 1e-3026L, 1e-3027L, 1e-3028L, 1e-3029L, 
-   1e-3030L, 1e-3031L, 1e-3032L, 1e-3033L, 1e-3034L, 1e-3035L, 1e-3036L, 1e-3037L, 1e-3038L, 1e-3039L, 
-   1e-3040L, 1e-3041L, 1e-3042L, 1e-3043L, 1e-3044L, 1e-3045L, 1e-3046L, 1e-3047L, 1e-3048L, 1e-3049L, 
-   1e-3050L, 1e-3051L, 1e-3052L, 1e-3053L, 1e-3054L, 1e-3055L, 1e-3056L, 1e-3057L, 1e-3058L, 1e-3059L, 
-   1e-3060L, 1e-3061L, 1e-3062L, 1e-3063L, 1e-3064L, 1e-3065L, 1e-3066L, 1e-3067L, 1e-3068L, 1e-3069L, 
-   1e-3070L, 1e-3071L, 1e-3072L, 1e-3073L, 1e-3074L, 1e-3075L, 1e-3076L, 1e-3077L, 1e-3078L, 1e-3079L, 
-   1e-3080L, 1e-3081L, 1e-3082L, 1e-3083L, 1e-3084L, 1e-3085L, 1e-3086L, 1e-3087L, 1e-3088L, 1e-3089L, 
-   1e-3090L, 1e-3091L, 1e-3092L, 1e-3093L, 1e-3094L, 1e-3095L, 1e-3096L, 1e-3097L, 1e-3098L, 1e-3099L, 
-   1e-3100L, 1e-3101L, 1e-3102L, 1e-3103L, 1e-3104L, 1e-3105L, 1e-3106L, 1e-3107L, 1e-3108L, 1e-3109L, 
-   1e-3110L, 1e-3111L, 1e-3112L, 1e-3113L, 1e-3114L, 1e-3115L, 1e-3116L, 1e-3117L, 1e-3118L, 1e-3119L, 
-   1e-3120L, 1e-3121L, 1e-3122L, 1e-3123L, 1e-3124L, 1e-3125L, 1e-3126L, 1e-3127L, 1e-3128L, 1e-3129L, 
-   1e-3130L, 1e-3131L, 1e-3132L, 1e-3133L, 1e-3134L, 1e-3135L, 1e-3136L, 1e-3137L, 1e-3138L, 1e-3139L, 
-   1e-3140L, 1e-3141L, 1e-3142L, 1e-3143L, 1e-3144L, 1e-3145L, 1e-3146L, 1e-3147L, 1e-3148L, 1e-3149L, 
-   1e-3150L, 1e-3151L, 1e-3152L, 1e-3153L, 1e-3154L, 1e-3155L, 1e-3156L, 1e-3157L, 1e-3158L, 1e-3159L, 
-   1e-3160L, 1e-3161L, 1e-3162L, 1e-3163L, 1e-3164L, 1e-3165L, 1e-3166L, 1e-3167L, 1e-3168L, 1e-3169L, 
-   1e-3170L, 1e-3171L, 1e-3172L, 1e-3173L, 1e-3174L, 1e-3175L, 1e-3176L, 1e-3177L, 1e-3178L, 1e-3179L, 
-   1e-3180L, 1e-3181L, 1e-3182L, 1e-3183L, 1e-3184L, 1e-3185L, 1e-3186L, 1e-3187L, 1e-3188L, 1e-3189L, 
-   1e-3190L, 1e-3191L, 1e-3192L, 1e-3193L, 1e-3194L, 1e-3195L, 1e-3196L, 1e-3197L, 1e-3198L, 1e-3199L, 
-   1e-3200L, 1e-3201L, 1e-3202L, 1e-3203L, 1e-3204L, 1e-3205L, 1e-3206L, 1e-3207L, 1e-3208L, 1e-3209L, 
-   1e-3210L, 1e-3211L, 1e-3212L, 1e-3213L, 1e-3214L, 1e-3215L, 1e-3216L, 1e-3217L, 1e-3218L, 1e-3219L, 
-   1e-3220L, 1e-3221L, 1e-3222L, 1e-3223L, 1e-3224L, 1e-3225L, 1e-3226L, 1e-3227L, 1e-3228L, 1e-3229L, 
-   1e-3230L, 1e-3231L, 1e-3232L, 1e-3233L, 1e-3234L, 1e-3235L, 1e-3236L, 1e-3237L, 1e-3238L, 1e-3239L, 
-   1e-3240L, 1e-3241L, 1e-3242L, 1e-3243L, 1e-3244L, 1e-3245L, 1e-3246L, 1e-3247L, 1e-3248L, 1e-3249L, 
-   1e-3250L, 1e-3251L, 1e-3252L, 1e-3253L, 1e-3254L, 1e-3255L, 1e-3256L, 1e-3257L, 1e-3258L, 1e-3259L, 
-   1e-3260L, 1e-3261L, 1e-3262L, 1e-3263L, 1e-3264L, 1e-3265L, 1e-3266L, 1e-3267L, 1e-3268L, 1e-3269L, 
-   1e-3270L, 1e-3271L, 1e-3272L, 1e-3273L, 1e-3274L, 1e-3275L, 1e-3276L, 1e-3277L, 1e-3278L, 1e-3279L, 
-   1e-3280L, 1e-3281L, 1e-3282L, 1e-3283L, 1e-3284L, 1e-3285L, 1e-3286L, 1e-3287L, 1e-3288L, 1e-3289L, 
-   1e-3290L, 1e-3291L, 1e-3292L, 1e-3293L, 1e-3294L, 1e-3295L, 1e-3296L, 1e-3297L, 1e-3298L, 1e-3299L, 
-   1e-3300L, 1e-3301L, 1e-3302L, 1e-3303L, 1e-3304L, 1e-3305L, 1e-3306L, 1e-3307L, 1e-3308L, 1e-3309L, 
-   1e-3310L, 1e-3311L, 1e-3312L, 1e-3313L, 1e-3314L, 1e-3315L, 1e-3316L, 1e-3317L, 1e-3318L, 1e-3319L, 
-   1e-3320L, 1e-3321L, 1e-3322L, 1e-3323L, 1e-3324L, 1e-3325L, 1e-3326L, 1e-3327L, 1e-3328L, 1e-3329L, 
-   1e-3330L, 1e-3331L, 1e-3332L, 1e-3333L, 1e-3334L, 1e-3335L, 1e-3336L, 1e-3337L, 1e-3338L, 1e-3339L, 
-   1e-3340L, 1e-3341L, 1e-3342L, 1e-3343L, 1e-3344L, 1e-3345L, 1e-3346L, 1e-3347L, 1e-3348L, 1e-3349L, 
-   1e-3350L, 1e-3351L, 1e-3352L, 1e-3353L, 1e-3354L, 1e-3355L, 1e-3356L, 1e-3357L, 1e-3358L, 1e-3359L, 
-   1e-3360L, 1e-3361L, 1e-3362L, 1e-3363L, 1e-3364L, 1e-3365L, 1e-3366L, 1e-3367L, 1e-3368L, 1e-3369L, 
-   1e-3370L, 1e-3371L, 1e-3372L, 1e-3373L, 1e-3374L, 1e-3375L, 1e-3376L, 1e-3377L, 1e-3378L, 1e-3379L, 
-   1e-3380L, 1e-3381L, 1e-3382L, 1e-3383L, 1e-3384L, 1e-3385L, 1e-3386L, 1e-3387L, 1e-3388L, 1e-3389L, 
-   1e-3390L, 1e-3391L, 1e-3392L, 1e-3393L, 1e-3394L, 1e-3395L, 1e-3396L, 1e-3397L, 1e-3398L, 1e-3399L, 
-   1e-3400L, 1e-3401L, 1e-3402L, 1e-3403L, 1e-3404L, 1e-3405L, 1e-3406L, 1e-3407L, 1e-3408L, 1e-3409L, 
-   1e-3410L, 1e-3411L, 1e-3412L, 1e-3413L, 1e-3414L, 1e-3415L, 1e-3416L, 1e-3417L, 1e-3418L, 1e-3419L, 
-   1e-3420L, 1e-3421L, 1e-3422L, 1e-3423L, 1e-3424L, 1e-3425L, 1e-3426L, 1e-3427L, 1e-3428L, 1e-3429L, 
-   1e-3430L, 1e-3431L, 1e-3432L, 1e-3433L, 1e-3434L, 1e-3435L, 1e-3436L, 1e-3437L, 1e-3438L, 1e-3439L, 
-   1e-3440L, 1e-3441L, 1e-3442L, 1e-3443L, 1e-3444L, 1e-3445L, 1e-3446L, 1e-3447L, 1e-3448L, 1e-3449L, 
-   1e-3450L, 1e-3451L, 1e-3452L, 1e-3453L, 1e-3454L, 1e-3455L, 1e-3456L, 1e-3457L, 1e-3458L, 1e-3459L, 
-   1e-3460L, 1e-3461L, 1e-3462L, 1e-3463L, 1e-3464L, 1e-3465L, 1e-3466L, 1e-3467L, 1e-3468L, 1e-3469L, 
-   1e-3470L, 1e-3471L, 1e-3472L, 1e-3473L, 1e-3474L, 1e-3475L, 1e-3476L, 1e-3477L, 1e-3478L, 1e-3479L, 
-   1e-3480L, 1e-3481L, 1e-3482L, 1e-3483L, 1e-3484L, 1e-3485L, 1e-3486L, 1e-3487L, 1e-3488L, 1e-3489L, 
-   1e-3490L, 1e-3491L, 1e-3492L, 1e-3493L, 1e-3494L, 1e-3495L, 1e-3496L, 1e-3497L, 1e-3498L, 1e-3499L, 
-   1e-3500L, 1e-3501L, 1e-3502L, 1e-3503L, 1e-3504L, 1e-3505L, 1e-3506L, 1e-3507L, 1e-3508L, 1e-3509L, 
-   1e-3510L, 1e-3511L, 1e-3512L, 1e-3513L, 1e-3514L, 1e-3515L, 1e-3516L, 1e-3517L, 1e-3518L, 1e-3519L, 
-   1e-3520L, 1e-3521L, 1e-3522L, 1e-3523L, 1e-3524L, 1e-3525L, 1e-3526L, 1e-3527L, 1e-3528L, 1e-3529L, 
-   1e-3530L, 1e-3531L, 1e-3532L, 1e-3533L, 1e-3534L, 1e-3535L, 1e-3536L, 1e-3537L, 1e-3538L, 1e-3539L, 
-   1e-3540L, 1e-3541L, 1e-3542L, 1e-3543L, 1e-3544L, 1e-3545L, 1e-3546L, 1e-3547L, 1e-3548L, 1e-3549L, 
-   1e-3550L, 1e-3551L, 1e-3552L, 1e-3553L, 1e-3554L, 1e-3555L, 1e-3556L, 1e-3557L, 1e-3558L, 1e-3559L, 
-   1e-3560L, 1e-3561L, 1e-3562L, 1e-3563L, 1e-3564L, 1e-3565L, 1e-3566L, 1e-3567L, 1e-3568L, 1e-3569L, 
-   1e-3570L, 1e-3571L, 1e-3572L, 1e-3573L, 1e-3574L, 1e-3575L, 1e-3576L, 1e-3577L, 1e-3578L, 1e-3579L, 
-   1e-3580L, 1e-3581L, 1e-3582L, 1e-3583L, 1e-3584L, 1e-3585L, 1e-3586L, 1e-3587L, 1e-3588L, 1e-3589L, 
-   1e-3590L, 1e-3591L, 1e-3592L, 1e-3593L, 1e-3594L, 1e-3595L, 1e-3596L, 1e-3597L, 1e-3598L, 1e-3599L, 
-   1e-3600L, 1e-3601L, 1e-3602L, 1e-3603L, 1e-3604L, 1e-3605L, 1e-3606L, 1e-3607L, 1e-3608L, 1e-3609L, 
-   1e-3610L, 1e-3611L, 1e-3612L, 1e-3613L, 1e-3614L, 1e-3615L, 1e-3616L, 1e-3617L, 1e-3618L, 1e-3619L, 
-   1e-3620L, 1e-3621L, 1e-3622L, 1e-3623L, 1e-3624L, 1e-3625L, 1e-3626L, 1e-3627L, 1e-3628L, 1e-3629L, 
-   1e-3630L, 1e-3631L, 1e-3632L, 1e-3633L, 1e-3634L, 1e-3635L, 1e-3636L, 1e-3637L, 1e-3638L, 1e-3639L, 
-   1e-3640L, 1e-3641L, 1e-3642L, 1e-3643L, 1e-3644L, 1e-3645L, 1e-3646L, 1e-3647L, 1e-3648L, 1e-3649L, 
-   1e-3650L, 1e-3651L, 1e-3652L, 1e-3653L, 1e-3654L, 1e-3655L, 1e-3656L, 1e-3657L, 1e-3658L, 1e-3659L, 
-   1e-3660L, 1e-3661L, 1e-3662L, 1e-3663L, 1e-3664L, 1e-3665L, 1e-3666L, 1e-3667L, 1e-3668L, 1e-3669L, 
-   1e-3670L, 1e-3671L, 1e-3672L, 1e-3673L, 1e-3674L, 1e-3675L, 1e-3676L, 1e-3677L, 1e-3678L, 1e-3679L, 
-   1e-3680L, 1e-3681L, 1e-3682L, 1e-3683L, 1e-3684L, 1e-3685L, 1e-3686L, 1e-3687L, 1e-3688L, 1e-3689L, 
-   1e-3690L, 1e-3691L, 1e-3692L, 1e-3693L, 1e-3694L, 1e-3695L, 1e-3696L, 1e-3697L, 1e-3698L, 1e-3699L, 
-   1e-3700L, 1e-3701L, 1e-3702L, 1e-3703L, 1e-3704L, 1e-3705L, 1e-3706L, 1e-3707L, 1e-3708L, 1e-3709L, 
-   1e-3710L, 1e-3711L, 1e-3712L, 1e-3713L, 1e-3714L, 1e-3715L, 1e-3716L, 1e-3717L, 1e-3718L, 1e-3719L, 
-   1e-3720L, 1e-3721L, 1e-3722L, 1e-3723L, 1e-3724L, 1e-3725L, 1e-3726L, 1e-3727L, 1e-3728L, 1e-3729L, 
-   1e-3730L, 1e-3731L, 1e-3732L, 1e-3733L, 1e-3734L, 1e-3735L, 1e-3736L, 1e-3737L, 1e-3738L, 1e-3739L, 
-   1e-3740L, 1e-3741L, 1e-3742L, 1e-3743L, 1e-3744L, 1e-3745L, 1e-3746L, 1e-3747L, 1e-3748L, 1e-3749L, 
-   1e-3750L, 1e-3751L, 1e-3752L, 1e-3753L, 1e-3754L, 1e-3755L, 1e-3756L, 1e-3757L, 1e-3758L, 1e-3759L, 
-   1e-3760L, 1e-3761L, 1e-3762L, 1e-3763L, 1e-3764L, 1e-3765L, 1e-3766L, 1e-3767L, 1e-3768L, 1e-3769L, 
-   1e-3770L, 1e-3771L, 1e-3772L, 1e-3773L, 1e-3774L, 1e-3775L, 1e-3776L, 1e-3777L, 1e-3778L, 1e-3779L, 
-   1e-3780L, 1e-3781L, 1e-3782L, 1e-3783L, 1e-3784L, 1e-3785L, 1e-3786L, 1e-3787L, 1e-3788L, 1e-3789L, 
-   1e-3790L, 1e-3791L, 1e-3792L, 1e-3793L, 1e-3794L, 1e-3795L, 1e-3796L, 1e-3797L, 1e-3798L, 1e-3799L, 
-   1e-3800L, 1e-3801L, 1e-3802L, 1e-3803L, 1e-3804L, 1e-3805L, 1e-3806L, 1e-3807L, 1e-3808L, 1e-3809L, 
-   1e-3810L, 1e-3811L, 1e-3812L, 1e-3813L, 1e-3814L, 1e-3815L, 1e-3816L, 1e-3817L, 1e-3818L, 1e-3819L, 
-   1e-3820L, 1e-3821L, 1e-3822L, 1e-3823L, 1e-3824L, 1e-3825L, 1e-3826L, 1e-3827L, 1e-3828L, 1e-3829L, 
-   1e-3830L, 1e-3831L, 1e-3832L, 1e-3833L, 1e-3834L, 1e-3835L, 1e-3836L, 1e-3837L, 1e-3838L, 1e-3839L, 
-   1e-3840L, 1e-3841L, 1e-3842L, 1e-3843L, 1e-3844L, 1e-3845L, 1e-3846L, 1e-3847L, 1e-3848L, 1e-3849L, 
-   1e-3850L, 1e-3851L, 1e-3852L, 1e-3853L, 1e-3854L, 1e-3855L, 1e-3856L, 1e-3857L, 1e-3858L, 1e-3859L, 
-   1e-3860L, 1e-3861L, 1e-3862L, 1e-3863L, 1e-3864L, 1e-3865L, 1e-3866L, 1e-3867L, 1e-3868L, 1e-3869L, 
-   1e-3870L, 1e-3871L, 1e-3872L, 1e-3873L, 1e-3874L, 1e-3875L, 1e-3876L, 1e-3877L, 1e-3878L, 1e-3879L, 
-   1e-3880L, 1e-3881L, 1e-3882L, 1e-3883L, 1e-3884L, 1e-3885L, 1e-3886L, 1e-3887L, 1e-3888L, 1e-3889L, 
-   1e-3890L, 1e-3891L, 1e-3892L, 1e-3893L, 1e-3894L, 1e-3895L, 1e-3896L, 1e-3897L, 1e-3898L, 1e-3899L, 
-   1e-3900L, 1e-3901L, 1e-3902L, 1e-3903L, 1e-3904L, 1e-3905L, 1e-3906L, 1e-3907L, 1e-3908L, 1e-3909L, 
-   1e-3910L, 1e-3911L, 1e-3912L, 1e-3913L, 1e-3914L, 1e-3915L, 1e-3916L, 1e-3917L, 1e-3918L, 1e-3919L, 
-   1e-3920L, 1e-3921L, 1e-3922L, 1e-3923L, 1e-3924L, 1e-3925L, 1e-3926L, 1e-3927L, 1e-3928L, 1e-3929L, 
-   1e-3930L, 1e-3931L, 1e-3932L, 1e-3933L, 1e-3934L, 1e-3935L, 1e-3936L, 1e-3937L, 1e-3938L, 1e-3939L, 
-   1e-3940L, 1e-3941L, 1e-3942L, 1e-3943L, 1e-3944L, 1e-3945L, 1e-3946L, 1e-3947L, 1e-3948L, 1e-3949L, 
-   1e-3950L, 1e-3951L, 1e-3952L, 1e-3953L, 1e-3954L, 1e-3955L, 1e-3956L, 1e-3957L, 1e-3958L, 1e-3959L, 
-   1e-3960L, 1e-3961L, 1e-3962L, 1e-3963L, 1e-3964L, 1e-3965L, 1e-3966L, 1e-3967L, 1e-3968L, 1e-3969L, 
-   1e-3970L, 1e-3971L, 1e-3972L, 1e-3973L, 1e-3974L, 1e-3975L, 1e-3976L, 1e-3977L, 1e-3978L, 1e-3979L, 
-   1e-3980L, 1e-3981L, 1e-3982L, 1e-3983L, 1e-3984L, 1e-3985L, 1e-3986L, 1e-3987L, 1e-3988L, 1e-3989L, 
-   1e-3990L, 1e-3991L, 1e-3992L, 1e-3993L, 1e-3994L, 1e-3995L, 1e-3996L, 1e-3997L, 1e-3998L, 1e-3999L, 
-   1e-4000L, 1e-4001L, 1e-4002L, 1e-4003L, 1e-4004L, 1e-4005L, 1e-4006L, 1e-4007L, 1e-4008L, 1e-4009L, 
-   1e-4010L, 1e-4011L, 1e-4012L, 1e-4013L, 1e-4014L, 1e-4015L, 1e-4016L, 1e-4017L, 1e-4018L, 1e-4019L, 
-   1e-4020L, 1e-4021L, 1e-4022L, 1e-4023L, 1e-4024L, 1e-4025L, 1e-4026L, 1e-4027L, 1e-4028L, 1e-4029L, 
-   1e-4030L, 1e-4031L, 1e-4032L, 1e-4033L, 1e-4034L, 1e-4035L, 1e-4036L, 1e-4037L, 1e-4038L, 1e-4039L, 
-   1e-4040L, 1e-4041L, 1e-4042L, 1e-4043L, 1e-4044L, 1e-4045L, 1e-4046L, 1e-4047L, 1e-4048L, 1e-4049L, 
-   1e-4050L, 1e-4051L, 1e-4052L, 1e-4053L, 1e-4054L, 1e-4055L, 1e-4056L, 1e-4057L, 1e-4058L, 1e-4059L, 
-   1e-4060L, 1e-4061L, 1e-4062L, 1e-4063L, 1e-4064L, 1e-4065L, 1e-4066L, 1e-4067L, 1e-4068L, 1e-4069L, 
-   1e-4070L, 1e-4071L, 1e-4072L, 1e-4073L, 1e-4074L, 1e-4075L, 1e-4076L, 1e-4077L, 1e-4078L, 1e-4079L, 
-   1e-4080L, 1e-4081L, 1e-4082L, 1e-4083L, 1e-4084L, 1e-4085L, 1e-4086L, 1e-4087L, 1e-4088L, 1e-4089L, 
-   1e-4090L, 1e-4091L, 1e-4092L, 1e-4093L, 1e-4094L, 1e-4095L, 1e-4096L, 1e-4097L, 1e-4098L, 1e-4099L, 
-   1e-4100L, 1e-4101L, 1e-4102L, 1e-4103L, 1e-4104L, 1e-4105L, 1e-4106L, 1e-4107L, 1e-4108L, 1e-4109L, 
-   1e-4110L, 1e-4111L, 1e-4112L, 1e-4113L, 1e-4114L, 1e-4115L, 1e-4116L, 1e-4117L, 1e-4118L, 1e-4119L, 
-   1e-4120L, 1e-4121L, 1e-4122L, 1e-4123L, 1e-4124L, 1e-4125L, 1e-4126L, 1e-4127L, 1e-4128L, 1e-4129L, 
-   1e-4130L, 1e-4131L, 1e-4132L, 1e-4133L, 1e-4134L, 1e-4135L, 1e-4136L, 1e-4137L, 1e-4138L, 1e-4139L, 
-   1e-4140L, 1e-4141L, 1e-4142L, 1e-4143L, 1e-4144L, 1e-4145L, 1e-4146L, 1e-4147L, 1e-4148L, 1e-4149L, 
-   1e-4150L, 1e-4151L, 1e-4152L, 1e-4153L, 1e-4154L, 1e-4155L, 1e-4156L, 1e-4157L, 1e-4158L, 1e-4159L, 
-   1e-4160L, 1e-4161L, 1e-4162L, 1e-4163L, 1e-4164L, 1e-4165L, 1e-4166L, 1e-4167L, 1e-4168L, 1e-4169L, 
-   1e-4170L, 1e-4171L, 1e-4172L, 1e-4173L, 1e-4174L, 1e-4175L, 1e-4176L, 1e-4177L, 1e-4178L, 1e-4179L, 
-   1e-4180L, 1e-4181L, 1e-4182L, 1e-4183L, 1e-4184L, 1e-4185L, 1e-4186L, 1e-4187L, 1e-4188L, 1e-4189L, 
-   1e-4190L, 1e-4191L, 1e-4192L, 1e-4193L, 1e-4194L, 1e-4195L, 1e-4196L, 1e-4197L, 1e-4198L, 1e-4199L, 
-   1e-4200L, 1e-4201L, 1e-4202L, 1e-4203L, 1e-4204L, 1e-4205L, 1e-4206L, 1e-4207L, 1e-4208L, 1e-4209L, 
-   1e-4210L, 1e-4211L, 1e-4212L, 1e-4213L, 1e-4214L, 1e-4215L, 1e-4216L, 1e-4217L, 1e-4218L, 1e-4219L, 
-   1e-4220L, 1e-4221L, 1e-4222L, 1e-4223L, 1e-4224L, 1e-4225L, 1e-4226L, 1e-4227L, 1e-4228L, 1e-4229L, 
-   1e-4230L, 1e-4231L, 1e-4232L, 1e-4233L, 1e-4234L, 1e-4235L, 1e-4236L, 1e-4237L, 1e-4238L, 1e-4239L, 
-   1e-4240L, 1e-4241L, 1e-4242L, 1e-4243L, 1e-4244L, 1e-4245L, 1e-4246L, 1e-4247L, 1e-4248L, 1e-4249L, 
-   1e-4250L, 1e-4251L, 1e-4252L, 1e-4253L, 1e-4254L, 1e-4255L, 1e-4256L, 1e-4257L, 1e-4258L, 1e-4259L, 
-   1e-4260L, 1e-4261L, 1e-4262L, 1e-4263L, 1e-4264L, 1e-4265L, 1e-4266L, 1e-4267L, 1e-4268L, 1e-4269L, 
-   1e-4270L, 1e-4271L, 1e-4272L, 1e-4273L, 1e-4274L, 1e-4275L, 1e-4276L, 1e-4277L, 1e-4278L, 1e-4279L, 
-   1e-4280L, 1e-4281L, 1e-4282L, 1e-4283L, 1e-4284L, 1e-4285L, 1e-4286L, 1e-4287L, 1e-4288L, 1e-4289L, 
-   1e-4290L, 1e-4291L, 1e-4292L, 1e-4293L, 1e-4294L, 1e-4295L, 1e-4296L, 1e-4297L, 1e-4298L, 1e-4299L, 
-   1e-4300L, 1e-4301L, 1e-4302L, 1e-4303L, 1e-4304L, 1e-4305L, 1e-4306L, 1e-4307L, 1e-4308L, 1e-4309L, 
-   1e-4310L, 1e-4311L, 1e-4312L, 1e-4313L, 1e-4314L, 1e-4315L, 1e-4316L, 1e-4317L, 1e-4318L, 1e-4319L, 
-   1e-4320L, 1e-4321L, 1e-4322L, 1e-4323L, 1e-4324L, 1e-4325L, 1e-4326L, 1e-4327L, 1e-4328L, 1e-4329L, 
-   1e-4330L, 1e-4331L, 1e-4332L, 1e-4333L, 1e-4334L, 1e-4335L, 1e-4336L, 1e-4337L, 1e-4338L, 1e-4339L, 
-   1e-4340L, 1e-4341L, 1e-4342L, 1e-4343L, 1e-4344L, 1e-4345L, 1e-4346L, 1e-4347L, 1e-4348L, 1e-4349L, 
-   1e-4350L, 1e-4351L, 1e-4352L, 1e-4353L, 1e-4354L, 1e-4355L, 1e-4356L, 1e-4357L, 1e-4358L, 1e-4359L, 
-   1e-4360L, 1e-4361L, 1e-4362L, 1e-4363L, 1e-4364L, 1e-4365L, 1e-4366L, 1e-4367L, 1e-4368L, 1e-4369L, 
-   1e-4370L, 1e-4371L, 1e-4372L, 1e-4373L, 1e-4374L, 1e-4375L, 1e-4376L, 1e-4377L, 1e-4378L, 1e-4379L, 
-   1e-4380L, 1e-4381L, 1e-4382L, 1e-4383L, 1e-4384L, 1e-4385L, 1e-4386L, 1e-4387L, 1e-4388L, 1e-4389L, 
-   1e-4390L, 1e-4391L, 1e-4392L, 1e-4393L, 1e-4394L, 1e-4395L, 1e-4396L, 1e-4397L, 1e-4398L, 1e-4399L, 
-   1e-4400L, 1e-4401L, 1e-4402L, 1e-4403L, 1e-4404L, 1e-4405L, 1e-4406L, 1e-4407L, 1e-4408L, 1e-4409L, 
-   1e-4410L, 1e-4411L, 1e-4412L, 1e-4413L, 1e-4414L, 1e-4415L, 1e-4416L, 1e-4417L, 1e-4418L, 1e-4419L, 
-   1e-4420L, 1e-4421L, 1e-4422L, 1e-4423L, 1e-4424L, 1e-4425L, 1e-4426L, 1e-4427L, 1e-4428L, 1e-4429L, 
-   1e-4430L, 1e-4431L, 1e-4432L, 1e-4433L, 1e-4434L, 1e-4435L, 1e-4436L, 1e-4437L, 1e-4438L, 1e-4439L, 
-   1e-4440L, 1e-4441L, 1e-4442L, 1e-4443L, 1e-4444L, 1e-4445L, 1e-4446L, 1e-4447L, 1e-4448L, 1e-4449L, 
-   1e-4450L, 1e-4451L, 1e-4452L, 1e-4453L, 1e-4454L, 1e-4455L, 1e-4456L, 1e-4457L, 1e-4458L, 1e-4459L, 
-   1e-4460L, 1e-4461L, 1e-4462L, 1e-4463L, 1e-4464L, 1e-4465L, 1e-4466L, 1e-4467L, 1e-4468L, 1e-4469L, 
-   1e-4470L, 1e-4471L, 1e-4472L, 1e-4473L, 1e-4474L, 1e-4475L, 1e-4476L, 1e-4477L, 1e-4478L, 1e-4479L, 
-   1e-4480L, 1e-4481L, 1e-4482L, 1e-4483L, 1e-4484L, 1e-4485L, 1e-4486L, 1e-4487L, 1e-4488L, 1e-4489L, 
-   1e-4490L, 1e-4491L, 1e-4492L, 1e-4493L, 1e-4494L, 1e-4495L, 1e-4496L, 1e-4497L, 1e-4498L, 1e-4499L, 
-   1e-4500L, 1e-4501L, 1e-4502L, 1e-4503L, 1e-4504L, 1e-4505L, 1e-4506L, 1e-4507L, 1e-4508L, 1e-4509L, 
-   1e-4510L, 1e-4511L, 1e-4512L, 1e-4513L, 1e-4514L, 1e-4515L, 1e-4516L, 1e-4517L, 1e-4518L, 1e-4519L, 
-   1e-4520L, 1e-4521L, 1e-4522L, 1e-4523L, 1e-4524L, 1e-4525L, 1e-4526L, 1e-4527L, 1e-4528L, 1e-4529L, 
-   1e-4530L, 1e-4531L, 1e-4532L, 1e-4533L, 1e-4534L, 1e-4535L, 1e-4536L, 1e-4537L, 1e-4538L, 1e-4539L, 
-   1e-4540L, 1e-4541L, 1e-4542L, 1e-4543L, 1e-4544L, 1e-4545L, 1e-4546L, 1e-4547L, 1e-4548L, 1e-4549L, 
-   1e-4550L, 1e-4551L, 1e-4552L, 1e-4553L, 1e-4554L, 1e-4555L, 1e-4556L, 1e-4557L, 1e-4558L, 1e-4559L, 
-   1e-4560L, 1e-4561L, 1e-4562L, 1e-4563L, 1e-4564L, 1e-4565L, 1e-4566L, 1e-4567L, 1e-4568L, 1e-4569L, 
-   1e-4570L, 1e-4571L, 1e-4572L, 1e-4573L, 1e-4574L, 1e-4575L, 1e-4576L, 1e-4577L, 1e-4578L, 1e-4579L, 
-   1e-4580L, 1e-4581L, 1e-4582L, 1e-4583L, 1e-4584L, 1e-4585L, 1e-4586L, 1e-4587L, 1e-4588L, 1e-4589L, 
-   1e-4590L, 1e-4591L, 1e-4592L, 1e-4593L, 1e-4594L, 1e-4595L, 1e-4596L, 1e-4597L, 1e-4598L, 1e-4599L, 
-   1e-4600L, 1e-4601L, 1e-4602L, 1e-4603L, 1e-4604L, 1e-4605L, 1e-4606L, 1e-4607L, 1e-4608L, 1e-4609L, 
-   1e-4610L, 1e-4611L, 1e-4612L, 1e-4613L, 1e-4614L, 1e-4615L, 1e-4616L, 1e-4617L, 1e-4618L, 1e-4619L, 
-   1e-4620L, 1e-4621L, 1e-4622L, 1e-4623L, 1e-4624L, 1e-4625L, 1e-4626L, 1e-4627L, 1e-4628L, 1e-4629L, 
-   1e-4630L, 1e-4631L, 1e-4632L, 1e-4633L, 1e-4634L, 1e-4635L, 1e-4636L, 1e-4637L, 1e-4638L, 1e-4639L, 
-   1e-4640L, 1e-4641L, 1e-4642L, 1e-4643L, 1e-4644L, 1e-4645L, 1e-4646L, 1e-4647L, 1e-4648L, 1e-4649L, 
-   1e-4650L, 1e-4651L, 1e-4652L, 1e-4653L, 1e-4654L, 1e-4655L, 1e-4656L, 1e-4657L, 1e-4658L, 1e-4659L, 
-   1e-4660L, 1e-4661L, 1e-4662L, 1e-4663L, 1e-4664L, 1e-4665L, 1e-4666L, 1e-4667L, 1e-4668L, 1e-4669L, 
-   1e-4670L, 1e-4671L, 1e-4672L, 1e-4673L, 1e-4674L, 1e-4675L, 1e-4676L, 1e-4677L, 1e-4678L, 1e-4679L, 
-   1e-4680L, 1e-4681L, 1e-4682L, 1e-4683L, 1e-4684L, 1e-4685L, 1e-4686L, 1e-4687L, 1e-4688L, 1e-4689L, 
-   1e-4690L, 1e-4691L, 1e-4692L, 1e-4693L, 1e-4694L, 1e-4695L, 1e-4696L, 1e-4697L, 1e-4698L, 1e-4699L, 
-   1e-4700L, 1e-4701L, 1e-4702L, 1e-4703L, 1e-4704L, 1e-4705L, 1e-4706L, 1e-4707L, 1e-4708L, 1e-4709L, 
-   1e-4710L, 1e-4711L, 1e-4712L, 1e-4713L, 1e-4714L, 1e-4715L, 1e-4716L, 1e-4717L, 1e-4718L, 1e-4719L, 
-   1e-4720L, 1e-4721L, 1e-4722L, 1e-4723L, 1e-4724L, 1e-4725L, 1e-4726L, 1e-4727L, 1e-4728L, 1e-4729L, 
-   1e-4730L, 1e-4731L, 1e-4732L, 1e-4733L, 1e-4734L, 1e-4735L, 1e-4736L, 1e-4737L, 1e-4738L, 1e-4739L, 
-   1e-4740L, 1e-4741L, 1e-4742L, 1e-4743L, 1e-4744L, 1e-4745L, 1e-4746L, 1e-4747L, 1e-4748L, 1e-4749L, 
-   1e-4750L, 1e-4751L, 1e-4752L, 1e-4753L, 1e-4754L, 1e-4755L, 1e-4756L, 1e-4757L, 1e-4758L, 1e-4759L, 
-   1e-4760L, 1e-4761L, 1e-4762L, 1e-4763L, 1e-4764L, 1e-4765L, 1e-4766L, 1e-4767L, 1e-4768L, 1e-4769L, 
-   1e-4770L, 1e-4771L, 1e-4772L, 1e-4773L, 1e-4774L, 1e-4775L, 1e-4776L, 1e-4777L, 1e-4778L, 1e-4779L, 
-   1e-4780L, 1e-4781L, 1e-4782L, 1e-4783L, 1e-4784L, 1e-4785L, 1e-4786L, 1e-4787L, 1e-4788L, 1e-4789L, 
-   1e-4790L, 1e-4791L, 1e-4792L, 1e-4793L, 1e-4794L, 1e-4795L, 1e-4796L, 1e-4797L, 1e-4798L, 1e-4799L, 
-   1e-4800L, 1e-4801L, 1e-4802L, 1e-4803L, 1e-4804L, 1e-4805L, 1e-4806L, 1e-4807L, 1e-4808L, 1e-4809L, 
-   1e-4810L, 1e-4811L, 1e-4812L, 1e-4813L, 1e-4814L, 1e-4815L, 1e-4816L, 1e-4817L, 1e-4818L, 1e-4819L, 
-   1e-4820L, 1e-4821L, 1e-4822L, 1e-4823L, 1e-4824L, 1e-4825L, 1e-4826L, 1e-4827L, 1e-4828L, 1e-4829L, 
-   1e-4830L, 1e-4831L, 1e-4832L, 1e-4833L, 1e-4834L, 1e-4835L, 1e-4836L, 1e-4837L, 1e-4838L, 1e-4839L, 
-   1e-4840L, 1e-4841L, 1e-4842L, 1e-4843L, 1e-4844L, 1e-4845L, 1e-4846L, 1e-4847L, 1e-4848L, 1e-4849L, 
-   1e-4850L, 1e-4851L, 1e-4852L, 1e-4853L, 1e-4854L, 1e-4855L, 1e-4856L, 1e-4857L, 1e-4858L, 1e-4859L, 
-   1e-4860L, 1e-4861L, 1e-4862L, 1e-4863L, 1e-4864L, 1e-4865L, 1e-4866L, 1e-4867L, 1e-4868L, 1e-4869L, 
-   1e-4870L, 1e-4871L, 1e-4872L, 1e-4873L, 1e-4874L, 1e-4875L, 1e-4876L, 1e-4877L, 1e-4878L, 1e-4879L, 
-   1e-4880L, 1e-4881L, 1e-4882L, 1e-4883L, 1e-4884L, 1e-4885L, 1e-4886L, 1e-4887L, 1e-4888L, 1e-4889L, 
-   1e-4890L, 1e-4891L, 1e-4892L, 1e-4893L, 1e-4894L, 1e-4895L, 1e-4896L, 1e-4897L, 1e-4898L, 1e-4899L, 
-   1e-4900L, 1e-4901L, 1e-4902L, 1e-4903L, 1e-4904L, 1e-4905L, 1e-4906L, 1e-4907L, 1e-4908L, 1e-4909L, 
-   1e-4910L, 1e-4911L, 1e-4912L, 1e-4913L, 1e-4914L, 1e-4915L, 1e-4916L, 1e-4917L, 1e-4918L, 1e-4919L, 
-   1e-4920L, 1e-4921L, 1e-4922L, 1e-4923L, 1e-4924L, 1e-4925L, 1e-4926L, 1e-4927L, 1e-4928L, 1e-4929L, 
-   1e-4930L, 1e-4931L, 1e-4932L, 1e-4933L, 1e-4934L, 1e-4935L, 1e-4936L, 1e-4937L, 1e-4938L, 1e-4939L, 
-   1e-4940L, 1e-4941L, 1e-4942L, 1e-4943L, 1e-4944L, 1e-4945L, 1e-4946L, 1e-4947L, 1e-4948L, 1e-4949L, 
-   1e-4950L
-  };                
+   0.0f, -3.70504577e-21f, 1.70103861e-20f, -8.01947807e-21f, -2.08305194e-20f, -1.08024804e-20f, -6.88464029e-22f, -1.28164552e-20f,
+   -3.04723353e-20f, -1.45401097e-20f, -8.21445601e-21f, -2.29769885e-20f, 1.28271205e-20f, -2.17056216e-20f, -3.15712932e-20f, -3.10609357e-20f,
+   3.15616708e-20f, 1.08416931e-20f, -2.25471777e-20f, -1.74651674e-20f, 3.0337185e-20f, -3.91228028e-20f, -4.15083981e-20f, -1.71229719e-21f,
+   3.71379409e-20f, -3.10243944e-20f, -3.94282909e-20f, 2.01849728e-20f, 2.47126186e-20f, 3.21178561e-20f, 2.47871359e-20f, -1.53797627e-20f,
+   4.27359471e-20f, 4.21921308e-20f, 4.34512192e-20f, -2.32069116e-21f, 2.30660558e-20f, 4.86472794e-21f, 2.11284143e-20f, -1.1506798e-20f,
+   4.38836279e-21f, 9.85581903e-21f, 1.60395685e-20f, -2.82556432e-20f, 2.88674305e-20f, 1.54917859e-20f, 1.42628507e-20f, -1.08211105e-20f,
+   1.91452649e-20f, 1.9277504e-20f, -1.34679948e-20f, -4.69095943e-21f, 3.60709748e-20f, -2.57310185e-20f, -3.2917827e-20f, 1.86536838e-20f,
+   -6.19144083e-21f, -2.4075864e-20f, 2.52181067e-20f, 3.85586559e-20f, 3.28244654e-20f, -1.18589064e-20f, 1.18078239e-20f, -3.00090754e-20f,
+   2.7577914e-20f, -2.34878403e-20f, 2.44911797e-20f, 1.72849083e-20f, 2.49813101e-20f, 2.67584139e-20f, -2.98220809e-20f, 7.0806095e-22f,
+   1.71760387e-20f, 1.44785365e-20f, 3.22840354e-21f, -2.3447729e-21f, 2.37797931e-20f, 5.54548163e-22f, 4.15982587e-21f, -1.92292286e-20f,
+   -2.17427736e-20f, -2.48556223e-20f, -1.25434629e-20f, -3.38467152e-20f, 2.45117344e-21f, 1.6600594e-20f, -8.87168413e-21f, -3.42833891e-20f,
+   -1.92885966e-20f
+  };
+#endif // YA_S__LD_EXACT
 
 static uint64_t const ya_s__powten[20] =
 				{
@@ -3214,28 +4647,69 @@ static uint64_t const ya_s__powten[20] =
 #define ya_s__tento18th UINT64_C(1000000000000000000) /* note this is 10^18 the table entry before the end ! */
 
 
+#ifndef YA_S__LD_EXACT
+#if LDBL_MANT_DIG == 64
+// the exact product a*b is the returned value + *lo (Dekker), each value is split into 2 halves of 32 bits by multiplying with 2^32+1 (Veltkamp),
+//  so a and b must be less than LDBL_MAX/2^32 and the product must not underflow
+static long double ya_s__ldbl_two_prod( long double a, long double b, long double *lo )
+ {
+  long double p = a * b, t, ah, al, bh, bl;
+  t = a * 4294967297.0L;
+  ah = t - (t - a);
+  al = a - ah;
+  t = b * 4294967297.0L;
+  bh = t - (t - b);
+  bl = b - bh;
+  *lo = ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+  return p;
+ }
+#endif
 
-static long double ya_s__raise_to_power10(  long double x, int32_t power )  // power can be +/- 9800 (in fact a bit more than that !)
+static long double ya_s__raise_to_power10(  long double x, int32_t power )  // power can be -4914 to +4969
  {
-  if(power<0) 	
-  	{power = -power;
-  	 if(power>4900)
-  	 	{// do in 2 steps to avoid overflowing table, split at 4900 is a "round figure" well clear of area where we go into denormalised number which are less accurate
-  	 	 x*= ldblnegpowersOf10[4900];
-		 power -=4900;	 
-		}
-	  x*= ldblnegpowersOf10[power]; // * is faster than / and gives very slightly better results in test program
+  int32_t k, j;
+  long double a, b;
+  float c;
+  if(power>=-27 && power<=27) // 10^|power| is exact so one correctly rounded operation does
+  	return (power<0) ? x / ya_s__ldbl_pow10_fine[-power] : x * ya_s__ldbl_pow10_fine[power];
+  if(power<0)
+  	{// 10^power = 10^(-56k) * 10^j with 0 <= j < 56, make x smaller first so the intermediate result cannot overflow
+  	 k = (55 - power) / 56;
+  	 j = power + 56 * k;
+  	 a = ya_s__ldbl_pow10_neg[k];
+  	 b = ya_s__ldbl_pow10_fine[j];
+  	 c = ya_s__ldbl_pow10_neg_rel[k] + ya_s__ldbl_pow10_fine_rel[j];
   	}
   else
-  	{if(power>4900)
-  	 	{// do in 2 steps to avoid overflowing table
-  	 	 x*= ldblpowersOf10[4900];
-		 power -=4900;	 
-		}
-	  x*=ldblpowersOf10[power];
+  	{// make x bigger first so the intermediate result cannot underflow
+  	 k = power / 56;
+  	 j = power - 56 * k;
+  	 a = ya_s__ldbl_pow10_fine[j];
+  	 b = ya_s__ldbl_pow10_pos[k];
+  	 c = ya_s__ldbl_pow10_pos_rel[k] + ya_s__ldbl_pow10_fine_rel[j];
   	}
+#if LDBL_MANT_DIG == 64
+  {// x*a*b exactly as y + yl + l*b, so only the final sum is rounded (plus the tiny error of the corrections for the rounding of the table entries)
+   //  the product with the 10^(+/-56k) entry is scaled by 2^64 and 2^-64 (which is exact) to keep both values in range for ya_s__ldbl_two_prod()
+   long double l, y, yl;
+   if(power<0)
+   	{x = ya_s__ldbl_two_prod(x * 5.42101086242752217003726400434970855712890625e-20L, a * 18446744073709551616.0L, &l);
+   	 y = ya_s__ldbl_two_prod(x, b, &yl);
+   	}
+   else
+   	{x = ya_s__ldbl_two_prod(x, a, &l);
+   	 y = ya_s__ldbl_two_prod(x * 18446744073709551616.0L, b * 5.42101086242752217003726400434970855712890625e-20L, &yl);
+   	}
+   return y + (yl + l * b + y * c);
+  }
+#else
+  (void)c; // the corrections are only valid for a 64 bit mantissa
+  x*= a; // * is faster than / and gives very slightly better results in test program
+  x*= b;
   return x;
+#endif
  }
+#endif // YA_S__LD_EXACT
  
 #else /* LD not defined */
 
@@ -3267,37 +4741,555 @@ static uint64_t const ya_s__powten[20] =
 #define ya_s__tento18th UINT64_C(1000000000000000000) /* note this is 10^18 the table entry before the end ! */
 
 
-static void ya_s__raise_to_power10( double *ohi, double *olo, double d, int32_t power )  // power can be -323 to +350
+// 10^p as a double-double is 10^(+/-23k) from the short tables below times 10^j (0 <= j < 23) which is exact in a double
+static const double ya_s__pow10_exact[23] = /* 10^j for j = 0 to 22, all exact */
+  {
+   1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+   1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+   1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+
+static const double ya_s__pow10_dd_pos[14][2] = /* 10^(23k) for k = 0 to 13 as double-double { hi, lo } */
+  {
+   { 1.0, 0.0 },
+   { 1e+23, 8388608.0 },
+   { 1e+46, 6.860180964052979e+28 },
+   { 1e+69, -7.253143638152923e+52 },
+   { 1e+92, -4.337729697461919e+75 },
+   { 1e+115, -1.5559416129466843e+98 },
+   { 1e+138, -3.2841562489204927e+121 },
+   { 1e+161, -3.774589324822815e+144 },
+   { 1e+184, -1.735666841696913e+167 },
+   { 1e+207, -3.889357755108839e+190 },
+   { 1e+230, -9.956644432600512e+213 },
+   { 1e+253, 6.364129306223241e+236 },
+   { 1e+276, -5.2069140800249854e+259 },
+   { 1e+299, -5.250476025520442e+282 }
+  };
+
+static const double ya_s__pow10_dd_neg[14][2] = /* 10^(-23k) for k = 0 to 13 as double-double { hi, lo } */
+  {
+   { 1.0, 0.0 },
+   { 1e-23, 3.956530198510069e-40 },
+   { 1e-46, -2.2999043453913218e-63 },
+   { 1e-69, 3.650620143794582e-86 },
+   { 1e-92, 1.1875228833981554e-109 },
+   { 1e-115, -5.064490231692858e-132 },
+   { 1e-138, -6.71568372478654e-155 },
+   { 1e-161, -2.8120774630031374e-178 },
+   { 1e-184, -5.777891238658996e-201 },
+   { 1e-207, 7.499710055933455e-224 },
+   { 1e-230, -4.64396689151345e-247 },
+   { 1e-253, -6.369110076296212e-270 },
+   { 1e-276, -9.436808465446355e-293 },
+   { 1e-299, 8.097092e-317 }
+  };
+
+static void ya_s__raise_to_power10( double *ohi, double *olo, double d, int32_t power )  // power can be -299 to +350
 { 
-  double th,tl; // power10
-  if(power<0) 	
-  	{
-	 th=NegPowerOf10_hi[-power];
-	 tl=NegPowerOf10_lo[-power];
+  double ph, pl;// partial result
+  int32_t k, j;
+  if (power>299) // need to do in 3 multiplies rather than 2 as the max exponent for a double is 308 and we may need to multiply by 10^350 here
+  	{// void mult_d_dd( double *xh, double *xl,double a,double bh, double bl);  // multiplies a and double double  b to give double double "x"
+  	 mult_d_dd(&ph,&pl,d,ya_s__pow10_dd_pos[13][0],ya_s__pow10_dd_pos[13][1]);// 10^299*d
+  	 power-=299;
+  	 k=power/23;
+  	 j=power-23*k;
+  	 // void mult_dd_dd( double *xh, double *xl,double ah, double al,double bh, double bl);  // multiplies double double a and b to give double double "x"
+  	 mult_dd_dd(&ph,&pl,ph,pl,ya_s__pow10_dd_pos[k][0],ya_s__pow10_dd_pos[k][1]);
   	}
-  else if (power>300) // need to do in 2 multiplies rather than 1 as the max exponent for a double is 308 and we may need to multiply by 10^350 here
-  	{double ph, pl;// partial result
-	 th=PosPowerOf10_hi[300];
-	 tl=PosPowerOf10_lo[300];   
-	 // void mult_d_dd( double *xh, double *xl,double a,double bh, double bl);  // multiplies a and double double  b to give double double "x"
-     mult_d_dd(&ph,&pl,d,th,tl);// th,l*d
-	 th=PosPowerOf10_hi[power-300];
-	 tl=PosPowerOf10_lo[power-300];     	 
-	 // void mult_dd_dd( double *xh, double *xl,double ah, double al,double bh, double bl);  // multiplies double double a and b to give double double "x"
-     mult_dd_dd(ohi,olo,th,tl,ph,pl);
-     return;
+  else if(power>=0 && power<=22)
+  	{mult_d_dd(ohi,olo,d,ya_s__pow10_exact[power],0.0); // only 1 multiply needed
+  	 return;
   	}
   else
-    {
-	 th=PosPowerOf10_hi[power];
-	 tl=PosPowerOf10_lo[power];	
-	}
-  // now need to compute ohi/lo=d*th,l only using doubles 
-  // void mult_d_dd( double *xh, double *xl,double a,double bh, double bl);  // multiplies a and double double  b to give double double "x"
-  mult_d_dd(ohi,olo,d,th,tl);
+  	{const double *t;
+  	 if(power<0)
+  		{k=(22-power)/23; // 10^power = 10^(-23k) * 10^j
+  		 j=power+23*k;
+  		 t=ya_s__pow10_dd_neg[k];
+  		}
+  	 else
+  		{k=power/23;
+  		 j=power-23*k;
+  		 t=ya_s__pow10_dd_pos[k];
+  		}
+  	 if(j==0)
+  		{mult_d_dd(ohi,olo,d,t[0],t[1]);
+  		 return;
+  		}
+  	 mult_d_dd(&ph,&pl,d,t[0],t[1]);
+  	}
+  // now need to compute ohi/lo=ph,pl*10^j only using doubles, 10^j is exact 
+  mult_d_dd(ohi,olo,ya_s__pow10_exact[j],ph,pl);
+}
+
+#ifdef YA_S__DBL_EXACT
+static inline uint64_t ya_s__umul128(uint64_t a, uint64_t b, uint64_t *hi);
+static inline int32_t ya_s__pow5bits(int32_t e);
+// Exact alternative to ya_s__raise_to_power10() + ddtoU64(): sets *bits = floor(d*10^p) for a finite d > 0 using the 125 bit power of 5 (p >= 0) or inverse power of 5 (p < 0)
+//  from table5.h and a single 64x128 bit multiply, d*10^p = m*2^e2*5^p*2^p so the power of 2 just changes the shift. *rnd describes the part discarded: 0 nothing,
+//  1 less than a half, 2 exactly a half, 3 more than a half. Table entries for 5^p (p>53) are rounded down and those for 5^-p are rounded up, so the true product is
+//  within m of the computed one. In that case the value is never an integer or a half (unless m is a multiple of 5^-p which is done exactly),
+//  so the result is exact unless the product lies within m of a boundary. If it does 0 is returned and the caller uses the double-double scaling instead.
+static int ya_s__pow5_scale(uint64_t *bits, uint32_t *rnd, double d, int32_t p)
+{
+   uint64_t ieee, m, w0, w1, w2, h0, c, r_hi, half_hi, mask;
+   const uint64_t *f;
+   int32_t e2, j;
+   int table_low = 0, table_high = 0; // table entry is rounded down/up
+   memcpy(&ieee, &d, sizeof(ieee));
+   m = ieee & ((UINT64_C(1) << 52) - 1);
+   e2 = (int32_t)((ieee >> 52) & 0x7ff);
+   if (e2 == 0) { // denormal - normalise so m is always 53 bits
+      e2 = 1;
+      while (m < (UINT64_C(1) << 52)) {
+         m <<= 1;
+         --e2;
+      }
+   } else
+      m |= UINT64_C(1) << 52;
+   e2 -= 1075; // d = m*2^e2
+   if (p >= 0) {
+      if (p > 342)
+         return 0;
+      f = ya_s__pow5_split[p];
+      j = YA_S__POW5_BITCOUNT - ya_s__pow5bits(p) - e2 - p;
+      table_low = (p > 53); // 5^53 < 2^125 so smaller powers are exact
+   } else {
+      if (-p <= 22) {
+         uint64_t p5 = (-p <= 19) ? ya_s__powten[-p] >> -p : (ya_s__powten[19] >> 19) * (ya_s__powten[-p - 19] >> (-p - 19)); // 5^-p
+         if (m % p5 == 0) { // d*10^p = (m/5^-p)*2^(e2+p) exactly
+            m /= p5;
+            j = -(e2 + p);
+            if (j <= 0) {
+               if (j <= -64 || (m >> (64 + j))) // result would be >= 2^64
+                  return 0;
+               *bits = m << -j;
+               *rnd = 0;
+               return 1;
+            }
+            if (j > 63)
+               return 0;
+            *bits = m >> j;
+            w0 = m & ((UINT64_C(1) << j) - 1);
+            h0 = UINT64_C(1) << (j - 1);
+            *rnd = (w0 == 0) ? 0 : (w0 < h0) ? 1 : (w0 == h0) ? 2 : 3;
+            return 1;
+         }
+      }
+      if (-p > 341)
+         return 0;
+      f = ya_s__pow5_inv_split[-p];
+      j = ya_s__pow5bits(-p) - 1 + YA_S__POW5_INV_BITCOUNT - e2 - p;
+      table_high = 1;
+   }
+   if (j < 65 || j > 127)
+      return 0;
+   // 192 bit product w2:w1:w0 = m * f
+   w0 = ya_s__umul128(m, f[0], &h0);
+   w1 = ya_s__umul128(m, f[1], &w2);
+   w1 += h0;
+   c = (w1 < h0);
+   w2 += c;
+   if (w2 >> (j - 64)) // result does not fit in 64 bits
+      return 0;
+   *bits = (w2 << (128 - j)) | (w1 >> (j - 64));
+   // remainder is r_hi:w0 (j bits), compare it with a half = half_hi:0
+   mask = (UINT64_C(1) << (j - 64)) - 1;
+   r_hi = w1 & mask;
+   half_hi = UINT64_C(1) << (j - 65);
+   if (table_low) { // true remainder is in (r, r+m)
+      if (w0 > ~m && (r_hi == half_hi - 1 || r_hi == mask))
+         return 0;
+      *rnd = (r_hi < half_hi) ? 1 : 3;
+   } else if (table_high) { // true remainder is in [r-m, r)
+      if (w0 <= m && (r_hi == 0 || r_hi == half_hi))
+         return 0;
+      *rnd = (r_hi < half_hi) ? 1 : 3;
+   } else
+      *rnd = (r_hi == 0 && w0 == 0) ? 0 : (r_hi < half_hi) ? 1 : (r_hi == half_hi && w0 == 0) ? 2 : 3;
+   return 1;
 }
+#endif
 #endif // LD
 
+#ifdef YA_S__EXACT
+// Exact conversion of long doubles (x87 64 bit mantissa) and __float128's (113 bit mantissa) to decimal, used when YA_S__LD_EXACT or YA_S__Q_EXACT are defined.
+// The value m*2^e2 is scaled by 10^s = 2^s*5^s in a single step using integer arithmetic: 5^s is an exact 64 bit power of 5 (from ya_s__pow5_u64[])
+//  times a 192 bit power of 5^27 (from ya_s__pow5x27_pos[] or ya_s__pow5x27_neg[] in table5.h, long doubles only use the top 128 bits), the product gives the integer and
+//  fractional parts of the scaled value. The table values are rounded down so the result can only be slightly too small, in the rare cases where this could change the rounding
+//  an exact test is done (ya_s__exact_is_int() or the big number comparison ya_s__exact_cmp()). This means the result is always correctly rounded (to even)
+//  for up to YA_S__LD_DIGITS (long double) or YA_S__Q_DIGITS (__float128) significant digits, which is more than the 21 or 36 digits needed to uniquely identify a value.
+#define YA_S__LD_DIGITS 32 /* max significant digits generated for long doubles, 10^33 < 2^110 so the scaled value and the rounding all fit in 128 bits */
+#define YA_S__LD_ERR (UINT64_C(1)<<48) /* max error in the fractional part (in units of 2^-64) due to table rounding is X*2^-127*2^64 < 2^47 for X < 10^33 */
+#define YA_S__Q_DIGITS 36 /* max significant digits generated for __float128's, 10^37 < 2^123 */
+#define YA_S__Q_ERR (UINT64_C(1)<<8) /* max error in the fractional part is X*2^-191*2^64 < 2^-4 for X < 10^37 */
+#define YA_S__EXACT_BIGWORDS 372 /* 32 bit words needed for the big number in ya_s__exact_cmp(), up to 2^113*5^5002 < 2^11730 */
+
+static inline __uint128_t ya_s__exact_pow10(int32_t n) // returns 10^n for 0 <= n <= 38
+{
+   if (n < 20)
+      return ya_s__powten[n];
+   return (__uint128_t)ya_s__powten[19] * ya_s__powten[n - 19];
+}
+
+static inline __uint128_t ya_s__exact_div32(__uint128_t d, uint32_t v, uint32_t *rem) // returns d/v and the remainder in *rem using 64 bit divisions (128 bit divisions are slow library calls)
+{
+   uint64_t hi = (uint64_t)(d >> 64), lo = (uint64_t)d, r, qh, q1, q0;
+   qh = hi / v;
+   r = ((hi % v) << 32) | (lo >> 32);
+   q1 = r / v;
+   r = ((r % v) << 32) | (uint32_t)lo;
+   q0 = r / v;
+   *rem = (uint32_t)(r % v);
+   return ((__uint128_t)qh << 64) | (q1 << 32) | q0;
+}
+
+static inline uint64_t ya_s__exact_bits64(uint64_t const *w, int32_t nw, int32_t p) // returns bits p..p+63 of the number w[0..nw-1] (bits outside w are 0), p>=0
+{
+   int32_t i = p >> 6, b = p & 63;
+   uint64_t lo = (i < nw) ? w[i] : 0, hi = (i + 1 < nw) ? w[i + 1] : 0;
+   return b ? ((lo >> b) | (hi << (64 - b))) : lo;
+}
+
+static inline void ya_s__exact_mul(uint64_t *w, uint64_t const *a, int32_t na, uint64_t const *b, int32_t nb) // w[0..na+nb-1] = a*b
+{
+   int32_t i, j;
+   for (j = 0; j < nb; ++j)
+      w[j] = 0;
+   for (i = 0; i < na; ++i) {
+      uint64_t c = 0;
+      for (j = 0; j < nb; ++j) {
+         __uint128_t t = (__uint128_t)a[i] * b[j] + w[i + j] + c;
+         w[i + j] = (uint64_t)t;
+         c = (uint64_t)(t >> 64);
+      }
+      w[i + nb] = c;
+   }
+}
+
+static inline int ya_s__exact_is_int(__uint128_t m, int32_t e2, int32_t s, int32_t h) // returns 1 if m*2^(e2+h)*10^s is an integer, m!=0
+{
+   int32_t t = e2 + s + h;
+   if (s < 0) {
+      if (s < -48)
+         return 0; // 5^-s > m as m < 2^113 < 5^49
+      if (m % ((s >= -27) ? (__uint128_t)ya_s__pow5_u64[-s] : (__uint128_t)ya_s__pow5_u64[27] * ya_s__pow5_u64[-s - 27]))
+         return 0;
+   }
+   return t >= 0 || (t > -128 && (m & ((((__uint128_t)1) << -t) - 1)) == 0);
+}
+
+static int32_t ya_s__big_mul(uint32_t *a, int32_t n, uint32_t f) // a[0..n-1]*=f, returns new length
+{
+   uint64_t c = 0;
+   int32_t i;
+   for (i = 0; i < n; ++i) {
+      c += (uint64_t)a[i] * f;
+      a[i] = (uint32_t)c;
+      c >>= 32;
+   }
+   if (c)
+      a[n++] = (uint32_t)c;
+   return n;
+}
+
+static int32_t ya_s__big_set(uint32_t *a, __uint128_t v, int32_t p5) // a=v*5^p5, returns length in words
+{
+   int32_t n = 0;
+   while (v) {
+      a[n++] = (uint32_t)v;
+      v >>= 32;
+   }
+   for (; p5 >= 13; p5 -= 13)
+      n = ya_s__big_mul(a, n, UINT32_C(1220703125)); // 5^13
+   if (p5)
+      n = ya_s__big_mul(a, n, (uint32_t)ya_s__pow5_u64[p5]);
+   return n;
+}
+
+static inline uint32_t ya_s__big_word(uint32_t const *a, int32_t n, int32_t sh, int32_t i) // returns word i of a[0..n-1]*2^sh, sh>=0
+{
+   int32_t j = i - (sh >> 5), b = sh & 31;
+   uint32_t w = (j >= 0 && j < n) ? a[j] : 0;
+   if (b && j >= 1 && j <= n)
+      return (w << b) | (a[j - 1] >> (32 - b));
+   return w << b;
+}
+
+__attribute__((noinline)) static int ya_s__exact_cmp(__uint128_t m, int32_t e2, int32_t s, int32_t h, __uint128_t b) // returns the sign of m*2^(e2+h)*10^s - b, only used in rare cases
+{
+   // only the side with the power of 5 is put in a big number, the other side (at most 128 bits) and the powers of 2 are applied while comparing
+   uint32_t x[YA_S__EXACT_BIGWORDS], y[4];
+   int32_t t = e2 + s + h, nx, ny, sx, sy, i, bx, by, r;
+   if (s >= 0) {
+      nx = ya_s__big_set(x, m, s);
+      ny = ya_s__big_set(y, b, 0);
+   } else {
+      nx = ya_s__big_set(x, b, -s);
+      ny = ya_s__big_set(y, m, 0);
+      t = -t; // now comparing b*5^-s*2^sx with m*2^sy
+   }
+   sx = t > 0 ? t : 0;
+   sy = t < 0 ? -t : 0;
+   bx = nx ? 32 * nx - __builtin_clz(x[nx - 1]) + sx : 0; // bit lengths
+   by = ny ? 32 * ny - __builtin_clz(y[ny - 1]) + sy : 0;
+   r = 0;
+   if (bx != by)
+      r = bx > by ? 1 : -1;
+   else
+      for (i = (bx + 31) >> 5; i-- && r == 0;) { // compare from the top word down
+         uint32_t wx = ya_s__big_word(x, nx, sx, i), wy = ya_s__big_word(y, ny, sy, i);
+         if (wx != wy)
+            r = wx > wy ? 1 : -1;
+      }
+   return s >= 0 ? r : -r;
+}
+
+static char *ya_s__exact_u64_to_str(char *out, uint64_t v, int32_t mind) // write v as decimal ending just before out, at least mind digits (zero padded), returns start of digits
+{
+   char *o = out - mind;
+#ifdef YA_SP_NO_DIGITPAIR
+   while (v >= 10) {
+      *--out = (char)(v % 10) + '0';
+      v /= 10;
+   }
+#else
+   while (v >= 10) {
+      out -= 2;
+      *(uint16_t *)out = *(uint16_t *)&ya_s__digitpair.pair[(v % 100) * 2];
+      v /= 100;
+   }
+#endif
+   if (v)
+      *--out = (char)v + '0';
+   while (out > o)
+      *--out = '0';
+   return out;
+}
+
+// core of the exact conversion, arguments and results are the same as ya_s__real_to_str() but the (non-zero, finite) value is m*2^e2 with the top bit of m at bit mbits-1,
+//  mbits is 64 for long doubles and 113 for __float128's. ng is the sign which is just returned.
+static int32_t ya_s__exact_to_str(char const **start, uint32_t *len, char *out, int32_t *decimal_pos, __uint128_t m, int32_t e2, int32_t mbits, int32_t ng, uint32_t frac_digits)
+{
+   struct ya_s__pow5_192 const *c;
+   uint64_t fine, fr, sticky, err, a[3], w[6];
+   __uint128_t d, q, p;
+   int32_t k, n, s, sh, nw, nmax, dg, tens, want, j, up;
+   char *o;
+   // k = floor(log10(2^(e2+mbits-1))) so floor(log10(value)) is k or k+1 (1292913986/2^32 is log10(2) rounded down, exact for |e2+mbits-1| < 16600)
+   k = (int32_t)(((int64_t)(e2 + mbits - 1) * 1292913986) >> 32);
+   nmax = (mbits > 64) ? YA_S__Q_DIGITS : YA_S__LD_DIGITS;
+   // n digits are needed, scale value by 10^s so the integer part has n or n+1 digits
+   if (frac_digits & 0x80000000)
+      n = (int32_t)(frac_digits & 0x7ffffff) + 1;
+   else
+      n = k + 2 + (int32_t)frac_digits;
+   if (n > nmax)
+      n = nmax;
+   else if (n < 1)
+      n = 1;
+   s = n - 1 - k;
+   if (s >= 0) {
+      c = &ya_s__pow5x27_pos[s / 27];
+      fine = ya_s__pow5_u64[s % 27];
+   } else {
+      j = (26 - s) / 27; // 5^s = 5^(-27j) * 5^(27j+s)
+      c = &ya_s__pow5x27_neg[j];
+      fine = ya_s__pow5_u64[27 * j + s];
+   }
+   // w = m * fine * c
+   p = (__uint128_t)(uint64_t)m * fine;
+   a[0] = (uint64_t)p;
+   if (mbits <= 64) {
+      a[1] = (uint64_t)(p >> 64);
+      ya_s__exact_mul(w, a, 2, c->w + 1, 2); // top 128 bits of c is enough for long doubles
+      nw = 4;
+      sh = -(e2 + s + c->e + 64);
+      err = YA_S__LD_ERR;
+   } else {
+      p = (p >> 64) + (__uint128_t)(uint64_t)(m >> 64) * fine;
+      a[1] = (uint64_t)p;
+      a[2] = (uint64_t)(p >> 64);
+      ya_s__exact_mul(w, a, 3, c->w, 3);
+      nw = 6;
+      sh = -(e2 + s + c->e);
+      err = YA_S__Q_ERR;
+   }
+   // scaled value X = w*2^-sh, split into integer d, 64 bits of fraction fr and sticky (!=0 if any lower bits are set)
+   d = ((__uint128_t)ya_s__exact_bits64(w, nw, sh + 64) << 64) | ya_s__exact_bits64(w, nw, sh);
+   fr = ya_s__exact_bits64(w, nw, sh - 64);
+   j = (sh - 64) >> 6;
+   sticky = w[j] & ((UINT64_C(1) << ((sh - 64) & 63)) - 1);
+   while (j--)
+      sticky |= w[j];
+   // X may be slightly too small, fix this if it matters (i.e. we are just below an integer or half or have a possibly exact integer)
+   if (fr >= ~(uint64_t)0 - err) {
+      if (ya_s__exact_is_int(m, e2, s, 0)) {
+         ++d;
+         fr = sticky = 0;
+      } else if (ya_s__exact_cmp(m, e2, s, 0, d + 1) > 0) {
+         ++d;
+         fr = 0;
+         sticky = 1;
+      }
+   } else if (fr >= (UINT64_C(1) << 63) - err && fr <= (UINT64_C(1) << 63)) {
+      sticky = 1;
+      if (ya_s__exact_is_int(m, e2, s, 1)) {
+         fr = UINT64_C(1) << 63; // exactly a half
+         sticky = 0;
+      } else if (ya_s__exact_cmp(m, e2, s, 1, 2 * d + 1) > 0)
+         fr = UINT64_C(1) << 63; // just above a half
+      else
+         fr = (UINT64_C(1) << 63) - 1; // just below a half
+   } else if (fr < err) {
+      if (ya_s__exact_is_int(m, e2, s, 0))
+         fr = sticky = 0;
+      else
+         sticky = 1;
+   }
+   dg = n + (d >= ya_s__exact_pow10(n));
+   tens = k + 1 + dg - n; // digits before the decimal point
+   // now do the rounding in integer land
+   if (frac_digits & 0x80000000)
+      want = (int32_t)(frac_digits & 0x7ffffff) + 1;
+   else
+      want = tens + (int32_t)frac_digits;
+   if (want > n)
+      want = n;
+   if (want <= 0) {
+      // nothing left before the rounding position, the result is 0 or 1 in the last place
+      p = ya_s__exact_pow10(dg - 1) * 5;
+      if (want < 0 || d < p || (d == p && (fr | sticky) == 0)) {
+         *decimal_pos = 1;
+         *start = out;
+         out[0] = '0';
+         *len = 1;
+         return ng;
+      }
+      q = 1; // rounds up to 1 in the position before the first digit
+      ++tens;
+   } else {
+      j = dg - want;
+      if (j == 0) {
+         q = d;
+         up = fr > (UINT64_C(1) << 63) || (fr == (UINT64_C(1) << 63) && (sticky || (q & 1)));
+      } else {
+         if (j == 1) { // the usual case
+            uint32_t r;
+            q = ya_s__exact_div32(d, 10, &r);
+            d = r;
+         } else {
+            p = ya_s__exact_pow10(j);
+            q = d / p;
+            d -= q * p;
+         }
+         p = ya_s__exact_pow10(j) >> 1;
+         up = d > p || (d == p && (fr || sticky || (q & 1))); /* round to even, as used in IEEE std 754 */
+      }
+      if (up) {
+         ++q;
+         if (q == ya_s__exact_pow10(want)) {
+            q /= 10;
+            ++tens;
+         }
+      }
+   }
+   // convert to a string (9 digits at a time while q does not fit in 64 bits) and kill trailing zeros
+   o = out + 64;
+   while (q >> 64) {
+      uint32_t r;
+      q = ya_s__exact_div32(q, 1000000000, &r);
+      o = ya_s__exact_u64_to_str(o, r, 9);
+   }
+   o = ya_s__exact_u64_to_str(o, (uint64_t)q, 1);
+   n = (int32_t)(out + 64 - o);
+   while (o[n - 1] == '0')
+      --n;
+   *decimal_pos = tens;
+   *start = o;
+   *len = (uint32_t)n;
+   return ng;
+}
+#endif // YA_S__EXACT
+
+#ifdef YA_S__Q_EXACT
+// as ya_s__real_to_str() below but for __float128's (IEEE quad precision), using the exact conversion above
+static int32_t ya_s__real_to_str_q(char const **start, uint32_t *len, char *out, int32_t *decimal_pos, __float128 value, uint32_t frac_digits)
+{
+   __uint128_t b, m;
+   int32_t ng, ex, n;
+   memcpy(&b, &value, sizeof(b)); // sign, 15 bit exponent and 112 bits of mantissa (leading bit is implicit)
+   ng = (int32_t)(b >> 127);
+   ex = (int32_t)(b >> 112) & 0x7fff;
+   m = b & ((((__uint128_t)1) << 112) - 1);
+   if (ex == 0x7fff) {
+      *start = m ? "nan" : "inf";
+      *decimal_pos = YA_S__SPECIAL;
+      *len = 3;
+#ifndef YA_SP_SIGNED_NANS
+      if (m)
+         return 0; // nan is always positive
+#endif
+      return ng;
+   } else if (ex == 0 && m == 0) {
+      *decimal_pos = 1;
+      *start = out;
+      out[0] = '0';
+      *len = 1;
+      return ng;
+   }
+   if (ex)
+      m |= ((__uint128_t)1) << 112;
+   else
+      ex = 1; // denormal
+   // normalise so the top bit of m is bit 112
+   n = ((m >> 64) ? __builtin_clzll((uint64_t)(m >> 64)) : 64 + __builtin_clzll((uint64_t)m)) - 15;
+   return ya_s__exact_to_str(start, len, out, decimal_pos, m << n, ex - 16383 - 112 - n, 113, ng, frac_digits);
+}
+#endif // YA_S__Q_EXACT
+
+#ifdef YA_S__LD_EXACT
+// given a float value, returns the significant bits in bits, and the position of the
+//   decimal point in decimal_pos.  +/-INF and NAN are specified by special values
+//   returned in the decimal_pos parameter.
+// frac_digits is absolute normally, but if you want from first significant digits (got %g and %e), or in 0x80000000
+// This version is for x87 long doubles and uses the exact conversion above.
+static int32_t ya_s__real_to_str(char const **start, uint32_t *len, char *out, int32_t *decimal_pos, long double value, uint32_t frac_digits)
+{
+   uint64_t m;
+   uint16_t se;
+   int32_t ng, n;
+   memcpy(&m, &value, sizeof(m)); // x87 format: 64 bit mantissa (with explicit leading bit) then sign and 15 bit exponent
+   memcpy(&se, (char *)&value + 8, sizeof(se));
+   ng = se >> 15;
+   if (isnan(value)) {
+      *start = "nan";
+      *decimal_pos = YA_S__SPECIAL;
+      *len = 3;
+#ifdef YA_SP_SIGNED_NANS
+      return ng;
+#else
+      return 0; // nan is always positive
+#endif
+   } else if (isinf(value)) {
+      *start = "inf";
+      *decimal_pos = YA_S__SPECIAL;
+      *len = 3;
+      return ng;
+   } else if (m == 0) {
+      *decimal_pos = 1;
+      *start = out;
+      out[0] = '0';
+      *len = 1;
+      return ng;
+   }
+   // value is m*2^e2 with m normalised so 2^63 <= m < 2^64 (this also handles denormals)
+   n = __builtin_clzll(m);
+   return ya_s__exact_to_str(start, len, out, decimal_pos, m << n, (int32_t)((se & 0x7fff) ? (se & 0x7fff) : 1) - 16383 - 63 - n, 64, ng, frac_digits);
+}
+#else // not YA_S__LD_EXACT
 // given a float value, returns the significant bits in bits, and the position of the
 //   decimal point in decimal_pos.  +/-INF and NAN are specified by special values
 //   returned in the decimal_pos parameter.
@@ -3307,6 +5299,7 @@ static int32_t ya_s__real_to_str(char const **start, uint32_t *len, char *out, i
 {
    long double d;
    uint64_t bits = 0; // was int64
+   uint32_t rnd = 0; // part of the scaled value discarded in bits, always 0 here as rintl() rounds (see ya_s__pow5_scale())
    int32_t e, ng, tens;
 
 	int expo;
@@ -3344,32 +5337,32 @@ static int32_t ya_s__real_to_str(char const **start, uint32_t *len, char *out, i
 
 // find the decimal exponent as well as the decimal bits of the value
 	{
-      // log10 estimate 
-      tens = expo; 
-	  tens = (tens < 0) ? ((tens * 1233) / 4096) : (((tens * 1233) / 4096) + 1); // this seems to give correct exponent
-	  tens+=1;// this makes no difference to result but makes code slightly faster on average by minimising the number of loops required below
-	  for(int i=0;i<10;++i)
-	  	{// put in a for loop so cannot get stuck forever (but we always break out of loop rather than letting it terminate)
-	  	 long double l10=rintl(ya_s__raise_to_power10( d, 18-tens ));
-	  	 if(i>3 && l10>=(long double)ya_s__powten[18])
-		   	{ bits=l10;
-		      break;// not ideal but OK to stop in case we are bouncing +/-1
-			}	  	 	
-	  	 if(l10<(long double)ya_s__powten[18]) tens--; // too small need to increase
-	  	 else if(l10>(long double)ya_s__powten[19]) tens++; // too big need to decrease
-	  	 else 
-		   	{ bits=l10;
-		      break;// in range - done
-			}
-	  	}
-      if ( ((uint64_t)bits) >= ya_s__tento18th ) // note ya_s__tento18th = 10^18, an unsigned can hold 1.8e19 so we can be off by a power of 10 without overflowing mantissa 
-	  	++tens; // check if we undershot
+      // tens = floor(log10(d)) is floor(expo*log10(2)) or one more, scaling to 19 digits with the smaller value tells which
+      // 1292913986 is floor(log10(2)*2^32), this is exact for all long double exponents
+      long double l10;
+      tens = (int32_t)(((int64_t)expo * INT64_C(1292913986)) >> 32);
+      l10 = ya_s__raise_to_power10(d, 18 - tens);
+      if (l10 >= (long double)ya_s__powten[19]) // 20 digits, so tens was one too small
+         {
+          ++tens;
+          l10 = ya_s__raise_to_power10(d, 18 - tens);
+         }
+      // so the value scaled to 19 digits is in [10^18,10^19) apart from errors of a few ulps when d is very close to a power of 10
+      l10 = rintl(l10);
+      if (l10 < (long double)ya_s__powten[18])
+         bits = ya_s__powten[18];
+      else if (l10 >= (long double)ya_s__powten[19])
+         { bits = ya_s__powten[18]; ++tens; }
+      else
+         bits = (uint64_t)l10;
+      ++tens; // decimal point is after the first tens digits
     }	  	      
 #else // not LD
 static int32_t ya_s__real_to_str(char const **start, uint32_t *len, char *out, int32_t *decimal_pos, double value, uint32_t frac_digits)
 {
    double d;
    uint64_t bits = 0; 
+   uint32_t rnd = 0; // part of the scaled value discarded in bits (see ya_s__pow5_scale())
    int32_t e, ng, tens;
    int expo;
    d = value;
@@ -3411,11 +5404,16 @@ static int32_t ya_s__real_to_str(char const **start, uint32_t *len, char *out, i
 	  double ph, pl;
 	  tens = (tens < 0) ? ((tens * 617) / 2048) : (((tens * 1233) / 4096) + 1);
       // move the significant bits into position and stick them into an int
-      ya_s__raise_to_power10(&ph, &pl, d, 18 - tens);
+#ifdef YA_S__DBL_EXACT
+      if (!ya_s__pow5_scale(&bits, &rnd, d, 18 - tens))
+#endif
+      {
+       ya_s__raise_to_power10(&ph, &pl, d, 18 - tens);
 
-      // get full as much precision from double-double as possible
-	  // uint64_t ddtoU64(double xh,double xl)  // convert double double to uint64
-	  bits=ddtoU64(ph,pl);    
+       // get full as much precision from double-double as possible
+	   // uint64_t ddtoU64(double xh,double xl)  // convert double double to uint64
+	   bits=ddtoU64(ph,pl);    
+      }
 
       // check if we undershot
       if (((uint64_t)bits) >= ya_s__tento18th)
@@ -3441,7 +5439,7 @@ static int32_t ya_s__real_to_str(char const **start, uint32_t *len, char *out, i
             goto noround;
          r = ya_s__powten[e];
         /* round to even, as used in IEEE std 754 */
-		if((bits%r)==r/2) // == 0.5
+		if((bits%r)==r/2 && rnd==0) // == 0.5 (if rnd!=0 the value is a little above 0.5)
 			{if((bits/r)&1) bits += (r/2);  // round to even
 			}
 		else
@@ -3450,9 +5448,17 @@ static int32_t ya_s__real_to_str(char const **start, uint32_t *len, char *out, i
          if ((uint64_t)bits >= ya_s__powten[dg])
             ++tens;
          bits /= r;
+         rnd = 0; // discarded part has been taken into account
       }
    noround:;
    }
+   if (rnd == 3 || (rnd == 2 && (bits & 1))) { // round the discarded part of the scaled value to even
+      ++bits;
+      if (ya_s__u64_digits(bits) != ya_s__u64_digits(bits - 1)) { // 999 -> 1000
+         ++tens;
+         bits /= 10;
+      }
+   }
 
    // kill long trailing runs of zeros
    if (bits) {
@@ -3525,6 +5531,231 @@ static int32_t ya_s__real_to_str(char const **start, uint32_t *len, char *out, i
    *len = e;
    return ng;
 }
+#endif // YA_S__LD_EXACT
+
+// shortest round trip conversion of a double (used by %r) using the Ryu algorithm [Ulf Adams, "Ryu: fast float-to-string conversion", PLDI 2018]
+// everything is done with exact integer arithmetic, the result is the shortest digit string that converts back to exactly value,
+//  and when there is more than 1 such string the one closest to value is picked (ties to even).
+// Arguments and results are the same as ya_s__real_to_str() (digits are written to just below out+64), but trailing zeros are never generated.
+static inline uint64_t ya_s__umul128(uint64_t a, uint64_t b, uint64_t *hi) // returns low 64 bits of a*b, high 64 bits in *hi
+{
+#ifdef __SIZEOF_INT128__
+   __uint128_t p = (__uint128_t)a * b;
+   *hi = (uint64_t)(p >> 64);
+   return (uint64_t)p;
+#else
+   uint64_t al = (uint32_t)a, ah = a >> 32, bl = (uint32_t)b, bh = b >> 32;
+   uint64_t ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+   uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+   *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+   return (mid << 32) | (uint32_t)ll;
+#endif
+}
+
+// (m * mul) >> j where mul is a 125 bit table entry, m is at most 55 bits and 64 < j < 128
+static inline uint64_t ya_s__mulshift64(uint64_t m, const uint64_t *mul, int32_t j)
+{
+   uint64_t h0, h1, l1, sum_hi;
+   ya_s__umul128(m, mul[0], &h0);
+   l1 = ya_s__umul128(m, mul[1], &h1);
+   sum_hi = h1 + ((l1 + h0) < l1); // 128 bit (h1:l1) + h0
+   l1 += h0;
+   j -= 64;
+   if (j >= 64)
+      return sum_hi >> (j - 64);
+   return (sum_hi << (64 - j)) | (l1 >> j);
+}
+
+static inline int32_t ya_s__pow5bits(int32_t e) // number of bits in 5^e, for 0 <= e <= 3528 (1 for e==0)
+{
+   return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+}
+
+static inline int32_t ya_s__log10pow2(int32_t e) // floor(log10(2^e)) for 0 <= e <= 1650
+{
+   return (int32_t)(((uint32_t)e * 78913) >> 18);
+}
+
+static inline int32_t ya_s__log10pow5(int32_t e) // floor(log10(5^e)) for 0 <= e <= 2620
+{
+   return (int32_t)(((uint32_t)e * 732923) >> 20);
+}
+
+static inline int ya_s__multiple_of_pow5(uint64_t v, int32_t p) // true if v is divisible by 5^p
+{
+   int32_t count = 0;
+   while (v % 5 == 0) {
+      v /= 5;
+      ++count;
+   }
+   return count >= p;
+}
+
+static int32_t ya_s__shortest_to_str(char const **start, uint32_t *len, char *out, int32_t *decimal_pos, double value)
+{
+   uint64_t ieee, mant, m2, mv, vr, vp, vm, output;
+   int32_t e2, e10, removed = 0, ng, expo, n;
+   uint32_t mmshift;
+   int accept_bounds, vm_tz = 0, vr_tz = 0;
+   uint8_t last_removed = 0;
+
+   memcpy(&ieee, &value, sizeof(ieee));
+   ng = (int32_t)(ieee >> 63);
+   mant = ieee & ((UINT64_C(1) << 52) - 1);
+   expo = (int32_t)((ieee >> 52) & 0x7ff);
+   if (expo == 0x7ff) {
+      *start = mant ? "nan" : "inf";
+      *decimal_pos = YA_S__SPECIAL;
+      *len = 3;
+#ifndef YA_SP_SIGNED_NANS
+      if (mant)
+         return 0; // nan is always positive
+#endif
+      return ng;
+   }
+   if (expo == 0 && mant == 0) {
+      *decimal_pos = 1;
+      *start = out;
+      out[0] = '0';
+      *len = 1;
+      return ng;
+   }
+   if (expo == 0) { // denormal
+      e2 = 1 - 1023 - 52 - 2;
+      m2 = mant;
+   } else {
+      e2 = expo - 1023 - 52 - 2;
+      m2 = (UINT64_C(1) << 52) | mant;
+   }
+   accept_bounds = (m2 & 1) == 0; // round to even when parsing so the bounds themselves convert back to value
+   // the exact value is mv*2^e2, the halfway points to the neighbouring doubles are mp=mv+2 and mm=mv-1-mmshift (scaled by 2^e2)
+   mv = 4 * m2;
+   mmshift = (mant != 0 || expo <= 1);
+
+   // convert mv, mp and mm to decimal (vr,vp,vm * 10^e10), noting if any digits removed by the conversion were all zero
+   if (e2 >= 0) {
+      int32_t q = ya_s__log10pow2(e2) - (e2 > 3);
+      int32_t k = YA_S__POW5_INV_BITCOUNT + ya_s__pow5bits(q) - 1;
+      int32_t i = -e2 + q + k;
+      e10 = q;
+      vr = ya_s__mulshift64(4 * m2, ya_s__pow5_inv_split[q], i);
+      vp = ya_s__mulshift64(4 * m2 + 2, ya_s__pow5_inv_split[q], i);
+      vm = ya_s__mulshift64(4 * m2 - 1 - mmshift, ya_s__pow5_inv_split[q], i);
+      if (q <= 21) {
+         // only mv (or one of its bounds) can be a multiple of 5^q, and then only for small q
+         if (mv % 5 == 0)
+            vr_tz = ya_s__multiple_of_pow5(mv, q);
+         else if (accept_bounds)
+            vm_tz = ya_s__multiple_of_pow5(mv - 1 - mmshift, q);
+         else
+            vp -= ya_s__multiple_of_pow5(mv + 2, q);
+      }
+   } else {
+      int32_t q = ya_s__log10pow5(-e2) - (-e2 > 1);
+      int32_t i = -e2 - q;
+      int32_t k = ya_s__pow5bits(i) - YA_S__POW5_BITCOUNT;
+      int32_t j = q - k;
+      e10 = q + e2;
+      vr = ya_s__mulshift64(4 * m2, ya_s__pow5_split[i], j);
+      vp = ya_s__mulshift64(4 * m2 + 2, ya_s__pow5_split[i], j);
+      vm = ya_s__mulshift64(4 * m2 - 1 - mmshift, ya_s__pow5_split[i], j);
+      if (q <= 1) {
+         // mv has at least q trailing 0 bits, so vr is exact (and so is vm if mmshift==1)
+         vr_tz = 1;
+         if (accept_bounds)
+            vm_tz = mmshift == 1;
+         else
+            --vp; // mp = mv + 2 so it always has at least 1 trailing 0 bit
+      } else if (q < 63) {
+         vr_tz = (mv & ((UINT64_C(1) << q) - 1)) == 0; // need at least q trailing 0 bits in mv
+      }
+   }
+
+   // remove digits while the interval (vm,vp) still holds a number with fewer digits
+   if (vm_tz || vr_tz) {
+      // rare general case
+      for (;;) {
+         uint64_t vp10 = vp / 10, vm10 = vm / 10;
+         uint8_t vmmod10, vrmod10;
+         if (vp10 <= vm10)
+            break;
+         vmmod10 = (uint8_t)(vm - 10 * vm10);
+         vrmod10 = (uint8_t)(vr - 10 * (vr / 10));
+         vm_tz &= vmmod10 == 0;
+         vr_tz &= last_removed == 0;
+         last_removed = vrmod10;
+         vr /= 10;
+         vp = vp10;
+         vm = vm10;
+         ++removed;
+      }
+      if (vm_tz) {
+         for (;;) {
+            uint64_t vm10 = vm / 10;
+            uint8_t vrmod10;
+            if (vm - 10 * vm10 != 0)
+               break;
+            vrmod10 = (uint8_t)(vr % 10);
+            vr_tz &= last_removed == 0;
+            last_removed = vrmod10;
+            vr /= 10;
+            vp /= 10;
+            vm = vm10;
+            ++removed;
+         }
+      }
+      if (vr_tz && last_removed == 5 && vr % 2 == 0)
+         last_removed = 4; // exactly halfway, round to even
+      output = vr + ((vr == vm && (!accept_bounds || !vm_tz)) || last_removed >= 5);
+   } else {
+      // common case, only need to know if the last digit removed was >= 5
+      int round_up = 0;
+      if (vp / 100 > vm / 100) { // remove 2 digits at a time while we can
+         round_up = (vr % 100) >= 50;
+         vr /= 100;
+         vp /= 100;
+         vm /= 100;
+         removed += 2;
+      }
+      for (;;) {
+         if (vp / 10 <= vm / 10)
+            break;
+         round_up = (vr % 10) >= 5;
+         vr /= 10;
+         vp /= 10;
+         vm /= 10;
+         ++removed;
+      }
+      output = vr + (vr == vm || round_up);
+   }
+   e10 += removed;
+
+   // convert to string, at most 17 digits
+   out += 64;
+   n = 0;
+   while (output >= 100000000) {
+      uint32_t d8 = (uint32_t)(output % 100000000);
+      int32_t k;
+      output /= 100000000;
+      for (k = 0; k < 8; ++k) {
+         *--out = (char)('0' + d8 % 10);
+         d8 /= 10;
+      }
+      n += 8;
+   }
+   {
+      uint32_t d = (uint32_t)output;
+      do {
+         *--out = (char)('0' + d % 10);
+         d /= 10;
+         ++n;
+      } while (d);
+   }
+   *decimal_pos = e10 + n;
+   *start = out;
+   *len = n;
+   return ng;
+}
 
 #undef YA_S__SPECIAL
 